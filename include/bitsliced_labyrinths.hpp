@@ -0,0 +1,129 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the BitslicedLabyrinths class, which
+ * holds the walls of 64 Labyrinths of the same size and measures all of
+ * them at once.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+
+// This class holds the connections of kLanes Labyrinths of the same size,
+// for screening many candidate levels quickly.
+//
+// The Labyrinths are bit-sliced: each Room has one 64-bit word saying in
+// which Labyrinths (lanes) it is connected to the Room east of it, and
+// one for the Room south of it, with bit i for lane i. Every operation on
+// a word therefore works on the same Room of all 64 Labyrinths at once,
+// so a breadth-first search advances a whole layer of every Labyrinth
+// with a few word operations per Room, and counts per lane are summed in
+// bit-sliced counters. The lanes fill one machine word rather than a
+// wider vector register, so the class needs no particular instruction
+// set; the loops over Rooms are left simple enough to be vectorized by
+// the compiler.
+//
+// Only connections are held; Items, Inhabitants and exits are not. A lane
+// which has not been loaded has no connections.
+class BitslicedLabyrinths
+{
+  public:
+
+    // The number of Labyrinths held.
+    static const size_t kLanes = 64;
+
+    // The distance to a Room which is not connected.
+    static const uint16_t kUnreachable = 0xFFFF;
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   The sizes are not valid for a Labyrinth (domain_error)
+    BitslicedLabyrinths( const size_t x_size, const size_t y_size );
+
+    // This method copies the connections of l into the lane.
+    // An exception is thrown if:
+    //   lane is not less than kLanes (domain_error)
+    //   The size of l does not match (domain_error)
+    void Load( const size_t lane, const Labyrinth& l );
+
+    // This method connects and disconnects the Rooms of l so that they
+    // match the lane. Items, Inhabitants and the exit of l are kept.
+    // An exception is thrown if:
+    //   lane is not less than kLanes (domain_error)
+    //   The size of l does not match (domain_error)
+    void Store( const size_t lane, Labyrinth& l ) const;
+
+    // This method sets reached[id] to the lanes in which the Room with
+    // RoomId id can be reached from src.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinths (domain_error)
+    void Reachable( const Coordinate src, std::vector<uint64_t>& reached );
+
+    // This method sets counts[i] to the number of Rooms of lane i which can
+    // be reached from src, including src.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinths (domain_error)
+    void CountReachable( const Coordinate src, uint32_t counts[kLanes] );
+
+    // This method sets counts[i] to the number of dead ends (Rooms with
+    // exactly one connection) of lane i.
+    void CountDeadEnds( uint32_t counts[kLanes] ) const;
+
+    // This method writes the breadth-first search layers from src into
+    // layers, and returns the number of layers. The Rooms of lane i at
+    // distance d from src are the Rooms with bit i set in
+    // layers[d * x_size * y_size + id].
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinths (domain_error)
+    size_t Layers( const Coordinate src, std::vector<uint64_t>& layers );
+
+    // This method sets distances[i] to the number of steps from src to dst
+    // in lane i, or kUnreachable. The search stops once dst has been
+    // reached in every lane where it can be.
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinths (domain_error)
+    void Distances( const Coordinate src,
+                    const Coordinate dst,
+                    uint16_t distances[kLanes] );
+
+  private:
+
+    const size_t x_size_;
+    const size_t y_size_;
+    const size_t num_rooms_;
+
+    // Indexed by RoomId; bit i is set if the Room is connected to the Room
+    // east (or south) of it in lane i
+    std::vector<uint64_t> east_;
+    std::vector<uint64_t> south_;
+
+    // Scratch space for searches, by RoomId
+    std::vector<uint64_t> visited_;
+    std::vector<uint64_t> frontier_;
+    std::vector<uint64_t> next_;
+
+    // This private method starts a search from src in every lane.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinths (domain_error)
+    void StartSearch( const Coordinate src, const char* const message );
+
+    // This private method moves the search one layer outward into
+    // frontier_, and returns false if no lane reached a new Room.
+    bool Expand();
+
+    // This private method throws if the lane or the size of l is invalid.
+    // An exception is thrown if:
+    //   lane is not less than kLanes (domain_error)
+    //   The size of l does not match (domain_error)
+    void CheckLane( const size_t lane,
+                    const Labyrinth& l,
+                    const char* const method ) const;
+};
@@ -30,6 +30,13 @@ struct Coordinate
     y = y_coordinate;
   }
 
+  // Copy constructor
+  Coordinate( const Coordinate& c )
+  {
+    x = c.x;
+    y = c.y;
+  }
+
   // Operator overload for ==
   bool operator==( const Coordinate& c ) const
   {
@@ -0,0 +1,264 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the DiagnosticLog class, which writes
+ * diagnostic messages to a file descriptor from a background thread, and
+ * the Log() function which writes to the global log.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// This enum is the importance of a diagnostic message. Messages less
+// severe than the level of a log are discarded; kOff discards every
+// message.
+enum class Severity : uint8_t
+{
+  kDebug,
+  kInfo,
+  kWarning,
+  kError,
+  kOff,
+};
+
+// This class writes diagnostic messages, one per line with the time since
+// the log was created and their severity, to a file descriptor.
+//
+// Write() only places the message in a lock-free queue, which a background
+// thread (started by the first message) empties into the file descriptor,
+// so writing a message never waits for I/O or for a lock. If the queue is
+// full, the message is dropped and counted instead.
+//
+// Messages given as const char* are not copied: they must outlive the
+// log, as string literals and the messages of Status do. Messages given
+// as std::string, such as the messages of exceptions, are copied into the
+// queue, and cut to kMaxCopied characters ending with "...".
+//
+// The same message may be written at most burst times per window;
+// repeats beyond that are counted, and written as one line when the
+// window ends. The limit is checked before a message is queued, in a
+// small table shared by the producers, so a flood of one message never
+// takes the places of others in the queue. A message which finds no free
+// entry in the table is not limited.
+class DiagnosticLog
+{
+  public:
+
+    // Parameterized constructor
+    // Writes messages of the given level or more severe to fd, which is
+    // owned by the caller.
+    // An exception is thrown if:
+    //   fd is negative (invalid_argument)
+    //   burst is 0 or more than kMaxBurst (invalid_argument)
+    explicit DiagnosticLog(
+      const int fd,
+      const Severity level = Severity::kWarning,
+      const size_t burst = 5,
+      const std::chrono::milliseconds window = std::chrono::seconds(1) );
+
+    // Destructor
+    // Writes every queued message, then stops the background thread.
+    ~DiagnosticLog();
+
+    DiagnosticLog( const DiagnosticLog& ) = delete;
+    DiagnosticLog& operator=( const DiagnosticLog& ) = delete;
+
+    static const size_t kMaxBurst = (size_t(1) << 20) - 1;
+    static const size_t kMaxCopied = 127;
+
+    // This method returns the log which Log() writes to, which writes to
+    // standard error.
+    static DiagnosticLog& Global();
+
+    // This method returns true if messages of the given severity are
+    // written.
+    bool Enabled( const Severity s ) const
+    {
+      return s >= level_.load( std::memory_order_relaxed ) &&
+             s != Severity::kOff;
+    }
+
+    // This method sets the least severe level of messages to write.
+    void SetLevel( const Severity level );
+
+    // This method queues the message to be written, if its severity is
+    // enabled. The message is not copied.
+    void Write( const Severity s, const char* const message );
+
+    // This method queues a copy of the message to be written, if its
+    // severity is enabled.
+    void Write( const Severity s, const std::string& message );
+
+    // This method waits until every message queued before the call has
+    // been written.
+    void Flush();
+
+    // This method returns the number of messages written.
+    size_t Written() const;
+
+    // This method returns the number of repeated messages not written
+    // because of the rate limit.
+    size_t Suppressed() const;
+
+    // This method returns the number of messages dropped because the
+    // queue was full.
+    size_t Dropped() const;
+
+  private:
+
+    // A queued message. Its sequence tells the producers and the writer
+    // whose turn it is to use the slot.
+    struct Slot
+    {
+      std::atomic<size_t> sequence;
+      Severity severity;
+      size_t limit;    // The entry of limits_, or kNoLimit
+      size_t repeats;  // Suppressed in the window before this message
+      uint64_t key;  // Of the rate limit
+      const char* message;  // Null if the message was copied into text
+      int64_t time;  // Nanoseconds since start_
+      char text[kMaxCopied + 1];
+    };
+
+    // The rate limit of one message and severity, shared by the producers
+    struct Limit
+    {
+      std::atomic<uint64_t> key;  // 0 if the entry is unused
+      std::atomic<uint64_t> state;  // The window start and count, packed
+      std::atomic<size_t> suppressed;  // Not yet reported
+    };
+
+    // The writer's copy of the message of an entry of limits_
+    struct LimitText
+    {
+      uint64_t key;
+      std::string message;
+    };
+
+    static const size_t kCapacity = 1024;  // A power of 2
+    static const size_t kLimits = 64;  // A power of 2
+    static const size_t kProbes = 4;  // Entries tried for each message
+    static const size_t kNoLimit = kLimits;
+    static const unsigned kCountBits = 20;  // Of the state of a Limit
+
+    const int fd_;
+    const size_t burst_;
+    const int64_t window_;  // Milliseconds
+    const std::chrono::steady_clock::time_point start_;
+    std::atomic<Severity> level_;
+
+    // The queue
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<size_t> enqueue_pos_;
+    size_t dequeue_pos_ = 0;  // Only used by the writer
+    std::atomic<size_t> written_pos_;  // Slots the writer has finished
+    std::atomic<size_t> written_;
+    std::atomic<size_t> suppressed_;
+    std::atomic<size_t> dropped_;
+
+    // The rate limits
+    std::unique_ptr<Limit[]> limits_;
+
+    // The writer
+    std::once_flag started_;
+    std::thread writer_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    std::atomic<bool> idle_;
+    std::atomic<bool> stopping_;
+
+    // Only used by the writer
+    std::vector<LimitText> limit_texts_;
+    size_t dropped_reported_ = 0;
+    std::string buffer_;
+
+    // This private method queues the message, or the size characters of
+    // text if message is null, identified by identity for the rate limit.
+    void Enqueue( const Severity s,
+                  const char* const message,
+                  const char* const text,
+                  const size_t size,
+                  const uint64_t identity );
+
+    // This private method returns the nanoseconds since the log was
+    // created.
+    int64_t Now() const;
+
+    // This private method returns the entry of limits_ for the key, taking
+    // an unused entry or one whose window has ended, or kNoLimit if there
+    // is none.
+    size_t FindLimit( const uint64_t key, const int64_t now );
+
+    // This private method counts a message against its limit at the given
+    // time in milliseconds, and returns true if it may be written. If it
+    // starts a new window, repeats is set to the number suppressed in the
+    // previous one.
+    bool Admit( Limit& limit, const int64_t now, size_t& repeats );
+
+    // This private method returns true if the window of the given state
+    // has ended at the given time in milliseconds.
+    bool WindowEnded( const uint64_t state, const int64_t now ) const;
+
+    // This private method starts the background thread, if it has not been
+    // started yet.
+    void Start();
+
+    // This private method is the background thread, which writes messages
+    // until the log is destroyed.
+    void Run();
+
+    // This private method writes every queued message, and the repeats of
+    // the windows which have ended, and returns true if anything was
+    // written.
+    bool Drain();
+
+    // This private method writes the repeats of the windows which have
+    // ended, or of every window if all is true, and returns true if
+    // anything was written.
+    bool ReportRepeats( const int64_t time, const bool all );
+
+    // This private method appends a line with the given time, severity
+    // and message to buffer_.
+    void Format( const int64_t time,
+                 const Severity s,
+                 const std::string& message );
+
+    // This private method writes buffer_ to the file descriptor, and
+    // empties it.
+    void WriteBuffer();
+};
+
+// This function writes the message to the global log if its severity is
+// enabled, costing a single load otherwise.
+inline void Log( const Severity s, const char* const message )
+{
+  DiagnosticLog& log = DiagnosticLog::Global();
+  if( log.Enabled(s) )
+  {
+    log.Write( s, message );
+  }
+}
+
+// This function writes a copy of the message to the global log if its
+// severity is enabled.
+inline void Log( const Severity s, const std::string& message )
+{
+  DiagnosticLog& log = DiagnosticLog::Global();
+  if( log.Enabled(s) )
+  {
+    log.Write( s, message );
+  }
+}
@@ -0,0 +1,291 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the GridLabyrinth class template, a maze of
+ * cells of any topology in topology.hpp, and the GridSolver class template
+ * which finds paths through it.
+ * Both are templates, so they are implemented in this file.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "topology.hpp"
+
+// This class is a maze of x_size by y_size cells of the given Topology,
+// where every wall starts intact. It stores one open mask per cell, so it
+// holds only the walls; the Labyrinth class remains the square maze with
+// inhabitants and items.
+template <typename Topology>
+class GridLabyrinth
+{
+  static_assert( Topology::kNeighbours <= 8,
+                 "A cell's open mask holds at most 8 sides." );
+
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    //   An x or y size greater than the maximum (20) is given (domain_error)
+    GridLabyrinth( const size_t x_size, const size_t y_size ) :
+      x_size_(x_size),
+      y_size_(y_size)
+    {
+      if( x_size == 0 || y_size == 0 )
+      {
+        throw std::domain_error( "Error: GridLabyrinth() was given a size "\
+          "of 0.\n" );
+      }
+      else if( x_size > kMaxSize || y_size > kMaxSize )
+      {
+        throw std::domain_error( "Error: GridLabyrinth() was given a size "\
+          "greater than the maximum (20).\n" );
+      }
+      open_.assign( x_size * y_size, 0 );
+    }
+
+    // This method returns the number of cells along the x-axis.
+    size_t GetXSize() const
+    {
+      return x_size_;
+    }
+
+    // This method returns the number of cells along the y-axis.
+    size_t GetYSize() const
+    {
+      return y_size_;
+    }
+
+    // This method sets out to the cell across side d of c and returns true,
+    // or returns false if there is no such cell.
+    // An exception is thrown if:
+    //   c is outside the grid, or d is not a side (domain_error)
+    bool Neighbour( const Coordinate c, const uint32_t d, Coordinate& out )
+      const
+    {
+      CheckCell( c, d, "Neighbour" );
+      return Topology::Neighbour( c, d, x_size_, y_size_, out );
+    }
+
+    // This method returns a bit mask of the open sides of c, with bit d set
+    // if side d is open.
+    // An exception is thrown if:
+    //   c is outside the grid (domain_error)
+    uint8_t OpenMask( const Coordinate c ) const
+    {
+      CheckCell( c, 0, "OpenMask" );
+      return open_[Index(c)];
+    }
+
+    // This method returns true if side d of c is open, and false otherwise.
+    // An exception is thrown if:
+    //   c is outside the grid, or d is not a side (domain_error)
+    bool IsOpen( const Coordinate c, const uint32_t d ) const
+    {
+      CheckCell( c, d, "IsOpen" );
+      return (open_[Index(c)] >> d) & 1;
+    }
+
+    // This method opens side d of c, connecting it to the cell across it.
+    // An exception is thrown if:
+    //   c is outside the grid, or d is not a side (domain_error)
+    //   There is no cell across side d (domain_error)
+    //   The side is already open (logic_error)
+    void ConnectCells( const Coordinate c, const uint32_t d )
+    {
+      CheckCell( c, d, "ConnectCells" );
+      Coordinate n;
+      if( !Topology::Neighbour(c, d, x_size_, y_size_, n) )
+      {
+        throw std::domain_error( "Error: ConnectCells() was given a side "\
+          "on the edge of the grid.\n" );
+      }
+      else if( (open_[Index(c)] >> d) & 1 )
+      {
+        throw std::logic_error( "Error: ConnectCells() was given a side "\
+          "which is already open.\n" );
+      }
+      Open( c, d, n );
+    }
+
+    // This method closes every side, then opens sides to make a perfect
+    // maze (exactly one path between any two cells), using a randomized
+    // depth-first search seeded with the given seed.
+    void Generate( const uint32_t seed )
+    {
+      open_.assign( x_size_ * y_size_, 0 );
+      std::mt19937 rng( seed );
+      std::vector<bool> visited( open_.size(), false );
+      std::vector<Coordinate> stack( 1, Coordinate(0, 0) );
+      visited[0] = true;
+      while( !stack.empty() )
+      {
+        const Coordinate c = stack.back();
+        Coordinate candidates[Topology::kNeighbours];
+        uint32_t sides[Topology::kNeighbours];
+        uint32_t num_candidates = 0;
+        for( uint32_t d = 0; d < Topology::kNeighbours; ++d )
+        {
+          Coordinate n;
+          if( Topology::Neighbour(c, d, x_size_, y_size_, n) &&
+              !visited[Index(n)] )
+          {
+            candidates[num_candidates] = n;
+            sides[num_candidates] = d;
+            ++num_candidates;
+          }
+        }
+
+        if( num_candidates == 0 )
+        {
+          stack.pop_back();
+          continue;
+        }
+        const uint32_t pick = rng() % num_candidates;
+        Open( c, sides[pick], candidates[pick] );
+        visited[Index(candidates[pick])] = true;
+        stack.push_back( candidates[pick] );
+      }
+    }
+
+  private:
+
+    static const size_t kMaxSize = 20;
+
+    const size_t x_size_;
+    const size_t y_size_;
+    std::vector<uint8_t> open_;  // Indexed as (y * x_size + x)
+
+    // This private method returns the index of c in open_.
+    size_t Index( const Coordinate c ) const
+    {
+      return c.y * x_size_ + c.x;
+    }
+
+    // This private method opens side d of c and the facing side of n.
+    void Open( const Coordinate c, const uint32_t d, const Coordinate n )
+    {
+      open_[Index(c)] |= 1 << d;
+      open_[Index(n)] |= 1 << Topology::Opposite( c, d );
+    }
+
+    // This private method throws if c is outside the grid or d is not a
+    // side, naming the given method in the message.
+    // An exception is thrown if:
+    //   c is outside the grid, or d is not a side (domain_error)
+    void CheckCell( const Coordinate c,
+                    const uint32_t d,
+                    const char* const method ) const
+    {
+      if( c.x >= x_size_ || c.y >= y_size_ || d >= Topology::kNeighbours )
+      {
+        throw std::domain_error( std::string("Error: ") + method +
+          "() was given a cell outside of the grid or an invalid side.\n" );
+      }
+    }
+};
+
+// This class finds shortest paths through a GridLabyrinth with a
+// breadth-first search. The search memory is reused between searches.
+// g_ does not use a smart pointer because it is simply a pointer to the
+// related GridLabyrinth, not a heap allocation.
+template <typename Topology>
+class GridSolver
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   g is null (invalid_argument)
+    explicit GridSolver( const GridLabyrinth<Topology>* const g ) :
+      g_(g)
+    {
+      if( g == nullptr )
+      {
+        throw std::invalid_argument( "Error: GridSolver() was given an "\
+          "invalid (null) pointer for the GridLabyrinth.\n" );
+      }
+    }
+
+    // This method returns the cells on a shortest path from src to dst,
+    // including both src and dst.
+    // An empty path is returned if dst cannot be reached from src.
+    // An exception is thrown if:
+    //   src or dst is outside the grid (domain_error)
+    std::vector<Coordinate> ShortestPath( const Coordinate src,
+                                          const Coordinate dst )
+    {
+      const size_t x_size = g_->GetXSize();
+      const size_t y_size = g_->GetYSize();
+      if( src.x >= x_size || src.y >= y_size ||
+          dst.x >= x_size || dst.y >= y_size )
+      {
+        throw std::domain_error( "Error: ShortestPath() was given a "\
+          "Coordinate outside of the grid.\n" );
+      }
+
+      const size_t num_cells = x_size * y_size;
+      const size_t kNoParent = num_cells;
+      parent_.assign( num_cells, kNoParent );
+      queue_.clear();
+
+      const size_t src_index = src.y * x_size + src.x;
+      const size_t dst_index = dst.y * x_size + dst.x;
+      parent_[src_index] = src_index;
+      queue_.push_back( src_index );
+      for( size_t head = 0;
+           head < queue_.size() && parent_[dst_index] == kNoParent;
+           ++head )
+      {
+        const Coordinate c( queue_[head] % x_size, queue_[head] / x_size );
+        const uint8_t mask = g_->OpenMask( c );
+        for( uint32_t d = 0; d < Topology::kNeighbours; ++d )
+        {
+          Coordinate n;
+          if( !((mask >> d) & 1) ||
+              !Topology::Neighbour(c, d, x_size, y_size, n) )
+          {
+            continue;
+          }
+          const size_t next = n.y * x_size + n.x;
+          if( parent_[next] == kNoParent )
+          {
+            parent_[next] = queue_[head];
+            queue_.push_back( next );
+          }
+        }
+      }
+
+      std::vector<Coordinate> path;
+      if( parent_[dst_index] == kNoParent )
+      {
+        return path;
+      }
+      for( size_t i = dst_index; ; i = parent_[i] )
+      {
+        path.push_back( Coordinate(i % x_size, i / x_size) );
+        if( i == src_index )
+        {
+          break;
+        }
+      }
+      return std::vector<Coordinate>( path.rbegin(), path.rend() );
+    }
+
+  private:
+
+    const GridLabyrinth<Topology>* const g_;
+    std::vector<size_t> parent_;
+    std::vector<size_t> queue_;
+};
@@ -10,11 +10,24 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "room_properties.hpp"
+#include "status.hpp"
 #include "room.hpp"
 #include "coordinate.hpp"
+#include "labyrinth_snapshot.hpp"
+#include "labyrinth_listener.hpp"
+
+// A Room may also be identified by a single number, (y * x_size + x), for
+// code which keeps per-Room arrays.
+typedef uint32_t RoomId;
+
+// Defined in labyrinth_neighbourhood.hpp
+struct VisitStamps;
+struct Neighbourhood;
 
 // Rooms are indexed first with the y-coordinate, then with the x-coordinate.
 class Labyrinth
@@ -32,6 +45,10 @@ class Labyrinth
       //   An x or y size greater than the maximum is given (domain_error)
       Labyrinth( const size_t x_size, const size_t y_size );
 
+      // This method returns the error which the constructor would throw for
+      // the given sizes, so that they may be checked without exceptions.
+      static Status CheckSizes( const size_t x_size, const size_t y_size );
+
     // SETUP:
 
       // This method connects two Rooms by breaking their walls.
@@ -42,6 +59,14 @@ class Labyrinth
       //   The Rooms are already connected (logic_error)
       void ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 );
 
+      // This method disconnects two connected Rooms by rebuilding their
+      // walls, e.g. when a tunnel collapses.
+      // An exception is thrown if:
+      //   One or both Rooms are outside the Labyrinth (domain_error)
+      //   The Rooms are the same (logic_error)
+      //   The Rooms are not connected (logic_error)
+      void DisconnectRooms( const Coordinate rm_1, const Coordinate rm_2 );
+
       // This method sets the primary (initial) spawn Room.
       // Spawns can be changed at any time.
       // An exception is thrown if:
@@ -54,6 +79,12 @@ class Labyrinth
       //   The Room is outside the Labyrinth (domain_error)
       void SetSpawn2( const Coordinate rm );
 
+      // This method returns the primary spawn Room.
+      Coordinate GetSpawn1() const;
+
+      // This method returns the secondary spawn Room.
+      Coordinate GetSpawn2() const;
+
       // This method sets the exit of the Labyrinth on a Wall.
       // An exception is thrown if:
       //   The Room is outside the Labyrinth (domain_error)
@@ -124,13 +155,236 @@ class Labyrinth
       RoomBorder DirectionCheck( const Coordinate rm,
                                  const Direction d ) const;
 
+      // This method returns the Directions of the Room which lead to another
+      // Room, as a mask with bit 0 set for north, bit 1 for east, bit 2 for
+      // south, and bit 3 for west.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      unsigned char OpenMask( const Coordinate rm ) const;
+
+    // WEIGHTS:
+
+      // This method sets the cost of entering the given Room, for solvers
+      // which take costs into account.
+      // Every Room costs 1 until a weight is set; the weights are only
+      // allocated once the first weight is set.
+      // Weights are not part of snapshots or level files.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      //   The weight is 0 (invalid_argument)
+      void SetRoomWeight( const Coordinate rm, const unsigned char weight );
+
+      // This method returns the cost of entering the given Room.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      unsigned char GetRoomWeight( const Coordinate rm ) const;
+
+    // LAYOUT:
+
+      // This method returns the number of Rooms along the x-axis.
+      size_t GetXSize() const;
+
+      // This method returns the number of Rooms along the y-axis.
+      size_t GetYSize() const;
+
+      // This method returns the RoomId of the given Room.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      RoomId GetRoomId( const Coordinate rm ) const;
+
+      // This method returns the Coordinate of the Room with the given RoomId.
+      // An exception is thrown if:
+      //   The RoomId is outside the Labyrinth (domain_error)
+      Coordinate GetCoordinate( const RoomId id ) const;
+
+    // NEIGHBOURHOODS:
+
+      // This method writes the Rooms which can be reached from rm in at most
+      // radius steps into out, grouped into rings by distance, with a
+      // breadth-first search which stops at radius.
+      // stamps is scratch memory owned by the caller. Once it has grown to
+      // the size of the Labyrinth, the cost depends only on the number of
+      // Rooms found.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      void RoomsWithin( const Coordinate rm,
+                        const size_t radius,
+                        VisitStamps& stamps,
+                        Neighbourhood& out ) const;
+
+    // GATHERING:
+    //   For code which reads many Rooms at once, such as a path or a ring of
+    //   a Neighbourhood. Every Room is checked before anything is written,
+    //   and any of inhabitants, items and masks may be null to skip it.
+
+      // This method writes the Inhabitant, Item and open Directions (as
+      // OpenMask() returns them) of each of the count Rooms into the same
+      // position of inhabitants, items and masks.
+      // An exception is thrown if:
+      //   rooms is null and count is not 0 (invalid_argument)
+      //   One or more Rooms are outside the Labyrinth (domain_error)
+      void GatherRooms( const Coordinate* const rooms,
+                        const size_t count,
+                        Inhabitant* const inhabitants,
+                        Item* const items,
+                        unsigned char* const masks ) const;
+
+      // This method writes the Inhabitant, Item and open Directions of each
+      // of the count Rooms with the given RoomIds, as GatherRooms() does for
+      // Coordinates.
+      // An exception is thrown if:
+      //   ids is null and count is not 0 (invalid_argument)
+      //   One or more RoomIds are outside the Labyrinth (domain_error)
+      void GatherRooms( const RoomId* const ids,
+                        const size_t count,
+                        Inhabitant* const inhabitants,
+                        Item* const items,
+                        unsigned char* const masks ) const;
+
+    // SAVING:
+
+      // This method copies the complete state of the Labyrinth into s.
+      // The buffers of s are reused, so snapshotting into the same
+      // LabyrinthSnapshot repeatedly does not allocate.
+      void TakeSnapshot( LabyrinthSnapshot& s ) const;
+
+      // This method replaces the complete state of the Labyrinth with the
+      // contents of s.
+      // An exception is thrown if:
+      //   The sizes of s do not match the Labyrinth (domain_error)
+      //   s does not contain a Room for every Coordinate (logic_error)
+      void RestoreSnapshot( const LabyrinthSnapshot& s );
+
+    // LISTENERS:
+
+      // This method registers a LabyrinthListener to be notified of changes
+      // to the Labyrinth.
+      // The listener must be removed before it is destroyed.
+      // An exception is thrown if:
+      //   listener is null (invalid_argument)
+      void AddListener( LabyrinthListener* const listener ) const;
+
+      // This method stops notifying the given LabyrinthListener.
+      // Removing a listener which was never added does nothing.
+      void RemoveListener( LabyrinthListener* const listener ) const;
+
+    // ERRORS AS VALUES:
+    //   For callers and builds without exceptions. Nothing is changed when
+    //   an error is returned.
+
+      // This method connects two Rooms as ConnectRooms() does, returning the
+      // error instead of throwing it.
+      Status TryConnectRooms( const Coordinate rm_1, const Coordinate rm_2 );
+
+      // This method disconnects two connected Rooms as DisconnectRooms() does,
+      // returning the error instead of throwing it.
+      Status TryDisconnectRooms( const Coordinate rm_1,
+                                 const Coordinate rm_2 );
+
+      // This method sets the primary spawn Room as SetSpawn1() does, returning
+      // the error instead of throwing it.
+      Status TrySetSpawn1( const Coordinate rm );
+
+      // This method sets the secondary spawn Room as SetSpawn2() does,
+      // returning the error instead of throwing it.
+      Status TrySetSpawn2( const Coordinate rm );
+
+      // This method sets the exit of the Labyrinth as SetExit() does, returning
+      // the error instead of throwing it.
+      Status TrySetExit( const Coordinate rm, const Direction d );
+
+      // This method places an Inhabitant in a Room as SetInhabitant() does,
+      // returning the error instead of throwing it.
+      Status TrySetInhabitant( const Coordinate rm, const Inhabitant inh );
+
+      // This method places an Item in a Room as SetItem() does, returning the
+      // error instead of throwing it.
+      Status TrySetItem( const Coordinate rm, const Item itm );
+
+      // This method returns the current Inhabitant of the Room as
+      // GetInhabitant() does, returning the error instead of throwing it.
+      Expected<Inhabitant> TryGetInhabitant( const Coordinate rm ) const;
+
+      // This method attacks the Inhabitant of the Room as AttackEnemy() does,
+      // returning the error instead of throwing it.
+      Status TryAttackEnemy( const Coordinate rm );
+
+      // This method returns the current Item in the given Room as ItemAt()
+      // does, returning the error instead of throwing it.
+      Expected<Item> TryItemAt( const Coordinate rm ) const;
+
+      // This method takes the Item from the Room as TakeItem() does, returning
+      // the error instead of throwing it.
+      Status TryTakeItem( const Coordinate rm );
+
+      // This method drops the Treasure in the given Room as DropTreasure()
+      // does, returning the error instead of throwing it.
+      Status TryDropTreasure( const Coordinate rm );
+
+      // This method returns the type of RoomBorder in the given direction as
+      // DirectionCheck() does, returning the error instead of throwing it.
+      Expected<RoomBorder> TryDirectionCheck( const Coordinate rm,
+                                              const Direction d ) const;
+
+      // This method returns the open Directions of the Room as OpenMask()
+      // does, returning the error instead of throwing it.
+      Expected<unsigned char> TryOpenMask( const Coordinate rm ) const;
+
+      // This method sets the cost of entering the given Room as
+      // SetRoomWeight() does, returning the error instead of throwing it.
+      Status TrySetRoomWeight( const Coordinate rm,
+                               const unsigned char weight );
+
+      // This method returns the cost of entering the given Room as
+      // GetRoomWeight() does, returning the error instead of throwing it.
+      Expected<unsigned char> TryGetRoomWeight( const Coordinate rm ) const;
+
+      // This method returns the RoomId of the given Room as GetRoomId() does,
+      // returning the error instead of throwing it.
+      Expected<RoomId> TryGetRoomId( const Coordinate rm ) const;
+
+      // This method returns the Coordinate of the Room with the given RoomId as
+      // GetCoordinate() does, returning the error instead of throwing it.
+      Expected<Coordinate> TryGetCoordinate( const RoomId id ) const;
+
+      // This method finds the Rooms within radius steps of rm as RoomsWithin()
+      // does, returning the error instead of throwing it.
+      Status TryRoomsWithin( const Coordinate rm,
+                             const size_t radius,
+                             VisitStamps& stamps,
+                             Neighbourhood& out ) const;
+
+      // This method reads many Rooms as GatherRooms() does, returning the
+      // error instead of throwing it.
+      Status TryGatherRooms( const Coordinate* const rooms,
+                             const size_t count,
+                             Inhabitant* const inhabitants,
+                             Item* const items,
+                             unsigned char* const masks ) const;
+
+      // This method reads many Rooms by RoomId as GatherRooms() does,
+      // returning the error instead of throwing it.
+      Status TryGatherRooms( const RoomId* const ids,
+                             const size_t count,
+                             Inhabitant* const inhabitants,
+                             Item* const items,
+                             unsigned char* const masks ) const;
+
+      // This method replaces the complete state of the Labyrinth as
+      // RestoreSnapshot() does, returning the error instead of throwing it.
+      Status TryRestoreSnapshot( const LabyrinthSnapshot& s );
+
+      // This method registers a LabyrinthListener as AddListener() does,
+      // returning the error instead of throwing it.
+      Status TryAddListener( LabyrinthListener* const listener ) const;
+
   private:
 
     std::unique_ptr< std::unique_ptr<Room[]>[] > rooms_;
     const size_t x_size_;
     const size_t y_size_;
-    const size_t MAX_X_SIZE_ = 20;
-    const size_t MAX_Y_SIZE_ = 20;
+    static const size_t MAX_X_SIZE_ = 20;
+    static const size_t MAX_Y_SIZE_ = 20;
 
     // Special rooms:
     //   Should be set before the game begins
@@ -141,10 +395,17 @@ class Labyrinth
     bool treasure_set_ = false;  // Is also false when the treasure is held
                                  // by a Player
 
+    // Weights are indexed as (y * x_size + x), and are null while every
+    // Room costs 1.
+    std::unique_ptr<unsigned char[]> weights_;
+
+    // Listeners observe the Labyrinth rather than being part of its state,
+    // so they may be added to a const Labyrinth.
+    // Listeners are not owned by the Labyrinth.
+    mutable std::vector<LabyrinthListener*> listeners_;
+
     // This private method returns a reference to the Room at the given
-    // coordinate.
-    // An exception is thrown if:
-    //   The Room is outside the Labyrinth (domain_error)
+    // coordinate, which must be within the Labyrinth.
     Room& RoomAt( const Coordinate rm ) const;
 
     // This private method returns true if the Room is within the bounds of
@@ -152,10 +413,11 @@ class Labyrinth
     bool WithinBounds( const Coordinate rm ) const;
 
     // This private method returns true if the two Rooms are adjacent, and
-    // false otherwise.
-    // An exception is thrown if:
-    //   One or both Rooms are outside the Labyrinth (domain_error)
-    //   The same Room is given twice (logic_error)
+    // false otherwise (including when the same Room is given twice).
     bool IsAdjacent( const Coordinate rm_1, const Coordinate rm_2 ) const;
 
+    // This private method notifies every listener that the contents of the
+    // Room have changed.
+    void NotifyRoomChanged( const Coordinate rm ) const;
+
 };
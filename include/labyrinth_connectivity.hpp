@@ -0,0 +1,177 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthConnectivity class, which
+ * answers whether two Rooms of a Labyrinth are connected while walls are
+ * both broken and rebuilt, and the EulerTourForest class which it uses.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth_listener.hpp"
+#include "labyrinth.hpp"
+
+// This class is a forest over a fixed number of vertices, whose trees can
+// be linked and cut by edge, and which answers whether two vertices are in
+// the same tree.
+//
+// Each tree is stored as its Euler tour (every vertex once, and every edge
+// once in each direction) in a treap ordered by position in the tour, so
+// linking, cutting and queries take O(log n) expected time.
+// All memory is allocated by the constructor.
+class EulerTourForest
+{
+  public:
+
+    // Parameterized constructor
+    // Edges are numbered from 0 to num_edges - 1; each edge may be in the
+    // forest at most once at a time.
+    EulerTourForest( const uint32_t num_vertices, const uint32_t num_edges );
+
+    // This method removes every edge.
+    void Clear();
+
+    // This method adds edge e between vertices u and v, which must be in
+    // different trees.
+    void Link( const uint32_t e, const uint32_t u, const uint32_t v );
+
+    // This method removes edge e, which must be in the forest.
+    void Cut( const uint32_t e );
+
+    // This method returns true if u and v are in the same tree, and false
+    // otherwise.
+    bool Connected( const uint32_t u, const uint32_t v ) const;
+
+    // This method returns the number of vertices in the tree of u.
+    uint32_t TreeSize( const uint32_t u ) const;
+
+    // This method replaces the contents of out with the vertices in the
+    // tree of u.
+    void TreeVertices( const uint32_t u, std::vector<uint32_t>& out ) const;
+
+  private:
+
+    static const uint32_t kNil_ = UINT32_MAX;
+
+    // Nodes 0 to num_vertices_ - 1 are vertices; edge e is the two nodes
+    // num_vertices_ + 2e and num_vertices_ + 2e + 1.
+    const uint32_t num_vertices_;
+    std::vector<uint32_t> left_;
+    std::vector<uint32_t> right_;
+    std::vector<uint32_t> parent_;
+    std::vector<uint32_t> priority_;
+    std::vector<uint32_t> size_;      // Nodes in the subtree
+    std::vector<uint32_t> vertices_;  // Vertex nodes in the subtree
+
+    // This private method makes x a tree of its own.
+    void Reset( const uint32_t x );
+
+    // This private method recomputes the counts of x from its children.
+    void Update( const uint32_t x );
+
+    // This private method returns the root of the treap containing x.
+    uint32_t Root( uint32_t x ) const;
+
+    // This private method returns the position of x in its tour.
+    uint32_t Position( uint32_t x ) const;
+
+    // This private method joins two treaps, a before b, and returns the
+    // root of the result.
+    uint32_t Merge( const uint32_t a, const uint32_t b );
+
+    // This private method splits the treap t into its first k nodes, a,
+    // and the rest, b.
+    void Split( const uint32_t t, const uint32_t k, uint32_t& a, uint32_t& b );
+
+    // This private method rotates the tour of the tree of vertex v to
+    // begin at v.
+    void Reroot( const uint32_t v );
+};
+
+// This class keeps track of which Rooms of a Labyrinth are connected, even
+// as walls are rebuilt with Labyrinth::DisconnectRooms().
+//
+// The connected Rooms are covered by a spanning forest kept in an
+// EulerTourForest; the other connections are spares. Removing a spare
+// changes nothing, and when a forest connection is removed, the Rooms of
+// the smaller of the two halves are searched for a spare which joins them
+// again. Queries take O(log n) time and never search the Labyrinth.
+//
+// The structure listens to its Labyrinth to stay up to date.
+// The Labyrinth must outlive the structure.
+class LabyrinthConnectivity : public LabyrinthListener
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    explicit LabyrinthConnectivity( const Labyrinth* const l );
+
+    // Destructor
+    // Stops listening to the Labyrinth.
+    ~LabyrinthConnectivity();
+
+    LabyrinthConnectivity( const LabyrinthConnectivity& ) = delete;
+    LabyrinthConnectivity& operator=( const LabyrinthConnectivity& ) = delete;
+
+    // This method returns true if there is a path between the two Rooms,
+    // and false otherwise.
+    // An exception is thrown if:
+    //   A Room is outside the Labyrinth (domain_error)
+    bool Connected( const Coordinate rm_1, const Coordinate rm_2 ) const;
+
+    // This method returns the number of Rooms reachable from the given Room,
+    // including itself.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    size_t ComponentSize( const Coordinate rm ) const;
+
+    // This method adds the connection between the two Rooms.
+    void RoomsConnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method removes the connection between the two Rooms, and finds
+    // a replacement if it was part of the spanning forest.
+    void RoomsDisconnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method re-reads every connection of the Labyrinth.
+    void LabyrinthReset();
+
+  private:
+
+    enum class Edge : uint8_t
+    {
+      kWall,
+      kTree,   // In the spanning forest
+      kSpare,  // Connected, but not in the spanning forest
+    };
+
+    const Labyrinth* const l_;
+    const uint32_t x_size_;
+    const uint32_t y_size_;
+    const uint32_t num_east_edges_;  // Edges to the east come first
+
+    EulerTourForest forest_;
+    std::vector<Edge> edges_;
+    std::vector<uint32_t> half_;  // Rooms of a half, for RoomsDisconnected()
+
+    // This private method returns the number of the edge between two
+    // adjacent Rooms.
+    uint32_t EdgeBetween( const Coordinate rm_1, const Coordinate rm_2 ) const;
+
+    // This private method adds edge e between Rooms u and v.
+    void Insert( const uint32_t e, const uint32_t u, const uint32_t v );
+
+    // This private method writes the edges of Room u into edges and the
+    // Rooms across them into rooms, and returns how many there are.
+    uint32_t Incident( const uint32_t u,
+                       uint32_t edges[4],
+                       uint32_t rooms[4] ) const;
+};
@@ -0,0 +1,110 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthGraph interface, which presents
+ * the connected Rooms of a Labyrinth as a graph for generic graph
+ * algorithms, and its two implementations.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "labyrinth.hpp"
+
+// This class is a read-only graph with a node for every Room of a
+// Labyrinth, numbered by RoomId, and an edge in each direction between
+// every pair of connected Rooms. Exits are not edges.
+class LabyrinthGraph
+{
+  public:
+
+    // Destructor
+    virtual ~LabyrinthGraph() {}
+
+    // This method returns the number of nodes.
+    virtual uint32_t NumNodes() const = 0;
+
+    // This method writes the neighbours of node u into out, in the order
+    // north, east, south, west, and returns how many there are.
+    // An exception is thrown if:
+    //   u is not a node of the graph (domain_error)
+    virtual uint32_t Neighbours( const uint32_t u, uint32_t out[4] ) const = 0;
+};
+
+// This class is a copy of the graph of a Labyrinth in compressed sparse row
+// form: the neighbours of node u are Targets()[Offsets()[u]] up to
+// Targets()[Offsets()[u + 1]].
+// The copy is built in a single pass over the Rooms, and does not follow
+// later changes to the Labyrinth until Rebuild() is called.
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class LabyrinthCsrGraph : public LabyrinthGraph
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    explicit LabyrinthCsrGraph( const Labyrinth* const l );
+
+    // This method rebuilds the graph from the current Labyrinth.
+    // The arrays are reused, so rebuilding does not allocate.
+    void Rebuild();
+
+    // This method returns the number of nodes.
+    uint32_t NumNodes() const;
+
+    // This method returns the number of edges, counting each direction.
+    uint32_t NumEdges() const;
+
+    // This method writes the neighbours of node u into out, in the order
+    // north, east, south, west, and returns how many there are.
+    // An exception is thrown if:
+    //   u is not a node of the graph (domain_error)
+    uint32_t Neighbours( const uint32_t u, uint32_t out[4] ) const;
+
+    // This method returns the NumNodes() + 1 row offsets into Targets().
+    const uint32_t* Offsets() const;
+
+    // This method returns the NumEdges() neighbour node ids.
+    const uint32_t* Targets() const;
+
+  private:
+
+    const Labyrinth* const l_;
+    std::vector<uint32_t> offsets_;
+    std::vector<uint32_t> targets_;
+};
+
+// This class is the graph of a Labyrinth computed from its walls as it is
+// queried, so it needs no memory of its own and always matches the
+// Labyrinth.
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class LabyrinthEdgeView : public LabyrinthGraph
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    explicit LabyrinthEdgeView( const Labyrinth* const l );
+
+    // This method returns the number of nodes.
+    uint32_t NumNodes() const;
+
+    // This method writes the neighbours of node u into out, in the order
+    // north, east, south, west, and returns how many there are.
+    // An exception is thrown if:
+    //   u is not a node of the graph (domain_error)
+    uint32_t Neighbours( const uint32_t u, uint32_t out[4] ) const;
+
+  private:
+
+    const Labyrinth* const l_;
+};
@@ -0,0 +1,61 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthListener class, which is
+ * notified of changes to a Labyrinth so that anything derived from the
+ * Labyrinth can be kept up to date.
+ *
+ */
+
+#pragma once
+
+#include "coordinate.hpp"
+
+// This class is a template for classes which need to know when a Labyrinth
+// changes. Subclasses override the notifications they are interested in and
+// register themselves with Labyrinth::AddListener().
+//
+// Notifications are sent after the change has been made.
+class LabyrinthListener
+{
+  public:
+
+    // Destructor
+    // Prevents error messages about non-virtual destructors
+    virtual ~LabyrinthListener()
+    {
+    }
+
+    // This method is called when two Rooms have been connected.
+    virtual void RoomsConnected( const Coordinate rm_1, const Coordinate rm_2 )
+    {
+      // Avoiding unused parameter warning
+      (void)(rm_1);
+      (void)(rm_2);
+    }
+
+    // This method is called when two Rooms have been disconnected.
+    virtual void RoomsDisconnected( const Coordinate rm_1,
+                                    const Coordinate rm_2 )
+    {
+      // Avoiding unused parameter warning
+      (void)(rm_1);
+      (void)(rm_2);
+    }
+
+    // This method is called when the Inhabitant, Item or exit of a Room has
+    // changed.
+    virtual void RoomChanged( const Coordinate rm )
+    {
+      // Avoiding unused parameter warning
+      (void)(rm);
+    }
+
+    // This method is called when the whole Labyrinth has been replaced
+    // (e.g. by RestoreSnapshot()), so anything may have changed.
+    virtual void LabyrinthReset()
+    {
+    }
+};
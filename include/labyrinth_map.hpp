@@ -10,13 +10,42 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "coordinate.hpp"
 #include "room_properties.hpp"
+#include "status.hpp"
 #include "labyrinth.hpp"
+#include "labyrinth_listener.hpp"
+#include "output_sink.hpp"
+
+// This enum is the set of characters a LabyrinthMap is drawn with:
+//   kUnicode:     UTF-8 box drawing characters (3 bytes each)
+//   kAscii:       +, -, | and * (1 byte each), for logs and slow consoles
+//   kCodePage437: the box drawing characters of code page 437 (1 byte each),
+//                 for consoles which use it
+enum class GlyphSet
+{
+  kUnicode,
+  kAscii,
+  kCodePage437,
+};
+
+// This enum is how a LabyrinthMap reads the Labyrinth it draws:
+//   kCopy: keeps a copy of every Border and Room, which is updated from the
+//          Labyrinth as it changes
+//   kView: keeps no state per Room, and reads the walls and contents of the
+//          Labyrinth while drawing
+enum class MapStorage
+{
+  kCopy,
+  kView,
+};
 
 // This class is a template for LabyrinthMapCoordinateBorder and
 // LabyrinthMapCoordinateRoom to inherit from, so that an array can be
@@ -46,10 +75,10 @@ class LabyrinthMapCoordinate
       // Avoiding unused parameter warning
       (void)(d);
 
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateRoom "\
-        "attempted to call IsWall(), which is a Border-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
+      RaiseError( Status(ErrorCode::kLogicError, "Error: A "\
+        "LabyrinthMapCoordinateRoom attempted to call IsWall(), which is a "\
+        "Border-only method.\nConsider using IsRoom() to check whether the "\
+        "Coordinate is a Border or Room.\n") );
     }
 
     virtual void SetWall( const Direction d, const bool exists )
@@ -58,18 +87,18 @@ class LabyrinthMapCoordinate
       (void)(d);
       (void)(exists);
 
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateRoom "\
-        "attempted to call SetWall(), which is a Border-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
+      RaiseError( Status(ErrorCode::kLogicError, "Error: A "\
+        "LabyrinthMapCoordinateRoom attempted to call SetWall(), which is a "\
+        "Border-only method.\nConsider using IsRoom() to check whether the "\
+        "Coordinate is a Border or Room.\n") );
     }
 
     virtual bool IsExit() const
     {
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateRoom "\
-        "attempted to call IsExit(), which is a Border-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
+      RaiseError( Status(ErrorCode::kLogicError, "Error: A "\
+        "LabyrinthMapCoordinateRoom attempted to call IsExit(), which is a "\
+        "Border-only method.\nConsider using IsRoom() to check whether the "\
+        "Coordinate is a Border or Room.\n") );
     }
 
     virtual void SetExit( const bool b )
@@ -77,20 +106,20 @@ class LabyrinthMapCoordinate
       // Avoiding unused parameter warning
       (void)(b);
 
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateRoom "\
-        "attempted to call SetExit(), which is a Border-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
+      RaiseError( Status(ErrorCode::kLogicError, "Error: A "\
+        "LabyrinthMapCoordinateRoom attempted to call SetExit(), which is a "\
+        "Border-only method.\nConsider using IsRoom() to check whether the "\
+        "Coordinate is a Border or Room.\n") );
     }
 
     // Room-only methods:
 
     virtual Inhabitant GetInhabitant() const
     {
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateBorder "\
-        "attempted to call HasInhabitant(), which is a Room-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
+      RaiseError( Status(ErrorCode::kLogicError, "Error: A "\
+        "LabyrinthMapCoordinateBorder attempted to call HasInhabitant(), "\
+        "which is a Room-only method.\nConsider using IsRoom() to check "\
+        "whether the Coordinate is a Border or Room.\n") );
     }
 
     virtual void SetInhabitant( const Inhabitant inh )
@@ -98,18 +127,18 @@ class LabyrinthMapCoordinate
       // Avoiding unused parameter warning
       (void)(inh);
 
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateBorder "\
-        "attempted to call SetInhabitant(), which is a Room-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
+      RaiseError( Status(ErrorCode::kLogicError, "Error: A "\
+        "LabyrinthMapCoordinateBorder attempted to call SetInhabitant(), "\
+        "which is a Room-only method.\nConsider using IsRoom() to check "\
+        "whether the Coordinate is a Border or Room.\n") );
     }
 
     virtual Item ItemAt() const
     {
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateBorder "\
-        "attempted to call ItemAt(), which is a Room-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
+      RaiseError( Status(ErrorCode::kLogicError, "Error: A "\
+        "LabyrinthMapCoordinateBorder attempted to call ItemAt(), which is a "\
+        "Room-only method.\nConsider using IsRoom() to check whether the "\
+        "Coordinate is a Border or Room.\n") );
     }
 
     virtual void SetItem( const Item i )
@@ -117,10 +146,10 @@ class LabyrinthMapCoordinate
       // Avoiding unused parameter warning
       (void)(i);
 
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateBorder "\
-        "attempted to call SetItem(), which is a Room-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
+      RaiseError( Status(ErrorCode::kLogicError, "Error: A "\
+        "LabyrinthMapCoordinateBorder attempted to call SetItem(), which is a "\
+        "Room-only method.\nConsider using IsRoom() to check whether the "\
+        "Coordinate is a Border or Room.\n") );
     }
 
 };
@@ -197,26 +226,78 @@ class LabyrinthMapCoordinateRoom : public LabyrinthMapCoordinate
 // Rooms are indexed first with the y-coordinate, then with the x-coordinate.
 // l_ does not use a smart pointer because it is simply a pointer to the
 // related Labyrinth, not a heap allocation.
-class LabyrinthMap
+//
+// The map is not created until it is first displayed, so a LabyrinthMap
+// which is never displayed costs no more than its own members.
+//
+// The rendered bytes of each row of the map are cached with a version
+// stamp, which is bumped whenever the Labyrinth reports a change to that
+// row's Rooms or Borders. Display() only draws the rows which have changed.
+// The Labyrinth must outlive the map.
+class LabyrinthMap : public LabyrinthListener
 {
   public:
 
     // Parameterized constructor
+    // The map is drawn with the given glyph set, and reads the Labyrinth
+    // with the given storage.
     // An exception is thrown if:
     //   l is null (invalid_argument)
     //   A size of 0 is given (domain_error)
     LabyrinthMap( const Labyrinth* const l,
                   const size_t x_size,
-                  const size_t y_size );
+                  const size_t y_size,
+                  const GlyphSet glyphs = GlyphSet::kUnicode,
+                  const MapStorage storage = MapStorage::kCopy );
+
+    // This method returns the error which the constructor would throw for
+    // the given arguments, so that they may be checked without exceptions.
+    static Status CheckArguments( const Labyrinth* const l,
+                                  const size_t x_size,
+                                  const size_t y_size );
+
+    // Destructor
+    // Stops listening to the Labyrinth.
+    ~LabyrinthMap();
+
+    LabyrinthMap( const LabyrinthMap& ) = delete;
+    LabyrinthMap& operator=( const LabyrinthMap& ) = delete;
 
-    // This method displays a map of the current Labyrinth.
+    // This method displays a map of the current Labyrinth on std::cout.
     void Display();
 
+    // This method writes a map of the current Labyrinth to the given sink,
+    // as the axis labels, the map itself and the legend in one call to
+    // OutputSink::WriteSegments().
+    // An exception is thrown if:
+    //   The sink cannot write the map (runtime_error)
+    void Display( OutputSink& sink );
+
+    // This method returns true if the map's copy of the Labyrinth has been
+    // created, which is not done until it is first displayed, and never
+    // with MapStorage::kView.
+    bool Allocated() const;
+
+    // This method marks the rows around both Rooms as changed.
+    void RoomsConnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method marks the rows around both Rooms as changed.
+    void RoomsDisconnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method marks the rows around the Room as changed.
+    void RoomChanged( const Coordinate rm );
+
+    // This method marks every row as changed.
+    void LabyrinthReset();
+
   private:
 
     const Labyrinth* const l_;
     const size_t x_size_;
     const size_t y_size_;
+    const GlyphSet glyphs_;
+    const MapStorage storage_;
+    bool created_ = false;  // Display() has been called
 
     // 2-d array of LabyrinthMapCoordinate pointers
     std::unique_ptr<
@@ -227,6 +308,50 @@ class LabyrinthMap
     const size_t map_x_size_;
     const size_t map_y_size_;
 
+    // Rendered output, reused between calls to Display()
+    std::string header_;  // The x-axis label and numbering
+    std::string legend_;  // Preceded by the blank lines after the map
+
+    // A rendered row of the map, and the version of the row it shows
+    struct CachedRow
+    {
+      std::string bytes;
+      uint32_t version = 0;
+    };
+    std::vector<CachedRow> rows_;
+    std::vector<uint32_t> row_versions_;  // Start ahead of rows_
+    std::vector<bool> stale_;  // Labyrinth rows to be read again
+    bool changed_ = true;      // Some row of stale_ is set
+    std::vector<OutputSegment> segments_;
+
+    // This private method marks the Room's row as stale, and bumps the
+    // versions of the map rows showing the Room and the Borders above and
+    // below it.
+    void MarkRoom( const Coordinate rm );
+
+    // This private method appends the given row of the map to out.
+    void DisplayRow( const size_t y, std::string& out ) const;
+
+    // This private method creates the map from the Labyrinth, if it has not
+    // been created yet. Only the rendered rows are created with
+    // MapStorage::kView.
+    void CreateMap();
+
+    // This private method returns true if there is a wall on the west side
+    // of the given Room, read from the Labyrinth.
+    // x may be x_size, for the east side of the Labyrinth.
+    bool WallWestOf( const size_t x, const size_t y ) const;
+
+    // This private method returns true if there is a wall on the north side
+    // of the given Room, read from the Labyrinth.
+    // y may be y_size, for the south side of the Labyrinth.
+    bool WallNorthOf( const size_t x, const size_t y ) const;
+
+    // This private method returns the walls of the given Border Coordinate
+    // as a mask, with bit 0 set for north, bit 1 for east, bit 2 for south
+    // and bit 3 for west.
+    unsigned BorderWalls( const Coordinate c ) const;
+
     // This private method returns true if the Coordinate is within the bounds
     // of the Map, and false otherwise.
     bool WithinBoundsOfMap( const Coordinate c ) const;
@@ -269,31 +394,31 @@ class LabyrinthMap
     // for that.
     void CleanBorders();
 
-    // This private method updates the Map Borders by checking the contents
-    // of the Labyrinth.
+    // This private method updates the Map Borders of the stale rows by
+    // checking the contents of the Labyrinth.
     // Borders in the Map but not in the Labyrinth will be removed from
     // the Map; borders in the Labyrinth but not in the Map will not
     // be added to the Map.
     void UpdateBorders();
 
-    // This private method updates the Map Rooms by checking the contents
-    // of the Labyrinth.
+    // This private method updates the Map Rooms of the stale rows by
+    // checking the contents of the Labyrinth.
     void UpdateRooms();
 
-    // This private method displays the x-axis label as well as numbering
-    // of the x-coordinates of Rooms.
+    // This private method appends the x-axis label as well as numbering
+    // of the x-coordinates of Rooms to out.
     // Only to be used by Display().
-    void LabelXAxis() const;
+    void LabelXAxis( std::string& out ) const;
 
-    // This private method displays numbering of the y-coordinates of a Room
+    // This private method appends numbering of the y-coordinates of a Room
     // as well as the y-axis label (if in the correct position), or padding
-    // if the row has no Rooms.
+    // if the row has no Rooms, to out.
     // Only to be used by Display().
     // Should be called every time a row of the Map is printed.
-    void LabelYAxis( const size_t y ) const;
+    void LabelYAxis( const size_t y, std::string& out ) const;
 
-    // This private method returns characters with the contents of the
-    // given Room Coordinate.
+    // This private method appends characters with the contents of the
+    // given Room Coordinate to out.
     // Legend of symbols:
     //   Inhabitants:
     //     None:
@@ -303,20 +428,22 @@ class LabyrinthMap
     //     Mirror (cracked): 0
     //   Items:
     //     None:
-    //     Bullet:   •
+    //     Bullet:   • (* in ASCII)
     //     Treasure: T
     // An exception is thrown if:
     //   The Coordinate is outside of the Labyrinth (domain_error)
     //   The Coordinate designates a Border (logic_error)
-    std::string DisplayRoom( const Coordinate c ) const;
+    void DisplayRoom( const Coordinate c, std::string& out ) const;
 
-    // This private method returns a character representing the given
-    // Border Coordinate.
+    // This private method appends the character representing the given
+    // Border Coordinate to out, count times.
     // An exception is thrown if:
     //   The Coordinate is outside of the Labyrinth (domain_error)
     //   The Coordinate designates a Room (logic_error)
-    std::string DisplayBorder( const Coordinate c ) const;
+    void DisplayBorder( const Coordinate c,
+                        const size_t count,
+                        std::string& out ) const;
 
-    // This private method displays a legend for the Map symbols.
-    void DisplayLegend() const;
+    // This private method appends a legend for the Map symbols to out.
+    void DisplayLegend( std::string& out ) const;
 };
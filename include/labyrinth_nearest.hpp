@@ -0,0 +1,199 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthNearest class, which finds
+ * the nearest Rooms holding a given Item or Inhabitant by the number of
+ * steps through a Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "coordinate.hpp"
+#include "labyrinth_listener.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_neighbourhood.hpp"
+
+// A Room found by LabyrinthNearest, and the number of steps to it.
+struct NearestRoom
+{
+  bool found = false;
+  Coordinate room;
+  uint32_t distance = 0;
+};
+
+// This class answers "where is the nearest Room holding this Item (or
+// Inhabitant), and how many steps away is it" for a single Labyrinth.
+//
+// Each Item and Inhabitant is a content type. A content type which has
+// been asked for only a few times is found by searching outward from the
+// Room, stopping at the first match. Once it has been asked for
+// cache_after times, a distance field is kept for it instead: the distance
+// from every Room to its nearest source (a Room holding the content), and
+// which source that is, so each question is a lookup.
+//
+// The cache listens to its Labyrinth and repairs its fields in place:
+//   A new source (e.g. SetItem()) lowers the distances around it.
+//   A removed source (e.g. TakeItem() or AttackEnemy()) recomputes only
+//     the Rooms which were nearest to it, starting from their neighbours
+//     which are nearest to another source.
+//   Connecting two Rooms lowers the distances around them.
+// Disconnecting Rooms can lengthen any distance, so it drops every field,
+// which is rebuilt by the next question.
+//
+// The Labyrinth must outlive the cache.
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class LabyrinthNearest : public LabyrinthListener
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    explicit LabyrinthNearest( const Labyrinth* const l,
+                               const size_t cache_after = 4 );
+
+    // Destructor
+    // Stops listening to the Labyrinth.
+    ~LabyrinthNearest();
+
+    LabyrinthNearest( const LabyrinthNearest& ) = delete;
+    LabyrinthNearest& operator=( const LabyrinthNearest& ) = delete;
+
+    // This method returns the nearest Room to rm holding the Item, which
+    // may be rm itself.
+    // found is false if no Room holding the Item can be reached.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    //   itm is Item::kNone (invalid_argument)
+    NearestRoom NearestItem( const Coordinate rm, const Item itm );
+
+    // This method returns the nearest Room to rm holding the Inhabitant,
+    // which may be rm itself.
+    // found is false if no Room holding the Inhabitant can be reached.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    //   inh is Inhabitant::kNone (invalid_argument)
+    NearestRoom NearestInhabitant( const Coordinate rm,
+                                   const Inhabitant inh );
+
+    // This method writes the k nearest Rooms to rm holding the Item into
+    // out, nearest first, with a search which stops at the kth Room.
+    // Fewer than k Rooms are written if fewer can be reached.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    //   itm is Item::kNone (invalid_argument)
+    void KNearestItems( const Coordinate rm,
+                        const Item itm,
+                        const size_t k,
+                        std::vector<NearestRoom>& out );
+
+    // This method writes the k nearest Rooms to rm holding the Inhabitant
+    // into out, nearest first, with a search which stops at the kth Room.
+    // Fewer than k Rooms are written if fewer can be reached.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    //   inh is Inhabitant::kNone (invalid_argument)
+    void KNearestInhabitants( const Coordinate rm,
+                              const Inhabitant inh,
+                              const size_t k,
+                              std::vector<NearestRoom>& out );
+
+    // This method returns the number of distance fields currently kept.
+    size_t FieldsKept() const;
+
+    // This method returns the number of questions answered by a lookup in
+    // a distance field.
+    size_t Lookups() const;
+
+    // This method returns the number of questions answered by searching
+    // outward from the Room.
+    size_t Searches() const;
+
+    // This method updates the distance fields around two connected Rooms.
+    void RoomsConnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method drops every distance field.
+    void RoomsDisconnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method adds or removes the Room as a source of the distance
+    // fields whose content it has gained or lost.
+    void RoomChanged( const Coordinate rm );
+
+    // This method drops every distance field.
+    void LabyrinthReset();
+
+  private:
+
+    // The distance field of one content type, indexed by RoomId
+    struct Field
+    {
+      bool kept = false;
+      size_t questions = 0;
+      std::vector<uint16_t> distance;
+      std::vector<RoomId> source;
+    };
+
+    // Fields are indexed by Item, then by kNumItems + Inhabitant
+    static const size_t kNumItems = 4;
+    static const size_t kNumFields = kNumItems + 5;
+    static const uint16_t kUnreachable = 0xFFFF;
+    static const RoomId kNoRoom = 0xFFFFFFFF;
+
+    const Labyrinth* const l_;
+    const size_t x_size_;
+    const size_t num_rooms_;
+    const size_t cache_after_;
+
+    Field fields_[kNumFields];
+    size_t lookups_ = 0;
+    size_t searches_ = 0;
+
+    // Scratch memory, reused by every search and repair
+    VisitStamps stamps_;
+    std::vector<RoomId> queue_;
+    std::vector<uint16_t> queue_distance_;
+    std::vector<NearestRoom> found_;
+    std::vector<uint32_t> seeds_;  // (distance << 16 | RoomId), so that
+                                   // sorting orders them by distance
+
+    // This private method returns the nearest Room to rm holding the
+    // content of field f.
+    NearestRoom Nearest( const Coordinate rm, const size_t f );
+
+    // This private method writes the k nearest Rooms to rm holding the
+    // content of field f into out.
+    void KNearest( const Coordinate rm,
+                   const size_t f,
+                   const size_t k,
+                   std::vector<NearestRoom>& out );
+
+    // This private method returns true if the Room holds the content of
+    // field f.
+    bool Holds( const RoomId id, const size_t f ) const;
+
+    // This private method writes the Rooms connected to the Room into out,
+    // and returns how many there are.
+    size_t Neighbours( const RoomId id, RoomId out[4] ) const;
+
+    // This private method computes field f from every source.
+    void Build( const size_t f );
+
+    // This private method lowers the distances of field f outward from
+    // the Room, whose distance has just been lowered.
+    void Lower( const size_t f, const RoomId start );
+
+    // This private method makes the Room a source of field f.
+    void AddSource( const size_t f, const RoomId id );
+
+    // This private method stops the Room being a source of field f, and
+    // recomputes the Rooms which were nearest to it.
+    void RemoveSource( const size_t f, const RoomId id );
+};
@@ -0,0 +1,53 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the VisitStamps and Neighbourhood structs,
+ * which hold the scratch memory and the result of
+ * Labyrinth::RoomsWithin().
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "labyrinth.hpp"
+
+// A Room has been visited by the current query if its stamp equals the
+// generation. Each query begins a new generation instead of clearing the
+// stamps, so a VisitStamps which is reused costs nothing per query once
+// it has grown to the size of the Labyrinth.
+// One VisitStamps may be shared by Labyrinths of different sizes, but not
+// by queries running at the same time.
+struct VisitStamps
+{
+  uint32_t generation = 0;
+  std::vector<uint32_t> stamps;  // Indexed by RoomId
+};
+
+// The Rooms are ordered by distance: ring d, the Rooms exactly d steps
+// away, is rooms[ring_starts[d]] up to rooms[ring_starts[d + 1]]. Ring 0 is
+// the starting Room. Rings which would be empty are not included.
+// The buffers are reused, so repeated queries into the same Neighbourhood
+// do not allocate once they have grown.
+struct Neighbourhood
+{
+  std::vector<RoomId> rooms;
+  std::vector<uint32_t> ring_starts;
+
+  // This method returns the number of rings.
+  size_t NumRings() const
+  {
+    return ring_starts.empty() ? 0 : ring_starts.size() - 1;
+  }
+
+  // This method returns the number of Rooms in ring d, or 0 if d is past
+  // the last ring.
+  size_t RingSize( const size_t d ) const
+  {
+    return d < NumRings() ? ring_starts[d + 1] - ring_starts[d] : 0;
+  }
+};
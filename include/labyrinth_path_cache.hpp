@@ -0,0 +1,151 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthPathCache class, which keeps
+ * recently solved paths of a Labyrinth so they are not recomputed.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth_listener.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_solver.hpp"
+#include "next_hop_table.hpp"
+
+// This class is a bounded cache of shortest paths through a single
+// Labyrinth, keyed by the source and destination Rooms. When the cache is
+// full, the least recently used path is evicted.
+//
+// The cache listens to its Labyrinth, and drops exactly the paths which
+// may have changed: when two Rooms are connected, a path is dropped if
+// either Room is reachable from the path's source, and when two Rooms are
+// disconnected, a path is dropped if it passes between them. Since removing
+// a connection only makes other paths longer, every other shortest path
+// stays shortest.
+//
+// Building a NextHopTable costs about as much as solving one path from
+// every Room, so once as many paths as there are Rooms have been solved
+// since the Labyrinth last changed, the cache builds one and reads the
+// paths which are not cached from it instead. The table is not repaired
+// as the Labyrinth changes; it is set aside until enough paths have been
+// solved again, and then rebuilt. Carving a maze with a cache attached
+// therefore costs no more than the cheap invalidation above, and a
+// Labyrinth queried heavily between changes spends at most twice what
+// the table alone would.
+//
+// The Labyrinth must outlive the cache.
+class LabyrinthPathCache : public LabyrinthListener
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    //   capacity is 0 (domain_error)
+    LabyrinthPathCache( const Labyrinth* const l, const size_t capacity );
+
+    // Destructor
+    // Stops listening to the Labyrinth.
+    ~LabyrinthPathCache();
+
+    LabyrinthPathCache( const LabyrinthPathCache& ) = delete;
+    LabyrinthPathCache& operator=( const LabyrinthPathCache& ) = delete;
+
+    // This method returns the Rooms on a shortest path from src to dst, as
+    // LabyrinthSolver::ShortestPath() does, solving it only if it is not
+    // already cached.
+    // The returned reference is valid until the cache is next used or
+    // changed.
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinth (domain_error)
+    const std::vector<Coordinate>& ShortestPath( const Coordinate src,
+                                                 const Coordinate dst );
+
+    // This method returns the number of paths currently cached.
+    size_t Size() const;
+
+    // This method returns the number of calls to ShortestPath() which were
+    // answered from the cache.
+    size_t Hits() const;
+
+    // This method returns the number of calls to ShortestPath() which had
+    // to solve the path.
+    size_t Misses() const;
+
+    // This method returns true if paths which are not cached are read from
+    // a NextHopTable, and false if they are solved.
+    bool UsesNextHopTable() const;
+
+    // This method drops the paths which may be changed by connecting rm_1
+    // and rm_2.
+    void RoomsConnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method drops the paths which pass between rm_1 and rm_2.
+    void RoomsDisconnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method drops every path.
+    void LabyrinthReset();
+
+  private:
+
+    // Entries are kept in a fixed array and linked in order of use, with
+    // the most recently used Entry at the head.
+    struct Entry
+    {
+      uint32_t key = 0;
+      std::vector<Coordinate> path;
+      std::vector<bool> component;  // Rooms reachable from the source, or
+                                    // once reachable since the Entry was
+                                    // solved
+      uint32_t prev = 0;
+      uint32_t next = 0;
+    };
+
+    const Labyrinth* const l_;
+    LabyrinthSolver solver_;  // Checks l_ before it is used below
+    const size_t x_size_;
+    const size_t table_misses_;  // Misses since a change before the table
+                                 // is built, or SIZE_MAX for none
+    std::unique_ptr<NextHopTable> table_;  // Null until first built
+    bool table_current_ = false;
+    size_t misses_since_change_ = 0;
+
+    std::vector<Entry> entries_;
+    std::unordered_map<uint32_t, uint32_t> index_;  // Key to Entry
+    std::vector<uint32_t> free_;                     // Unused Entries
+    uint32_t head_;
+    uint32_t tail_;
+    const uint32_t kNone_;
+
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+
+    // This private method returns the key of the path from src to dst.
+    uint32_t Key( const Coordinate src, const Coordinate dst ) const;
+
+    // This private method returns the index in the component of Entries
+    // of the given Room.
+    size_t RoomIndex( const Coordinate rm ) const;
+
+    // This private method removes the Entry from the order of use.
+    void Unlink( const uint32_t e );
+
+    // This private method makes the Entry the most recently used.
+    void LinkAtHead( const uint32_t e );
+
+    // This private method removes the Entry from the cache.
+    void Drop( const uint32_t e );
+
+    // This private method stops reading paths from the table until enough
+    // paths have been solved again.
+    void SetTableAside();
+};
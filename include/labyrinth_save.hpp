@@ -0,0 +1,121 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthSaver class, which saves
+ * Labyrinths to level files on a background thread, as well as functions
+ * to encode, decode, and load level files.
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "labyrinth_snapshot.hpp"
+#include "labyrinth.hpp"
+
+// Level file format (all values are single bytes unless stated otherwise):
+//   Magic number "LABY", then the format version
+//   x size, y size
+//   Spawn 1 x, spawn 1 y, spawn 2 x, spawn 2 y
+//   Flags: bit 0 is set if the exit is set, bit 1 if the treasure is set
+//   One 2-byte little-endian value per Room, indexed as (y * x_size + x):
+//     Bits 0-3:   Walls (north, east, south, west); set if the Wall exists
+//     Bits 4-6:   Exit Direction
+//     Bits 7-9:   Inhabitant
+//     Bits 10-11: Item
+// The size of a level file only depends on the size of the Labyrinth.
+
+// This function returns the size in bytes of the level file of a Labyrinth
+// with the given sizes.
+size_t EncodedSnapshotSize( const size_t x_size, const size_t y_size );
+
+// This function encodes s in the level file format into out.
+// The buffer of out is reused, so encoding into the same vector
+// repeatedly does not allocate.
+void EncodeSnapshot( const LabyrinthSnapshot& s,
+                     std::vector<unsigned char>& out );
+
+// This function decodes a level file of the given size into s.
+// An exception is thrown if:
+//   data is not a valid level file (runtime_error)
+void DecodeSnapshot( const unsigned char* const data,
+                     const size_t size,
+                     LabyrinthSnapshot& s );
+
+// This function reads the level file with the given name into s.
+// An exception is thrown if:
+//   The file cannot be read (runtime_error)
+//   The file is not a valid level file (runtime_error)
+void LoadSnapshot( const std::string& filename, LabyrinthSnapshot& s );
+
+// This class saves Labyrinths to level files without stalling the caller.
+//
+// The state of the Labyrinth is copied on the calling thread, and then
+// encoded, written with a single write and synced with a single fsync on a
+// background thread. Two snapshot buffers are kept, so that one save can be
+// snapshotted while the other is being written; a third save waits for the
+// oldest one to finish.
+class LabyrinthSaver
+{
+  public:
+
+    // Default constructor
+    // Starts the background thread.
+    LabyrinthSaver();
+
+    // Destructor
+    // Finishes all queued saves, then stops the background thread.
+    ~LabyrinthSaver();
+
+    LabyrinthSaver( const LabyrinthSaver& ) = delete;
+    LabyrinthSaver& operator=( const LabyrinthSaver& ) = delete;
+
+    // This method copies the state of l and queues it to be saved to the
+    // given file.
+    // The file is first written under filename + ".tmp" and renamed once it
+    // has been synced, so an interrupted save never leaves a partial file.
+    // The returned future becomes ready when the save is complete; get()
+    // rethrows any error from the background thread (runtime_error).
+    std::future<void> SaveAsync( const Labyrinth& l,
+                                 const std::string& filename );
+
+  private:
+
+    struct SaveJob
+    {
+      LabyrinthSnapshot snapshot;
+      std::vector<unsigned char> encoded;
+      std::string filename;
+      std::promise<void> done;
+      bool claimed = false;  // Being snapshotted into, queued, or written
+      bool queued = false;   // Ready for the background thread
+    };
+
+    static const size_t kNumJobs_ = 2;
+    SaveJob jobs_[kNumJobs_];
+    size_t next_job_ = 0;  // Next job to be snapshotted into
+
+    std::mutex mutex_;
+    std::condition_variable job_queued_;
+    std::condition_variable job_done_;
+    bool stopping_ = false;
+
+    std::thread worker_;
+
+    // This private method is run by the background thread, and saves the
+    // queued jobs in order until the LabyrinthSaver is destroyed.
+    void Run();
+
+    // This private method encodes and writes a single job to its file.
+    // An exception is thrown if:
+    //   The file cannot be written (runtime_error)
+    static void WriteJob( SaveJob& job );
+};
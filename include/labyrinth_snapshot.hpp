@@ -0,0 +1,33 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the implementation of a LabyrinthSnapshot
+ * struct, which holds a complete copy of the state of a Labyrinth so that
+ * it can be saved without holding up the game.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "coordinate.hpp"
+#include "room.hpp"
+
+// Rooms are stored in a single array, indexed as (y * x_size + x).
+// The Room buffer is reused between snapshots, so taking repeated snapshots
+// of Labyrinths of the same size does not allocate.
+struct LabyrinthSnapshot
+{
+  size_t x_size = 0;
+  size_t y_size = 0;
+
+  Coordinate spawn_1;
+  Coordinate spawn_2;
+  bool exit_set = false;
+  bool treasure_set = false;
+
+  std::vector<Room> rooms;
+};
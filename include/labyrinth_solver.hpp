@@ -0,0 +1,87 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthSolver class, which finds
+ * paths between Rooms of a Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+
+// This struct holds the working memory of LabyrinthSolver::CheapestPath(),
+// so that it can be reused between searches instead of being allocated for
+// every search. Its contents are only meaningful to LabyrinthSolver.
+struct DijkstraWorkspace
+{
+  std::vector<uint32_t> cost;
+  std::vector<uint32_t> parent;
+  std::vector<uint32_t> prev;     // Previous Room in the same bucket
+  std::vector<uint32_t> next;     // Next Room in the same bucket
+  std::vector<uint32_t> buckets;  // First Room in each bucket
+};
+
+// This class finds paths through a Labyrinth.
+// Paths only pass between connected Rooms; exits are not followed.
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class LabyrinthSolver
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    explicit LabyrinthSolver( const Labyrinth* const l );
+
+    // This method returns the Rooms on a shortest path from src to dst,
+    // including both src and dst.
+    // An empty path is returned if dst cannot be reached from src.
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinth (domain_error)
+    std::vector<Coordinate> ShortestPath( const Coordinate src,
+                                          const Coordinate dst ) const;
+
+    // This method returns the Rooms on a shortest path from src to dst, as
+    // above, and sets component to mark every Room reachable from src.
+    // component is indexed as (y * x_size + x).
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinth (domain_error)
+    std::vector<Coordinate> ShortestPath( const Coordinate src,
+                                          const Coordinate dst,
+                                          std::vector<bool>& component ) const;
+
+    // This method finds a cheapest path from src to dst, where entering a
+    // Room costs its weight (see Labyrinth::SetRoomWeight()).
+    // The Rooms on the path, including src and dst, are written to path and
+    // the total cost is returned. If dst cannot be reached from src, path is
+    // emptied and kUnreachable is returned.
+    // Nothing is allocated once ws and path have grown to the size of the
+    // Labyrinth, so both should be reused between searches.
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinth (domain_error)
+    uint32_t CheapestPath( const Coordinate src,
+                           const Coordinate dst,
+                           DijkstraWorkspace& ws,
+                           std::vector<Coordinate>& path ) const;
+
+    static const uint32_t kUnreachable = UINT32_MAX;
+
+  private:
+
+    const Labyrinth* const l_;
+
+    // CheapestPath() keeps Rooms in a bucket queue with one bucket per cost,
+    // modulo the number of buckets. Since no step costs more than the
+    // largest weight, the Rooms waiting in the queue never span more costs
+    // than there are buckets.
+    static const uint32_t kNumBuckets_ = 256;
+
+};
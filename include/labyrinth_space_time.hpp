@@ -0,0 +1,140 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the SpaceTimeSolver class, which finds paths
+ * through a Labyrinth that avoid moving Minotaurs, and the RoomTurnTable
+ * class which it uses to store (Room, turn) pairs.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+
+// This class is a set of (RoomId, turn) pairs, stored in a single array
+// with open addressing and linear probing.
+// Clear() keeps the array, so a table which is reused does not allocate
+// once it has grown to its working size.
+class RoomTurnTable
+{
+  public:
+
+    // Default constructor
+    RoomTurnTable();
+
+    // This method removes every pair.
+    void Clear();
+
+    // This method adds the given pair.
+    // Returns true if the pair was added, and false if it was already in
+    // the table.
+    bool Insert( const RoomId rm, const uint32_t turn );
+
+    // This method returns true if the given pair is in the table, and false
+    // otherwise.
+    bool Contains( const RoomId rm, const uint32_t turn ) const;
+
+    // This method returns the number of pairs in the table.
+    size_t Size() const;
+
+  private:
+
+    static const uint64_t kEmpty_ = UINT64_MAX;
+
+    std::vector<uint64_t> slots_;  // Size is always a power of 2
+    size_t size_ = 0;
+
+    // This private method returns the slot at which to start looking for
+    // the given key.
+    size_t Home( const uint64_t key ) const;
+
+    // This private method doubles the number of slots.
+    void Grow();
+};
+
+// This class finds paths through a Labyrinth for a player who must never
+// share a Room with a Minotaur, given where each Minotaur will be on each
+// turn.
+//
+// The search is an A* search over (Room, turn) states, where each turn the
+// player either moves to a connected Room or waits. Once every Minotaur
+// has finished its trajectory the Labyrinth no longer changes, so all turns
+// from then on share one state per Room; this, the exact distance to the
+// destination as the heuristic, and the turn limit keep the search small.
+//
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class SpaceTimeSolver
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    explicit SpaceTimeSolver( const Labyrinth* const l );
+
+    // This method sets the predicted Rooms of the Minotaurs.
+    // trajectories[m][t] is the Room of Minotaur m on turn t; each Minotaur
+    // stays in the last Room of its trajectory afterwards.
+    // An exception is thrown if:
+    //   A trajectory is empty (invalid_argument)
+    //   A Room is outside the Labyrinth (domain_error)
+    void SetTrajectories(
+      const std::vector< std::vector<Coordinate> >& trajectories );
+
+    // This method returns the Room of the player on each turn, beginning
+    // with src on turn 0, for a path which reaches dst as soon as possible
+    // without entering a Room on a turn that a Minotaur is in it, and
+    // without passing a Minotaur in a doorway.
+    // An empty path is returned if dst cannot be reached safely within
+    // max_turns turns.
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinth (domain_error)
+    std::vector<Coordinate> SafePath( const Coordinate src,
+                                      const Coordinate dst,
+                                      const uint32_t max_turns );
+
+  private:
+
+    const Labyrinth* const l_;
+    const size_t x_size_;
+    const size_t num_rooms_;
+
+    // Minotaur Rooms before horizon_ are in reserved_; from horizon_ on the
+    // Minotaurs stand still, in the Rooms marked in blocked_.
+    RoomTurnTable reserved_;
+    std::vector<bool> blocked_;
+    uint32_t horizon_ = 0;
+
+    // Search memory, reused between searches
+    struct Node
+    {
+      RoomId rm;
+      uint32_t turn;
+      uint32_t parent;
+    };
+    std::vector<Node> nodes_;
+    std::vector< std::pair<uint64_t, uint32_t> > open_;  // (Priority, Node)
+    RoomTurnTable closed_;
+    std::vector<uint32_t> distance_;  // Distance to dst ignoring Minotaurs
+    std::vector<RoomId> queue_;
+
+    // This private method returns true if a Minotaur will be in the Room on
+    // the given turn, and false otherwise.
+    bool IsReserved( const RoomId rm, const uint32_t turn ) const;
+
+    // This private method writes the Rooms connected to rm into out, and
+    // returns how many there are.
+    size_t ConnectedRooms( const RoomId rm, RoomId out[4] ) const;
+
+    // This private method fills distance_ with the number of moves from each
+    // Room to dst, ignoring Minotaurs.
+    void DistancesTo( const RoomId dst );
+};
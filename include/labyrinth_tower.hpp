@@ -0,0 +1,243 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthTower class, which stacks
+ * Labyrinth floors connected by stairs and pages them to and from a tower
+ * file, and the TowerSolver class which finds paths through it.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth_snapshot.hpp"
+#include "labyrinth.hpp"
+
+// Tower file format (all values are single bytes unless stated otherwise):
+//   Magic number "TOWR", then the format version
+//   x size, y size, then a reserved byte
+//   Number of floors (2-byte little-endian)
+//   One record per floor, from the bottom floor up, each made of:
+//     The floor as a level file (see labyrinth_save.hpp)
+//     One bit per Room, indexed as (y * x_size + x) from bit 0 of the first
+//       byte, set if there are stairs up to the floor above
+// Every record has the same size, so a floor can be read or written without
+// reading the rest of the file.
+
+// This struct is the location of a Room in a LabyrinthTower.
+struct TowerCoordinate
+{
+  size_t floor = 0;
+  Coordinate rm;
+
+  // Default constructor
+  TowerCoordinate()
+  {
+  }
+
+  // Parameterized constructor
+  TowerCoordinate( const size_t f, const Coordinate c ) :
+    floor(f),
+    rm(c)
+  {
+  }
+
+  // Operator overload for ==
+  bool operator==( const TowerCoordinate& c ) const
+  {
+    return floor == c.floor && rm == c.rm;
+  }
+};
+
+// This function creates a tower file with the given number of floors, each
+// of which is a Labyrinth of the given sizes with every Wall intact and no
+// stairs.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+//   An x or y size greater than the maximum is given (domain_error)
+//   The number of floors is 0 or greater than 65535 (invalid_argument)
+//   The file cannot be written (runtime_error)
+void CreateTowerFile( const std::string& filename,
+                      const size_t x_size,
+                      const size_t y_size,
+                      const size_t num_floors );
+
+// This class is a stack of Labyrinth floors of the same size, where stairs
+// in a Room lead to the same Room on the floor above.
+//
+// Only a limited number of floors are kept in memory at once. A floor is
+// read from the tower file when it is first used, and when too many floors
+// are in memory, the least recently used floor is written back to the file
+// (if it may have been changed) and its memory reused for the next floor.
+// Each floor in memory also keeps a copy of the stairs up of the floor
+// below it, so asking about stairs down never reads a second floor.
+class LabyrinthTower
+{
+  public:
+
+    // Parameterized constructor
+    // Opens an existing tower file.
+    // An exception is thrown if:
+    //   max_active_floors is 0 (invalid_argument)
+    //   The file cannot be opened (runtime_error)
+    //   The file is not a valid tower file (runtime_error)
+    LabyrinthTower( const std::string& filename,
+                    const size_t max_active_floors );
+
+    // Destructor
+    // Writes back every floor which may have been changed.
+    ~LabyrinthTower();
+
+    LabyrinthTower( const LabyrinthTower& ) = delete;
+    LabyrinthTower& operator=( const LabyrinthTower& ) = delete;
+
+    // This method returns the number of floors.
+    size_t NumFloors() const;
+
+    // This method returns the number of Rooms along the x-axis of a floor.
+    size_t GetXSize() const;
+
+    // This method returns the number of Rooms along the y-axis of a floor.
+    size_t GetYSize() const;
+
+    // This method returns the number of floors currently in memory.
+    size_t ActiveFloors() const;
+
+    // This method returns the number of times a floor has been read from
+    // the file.
+    size_t FloorReads() const;
+
+    // This method returns the given floor for changing, reading it from the
+    // file if it is not in memory.
+    // The reference is valid until another floor is read.
+    // An exception is thrown if:
+    //   The floor does not exist (domain_error)
+    //   The floor cannot be read or written back (runtime_error)
+    Labyrinth& Floor( const size_t floor );
+
+    // This method returns the given floor for reading, as Floor() does,
+    // without it being written back when it leaves memory.
+    const Labyrinth& ReadFloor( const size_t floor );
+
+    // This method creates stairs from the given Room up to the same Room on
+    // the floor above.
+    // An exception is thrown if:
+    //   The Room is outside the tower, or on the top floor (domain_error)
+    //   The floor cannot be read or written back (runtime_error)
+    void SetStairs( const TowerCoordinate rm );
+
+    // This method returns true if the Room has stairs up, and false
+    // otherwise.
+    // An exception is thrown if:
+    //   The Room is outside the tower (domain_error)
+    //   The floor cannot be read or written back (runtime_error)
+    bool HasStairsUp( const TowerCoordinate rm );
+
+    // This method returns true if the Room has stairs down, and false
+    // otherwise.
+    // An exception is thrown if:
+    //   The Room is outside the tower (domain_error)
+    //   The floor cannot be read or written back (runtime_error)
+    bool HasStairsDown( const TowerCoordinate rm );
+
+    // This method writes back every floor which may have been changed.
+    // An exception is thrown if:
+    //   The file cannot be written (runtime_error)
+    void Flush();
+
+    // This method displays a map of the given floor, followed by the Rooms
+    // with stairs up and down.
+    // An exception is thrown if:
+    //   The floor does not exist (domain_error)
+    //   The floor cannot be read or written back (runtime_error)
+    void DisplayFloor( const size_t floor );
+
+  private:
+
+    struct ActiveFloor
+    {
+      size_t floor = 0;
+      std::unique_ptr<Labyrinth> l;
+      std::vector<bool> stairs;       // Stairs up, indexed by RoomId
+      std::vector<bool> stairs_down;  // Stairs up of the floor below
+      bool dirty = false;        // May differ from the file
+      size_t last_used = 0;
+    };
+
+    const std::string filename_;
+    std::fstream file_;
+    size_t x_size_ = 0;
+    size_t y_size_ = 0;
+    size_t num_floors_ = 0;
+    size_t level_size_ = 0;   // Bytes of the level file in each record
+    size_t record_size_ = 0;
+
+    const size_t max_active_floors_;
+    std::vector<ActiveFloor> active_;
+    size_t clock_ = 0;
+    size_t floor_reads_ = 0;
+
+    // Buffers reused for reading and writing floors
+    LabyrinthSnapshot snapshot_;
+    std::vector<unsigned char> record_;
+
+    // This private method returns the given floor in memory, reading it
+    // and evicting another floor if necessary.
+    // An exception is thrown if:
+    //   The floor does not exist (domain_error)
+    //   The floor cannot be read or written back (runtime_error)
+    ActiveFloor& Activate( const size_t floor );
+
+    // This private method writes the floor to its record in the file.
+    // An exception is thrown if:
+    //   The file cannot be written (runtime_error)
+    void WriteBack( ActiveFloor& a );
+
+    // This private method returns the RoomId of the given Room.
+    // An exception is thrown if:
+    //   The Room is outside the tower (domain_error)
+    RoomId Id( const TowerCoordinate rm ) const;
+};
+
+// This class finds paths through a LabyrinthTower, where stairs connect a
+// Room to the same Room on the floor above.
+// Only the floors which the search reaches are read, and the search memory
+// grows with the number of Rooms searched rather than the height of the
+// tower.
+// t_ does not use a smart pointer because it is simply a pointer to the
+// related LabyrinthTower, not a heap allocation.
+class TowerSolver
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   t is null (invalid_argument)
+    explicit TowerSolver( LabyrinthTower* const t );
+
+    // This method returns the Rooms on a shortest path from src to dst,
+    // including both, where taking the stairs is one move.
+    // An empty path is returned if dst cannot be reached.
+    // An exception is thrown if:
+    //   src or dst is outside the tower (domain_error)
+    //   A floor cannot be read or written back (runtime_error)
+    std::vector<TowerCoordinate> ShortestPath( const TowerCoordinate src,
+                                               const TowerCoordinate dst );
+
+  private:
+
+    LabyrinthTower* const t_;
+
+    // Search memory, reused between searches
+    std::unordered_map<uint64_t, uint64_t> parent_;  // Room to previous Room
+    std::vector<uint64_t> queue_;
+};
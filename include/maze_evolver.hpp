@@ -0,0 +1,162 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the MazeEvolver class, which uses a genetic
+ * algorithm to search for the most difficult Labyrinth layouts.
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "labyrinth.hpp"
+
+// This class evolves a population of perfect mazes (every Room reachable by
+// exactly one path) toward the highest difficulty, where the difficulty of
+// a maze is the length of the path from the top left Room to the bottom
+// right Room plus the number of dead ends.
+//
+// A genome is the set of open walls, one byte per possible connection
+// between adjacent Rooms. Mutation opens one wall and closes another on
+// the loop this creates, and crossover stitches the left (or top) region
+// of one parent to the rest of the other and reconnects them, so every
+// genome always stays a spanning tree.
+//
+// Genomes live in a single arena allocated up front, holding the current
+// and the next generation, and fitness is evaluated on a set of worker
+// threads which live as long as the MazeEvolver; after construction, no
+// generation allocates.
+class MazeEvolver
+{
+  public:
+
+    // Parameterized constructor
+    // Creates a population of random mazes and evaluates it.
+    // num_threads includes the calling thread.
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    //   An x or y size greater than the maximum (20) is given
+    //     (domain_error)
+    //   population_size is less than 2 (invalid_argument)
+    //   num_threads is 0 (invalid_argument)
+    MazeEvolver( const size_t x_size,
+                 const size_t y_size,
+                 const size_t population_size,
+                 const size_t num_threads,
+                 const uint32_t seed );
+
+    // Destructor
+    // Stops the worker threads.
+    ~MazeEvolver();
+
+    MazeEvolver( const MazeEvolver& ) = delete;
+    MazeEvolver& operator=( const MazeEvolver& ) = delete;
+
+    // This method replaces the population with the next generation.
+    // The best maze is always carried over unchanged.
+    void Step();
+
+    // This method returns the number of generations so far.
+    size_t Generation() const;
+
+    // This method returns the difficulty of the best maze.
+    uint32_t BestFitness() const;
+
+    // This method returns a new Labyrinth with the layout of the best maze.
+    std::unique_ptr<Labyrinth> BestLabyrinth() const;
+
+  private:
+
+    // Working memory for evaluating and building genomes
+    struct Scratch
+    {
+      std::vector<uint32_t> distance;
+      std::vector<uint32_t> parent;
+      std::vector<uint32_t> queue;
+    };
+
+    const size_t x_size_;
+    const size_t y_size_;
+    const size_t num_rooms_;
+    const size_t num_edges_;
+    const size_t population_size_;
+
+    // Edge e connects Rooms edge_a_[e] and edge_b_[e], where a is north or
+    // west of b. Room r has room_degree_[r] possible edges, listed from
+    // room_edges_[r * 4].
+    std::vector<uint32_t> edge_a_;
+    std::vector<uint32_t> edge_b_;
+    std::vector<uint32_t> room_edges_;
+    std::vector<uint8_t> room_degree_;
+
+    // Both generations, population_size_ genomes each
+    std::vector<uint8_t> arena_;
+    size_t current_ = 0;  // 0 or 1, the generation in use
+    std::vector<uint32_t> fitness_;
+    size_t best_ = 0;
+    size_t generation_ = 0;
+
+    std::mt19937 rng_;
+    std::vector<uint32_t> edge_order_;  // For building genomes
+    std::vector<uint32_t> union_find_;
+    std::vector<Scratch> scratch_;      // One per thread
+
+    // Worker threads evaluate the genomes i where
+    // i % num_threads == worker number; the calling thread is worker 0.
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    size_t round_ = 0;
+    size_t remaining_ = 0;
+    bool stopping_ = false;
+
+    // This private method returns the genome with the given index in the
+    // given generation.
+    uint8_t* Genome( const size_t generation, const size_t i );
+    const uint8_t* Genome( const size_t generation, const size_t i ) const;
+
+    // This private method returns the difficulty of the genome.
+    uint32_t Evaluate( const uint8_t* const genome, Scratch& s ) const;
+
+    // This private method evaluates the current generation on all threads.
+    void EvaluateAll();
+
+    // This private method evaluates this thread's share of the current
+    // generation.
+    void EvaluateShare( const size_t worker );
+
+    // This private method is run by each worker thread.
+    void RunWorker( const size_t worker );
+
+    // This private method returns the index of the fitter of two random
+    // genomes in the current generation.
+    size_t Tournament();
+
+    // This private method fills child with a random spanning tree, using
+    // the edges chosen by the given parents first.
+    // Edges in the region before the cut are taken from parent_a, and edges
+    // in the region after it from parent_b.
+    void Stitch( const uint8_t* const parent_a,
+                 const uint8_t* const parent_b,
+                 const bool cut_x,
+                 const size_t cut,
+                 uint8_t* const child );
+
+    // This private method opens a random closed wall of the genome, and
+    // closes a random wall on the loop which that creates.
+    void Mutate( uint8_t* const genome );
+
+    // This private method returns the representative Room of the set which
+    // contains the given Room, in union_find_.
+    uint32_t Find( uint32_t rm );
+};
@@ -0,0 +1,201 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the NextHopTable class, which keeps the
+ * first step of a shortest path between every pair of Rooms in a small
+ * Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "coordinate.hpp"
+#include "labyrinth_listener.hpp"
+#include "labyrinth.hpp"
+
+// This class answers "which way is the next step from src towards dst"
+// for every pair of Rooms of a Labyrinth with a single lookup.
+//
+// For each destination, a breadth-first search from it gives every Room's
+// distance to it and the Direction of the neighbour one step closer. The
+// Directions are packed at 2 bits per pair, and the distances at 16 bits
+// per pair are kept to repair the table in place. The searches for
+// different destinations are independent, so the table may be built on
+// several worker threads, which live as long as the table.
+//
+// Unless it is built without repairs, the table listens to its Labyrinth
+// and repairs itself:
+//   Connecting two Rooms shortens exactly the paths which can use the new
+//     connection, found by comparing every pair with the distances to the
+//     two Rooms.
+//   Disconnecting two Rooms repeats the search only for the destinations
+//     to which one of the Rooms has no other way one step closer; for the
+//     other destinations no distance changes, and only the two Rooms' own
+//     steps are redirected.
+//
+// The table grows with the square of the number of Rooms, so it is limited
+// to kMaxRooms Rooms (about 360 KB at that size).
+//
+// The Labyrinth must outlive the table.
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class NextHopTable : public LabyrinthListener
+{
+  public:
+
+    // The largest number of Rooms for which a table can be built.
+    static const size_t kMaxRooms = 400;
+
+    // The distance between two Rooms which are not connected.
+    static const uint16_t kUnreachable = 0xFFFF;
+
+    // Parameterized constructor
+    // Builds the table, splitting the destinations between num_threads
+    // threads, including the calling thread.
+    // If repair is false, the table does not listen to the Labyrinth and
+    // is only correct until the Labyrinth next changes; its owner calls
+    // Rebuild() before using it again.
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    //   num_threads is 0 (invalid_argument)
+    //   The Labyrinth has more than kMaxRooms Rooms (domain_error)
+    explicit NextHopTable( const Labyrinth* const l,
+                           const size_t num_threads = 1,
+                           const bool repair = true );
+
+    // Destructor
+    // Stops the worker threads and stops listening to the Labyrinth.
+    ~NextHopTable();
+
+    NextHopTable( const NextHopTable& ) = delete;
+    NextHopTable& operator=( const NextHopTable& ) = delete;
+
+    // This method returns the Direction of the first step of a shortest
+    // path from src to dst, or Direction::kNone if src is dst or dst
+    // cannot be reached.
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinth (domain_error)
+    Direction NextHop( const Coordinate src, const Coordinate dst ) const;
+
+    // This method returns the number of steps from src to dst, or
+    // kUnreachable.
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinth (domain_error)
+    uint16_t Distance( const Coordinate src, const Coordinate dst ) const;
+
+    // This method writes the Rooms on a shortest path from src to dst,
+    // including both, into path by following the table; path is emptied
+    // if dst cannot be reached.
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinth (domain_error)
+    void ShortestPath( const Coordinate src,
+                       const Coordinate dst,
+                       std::vector<Coordinate>& path ) const;
+
+    // This method writes the Rooms on a shortest path from src to dst into
+    // path, as above, and sets component to mark every Room reachable from
+    // src, as LabyrinthSolver::ShortestPath() does.
+    // An exception is thrown if:
+    //   src or dst is outside the Labyrinth (domain_error)
+    void ShortestPath( const Coordinate src,
+                       const Coordinate dst,
+                       std::vector<Coordinate>& path,
+                       std::vector<bool>& component ) const;
+
+    // This method returns the number of destinations searched since the
+    // table was created, including the initial build.
+    size_t Searches() const;
+
+    // This method reads the walls of the Labyrinth again and searches from
+    // every destination.
+    void Rebuild();
+
+    // This method adds the paths which can use the new connection.
+    void RoomsConnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method repairs the paths which used the removed connection.
+    void RoomsDisconnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method rebuilds the table.
+    void LabyrinthReset();
+
+  private:
+
+    const Labyrinth* const l_;
+    const size_t x_size_;
+    const size_t num_rooms_;
+    const bool repair_;
+    const size_t row_bytes_;  // Bytes of hops_ per destination
+
+    std::vector<unsigned char> masks_;  // Open Directions, by RoomId
+
+    // Indexed by destination, then source
+    std::vector<uint16_t> distances_;
+    std::vector<unsigned char> hops_;  // 2 bits per source: 0 north, 1
+                                       // east, 2 south, 3 west
+
+    size_t searches_ = 0;
+
+    // Scratch space for repairs, by RoomId
+    std::vector<uint16_t> distance_1_;
+    std::vector<uint16_t> distance_2_;
+    std::vector<unsigned char> hop_1_;
+    std::vector<unsigned char> hop_2_;
+    std::vector<RoomId> queue_;
+    std::vector<RoomId> stale_;
+
+    // Worker w searches from band w of rows_per_band_ destinations; the
+    // calling thread is worker 0.
+    const size_t rows_per_band_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    size_t round_ = 0;
+    size_t remaining_ = 0;
+    bool stopping_ = false;
+
+    // This private method reads the walls of every Room and searches from
+    // every destination.
+    void Build();
+
+    // This private method searches from the band of destinations of the
+    // given worker, using queue as scratch space.
+    void SearchBand( const size_t worker, std::vector<RoomId>& queue );
+
+    // This private method is run by each worker thread.
+    void RunWorker( const size_t worker );
+
+    // This private method fills the distances and hops to dst.
+    void Search( const RoomId dst, std::vector<RoomId>& queue );
+
+    // This private method returns the hop from src towards dst.
+    unsigned char Hop( const RoomId dst, const RoomId src ) const;
+
+    // This private method sets the hop from src towards dst.
+    void SetHop( const RoomId dst, const RoomId src, const unsigned char h );
+
+    // This private method returns the neighbour of the Room in the
+    // direction of the hop.
+    RoomId Step( const RoomId id, const unsigned char h ) const;
+
+    // This private method points the hops of rm towards dst, for every
+    // destination whose hop crossed to gone, at another neighbour one step
+    // closer.
+    void Redirect( const RoomId rm, const RoomId gone );
+
+    // This private method returns the RoomId of the Room, or throws if it
+    // is outside the Labyrinth.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    RoomId Id( const Coordinate rm, const char* const message ) const;
+};
@@ -0,0 +1,172 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the OutputSink interface, which receives
+ * rendered output such as a LabyrinthMap, and its implementations.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <sys/uio.h>
+
+// This struct is a run of bytes to be written.
+struct OutputSegment
+{
+  const char* data;
+  size_t size;
+};
+
+// This class is a template for destinations of rendered output.
+// Subclasses must implement Write(), and may override WriteSegments() to
+// write several segments at once.
+class OutputSink
+{
+  public:
+
+    // Destructor
+    // Prevents error messages about non-virtual destructors
+    virtual ~OutputSink()
+    {
+    }
+
+    // This method writes the given bytes.
+    // An exception is thrown if:
+    //   The bytes cannot be written (runtime_error)
+    virtual void Write( const char* const data, const size_t size ) = 0;
+
+    // This method writes the given segments in order, as Write() would for
+    // each of them.
+    // An exception is thrown if:
+    //   The bytes cannot be written (runtime_error)
+    virtual void WriteSegments( const OutputSegment* const segments,
+                                const size_t count );
+};
+
+// This class collects output in a buffer which grows as needed.
+class BufferSink : public OutputSink
+{
+  public:
+
+    // This method appends the given bytes to the buffer.
+    void Write( const char* const data, const size_t size );
+
+    // This method returns everything written since the last Clear().
+    const std::string& Contents() const;
+
+    // This method empties the buffer, keeping its memory for reuse.
+    void Clear();
+
+  private:
+
+    std::string buffer_;
+};
+
+// This class writes output to a C stream.
+// f_ does not use a smart pointer because the stream is owned by the
+// caller, and is not closed by this class.
+class FileSink : public OutputSink
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   f is null (invalid_argument)
+    explicit FileSink( FILE* const f );
+
+    // This method writes the given bytes to the stream.
+    // An exception is thrown if:
+    //   The bytes cannot be written (runtime_error)
+    void Write( const char* const data, const size_t size );
+
+  private:
+
+    FILE* const f_;
+};
+
+// This class writes output to a file descriptor, such as a socket or a
+// pipe, without buffering. Several segments are written with one writev()
+// call where possible.
+// The file descriptor is owned by the caller, and is not closed by this
+// class.
+class FdSink : public OutputSink
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   fd is negative (invalid_argument)
+    explicit FdSink( const int fd );
+
+    // This method writes the given bytes to the file descriptor.
+    // An exception is thrown if:
+    //   The bytes cannot be written (runtime_error)
+    void Write( const char* const data, const size_t size );
+
+    // This method writes the given segments in order with writev(),
+    // continuing after partial writes and interruptions.
+    // An exception is thrown if:
+    //   The bytes cannot be written (runtime_error)
+    void WriteSegments( const OutputSegment* const segments,
+                        const size_t count );
+
+  private:
+
+    const int fd_;
+    std::vector<iovec> iov_;  // Reused between calls
+};
+
+// This class discards output, counting the bytes, for benchmarks.
+class NullSink : public OutputSink
+{
+  public:
+
+    // This method discards the given bytes.
+    void Write( const char* const data, const size_t size );
+
+    // This method discards the given segments without visiting the bytes.
+    void WriteSegments( const OutputSegment* const segments,
+                        const size_t count );
+
+    // This method returns the number of bytes discarded.
+    size_t Bytes() const;
+
+  private:
+
+    size_t bytes_ = 0;
+};
+
+// This class writes output to a C++ stream, such as std::cout.
+// os_ does not use a smart pointer because the stream is owned by the
+// caller.
+class StreamSink : public OutputSink
+{
+  public:
+
+    // Parameterized constructor
+    explicit StreamSink( std::ostream& os );
+
+    // This method writes the given bytes to the stream.
+    // An exception is thrown if:
+    //   The bytes cannot be written (runtime_error)
+    void Write( const char* const data, const size_t size );
+
+    // This method writes the given segments to the stream, then flushes
+    // it.
+    // An exception is thrown if:
+    //   The bytes cannot be written (runtime_error)
+    void WriteSegments( const OutputSegment* const segments,
+                        const size_t count );
+
+  private:
+
+    std::ostream& os_;
+};
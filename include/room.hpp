@@ -11,6 +11,7 @@
 #pragma once
 
 #include "room_properties.hpp"
+#include "status.hpp"
 
 class Room
 {
@@ -49,6 +50,14 @@ class Room
     //   The Wall has already been removed (logic_error)
     void BreakWall( const Direction d );
 
+    // This method restores the Wall in the given direction, so that the
+    // Room is no longer connected to another.
+    // An exception is thrown if:
+    //   Direction d is null (i.e. Direction::kNone) (invalid_argument)
+    //   Direction d has the exit (logic_error)
+    //   The Wall is already intact (logic_error)
+    void BuildWall( const Direction d );
+
     // This method creates an exit in the given direction. The Wall
     // should be intact (BreakWall() not called on it beforehand).
     // An exception is thrown if:
@@ -62,6 +71,28 @@ class Room
     //   Direction d is kNone (invalid_argument)
     RoomBorder DirectionCheck( const Direction d ) const;
 
+    // This method removes the Wall in the given direction as BreakWall()
+    // does, returning the error instead of throwing it.
+    Status TryBreakWall( const Direction d );
+
+    // This method restores the Wall in the given direction as BuildWall()
+    // does, returning the error instead of throwing it.
+    Status TryBuildWall( const Direction d );
+
+    // This method creates an exit in the given direction as CreateExit()
+    // does, returning the error instead of throwing it.
+    Status TryCreateExit( const Direction d );
+
+    // This method returns the type of RoomBorder in the given direction as
+    // DirectionCheck() does, returning the error instead of throwing it.
+    Expected<RoomBorder> TryDirectionCheck( const Direction d ) const;
+
+    // This method returns the Directions which lead to another Room, as a
+    // mask with bit 0 set for north, bit 1 for east, bit 2 for south, and
+    // bit 3 for west.
+    // The exit does not lead to another Room.
+    unsigned char OpenMask() const;
+
   private:
     // The exit direction does not count as a wall.
     Inhabitant dark_thing_ = Inhabitant::kNone;
@@ -0,0 +1,135 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the ScentField class, which spreads the
+ * scent of a player through the open walls of a Labyrinth so that
+ * Minotaurs can hunt by it.
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth_listener.hpp"
+#include "labyrinth.hpp"
+
+// This class holds a scent value for every Room of a Labyrinth, as a
+// fixed-point number with 8 integer and 8 fractional bits.
+//
+// On each Update(), every Room moves an eighth of the difference between
+// itself and each connected Room toward that Room, and then a fraction of
+// the result decays away. Walls stop the scent; exits are walls here.
+//
+// The field and the wall masks are stored with a border of empty Rooms
+// around the Labyrinth, and a wall is a mask of 0 rather than a branch, so
+// each row is a straight-line stencil that the compiler vectorizes. Rows
+// may also be split into bands which are updated on a set of worker
+// threads that live as long as the field, so a tick only wakes them. Even
+// so, waking a thread costs more than updating a few thousand Rooms, so a
+// field as small as a Labyrinth allows is best left to one thread.
+//
+// The field listens to its Labyrinth to keep its wall masks up to date.
+// The Labyrinth must outlive the field.
+class ScentField : public LabyrinthListener
+{
+  public:
+
+    // Parameterized constructor
+    // Every Room starts with no scent. The rows are split into num_threads
+    // bands, each updated on its own thread; num_threads includes the
+    // calling thread.
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    //   num_threads is 0 (invalid_argument)
+    explicit ScentField( const Labyrinth* const l,
+                         const size_t num_threads = 1 );
+
+    // Destructor
+    // Stops the worker threads and stops listening to the Labyrinth.
+    ~ScentField();
+
+    ScentField( const ScentField& ) = delete;
+    ScentField& operator=( const ScentField& ) = delete;
+
+    // This method sets the fraction of the scent, out of 256, which decays
+    // away on every Update(). The default is 16.
+    void SetDecay( const uint8_t decay );
+
+    // This method raises the scent of the given Room to at least the given
+    // strength.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    void Emit( const Coordinate rm, const uint16_t strength );
+
+    // This method returns the scent of the given Room.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    uint16_t ScentAt( const Coordinate rm ) const;
+
+    // This method advances the field by one tick.
+    void Update();
+
+    // This method re-reads the walls on either side of the two Rooms.
+    void RoomsConnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method re-reads the walls on either side of the two Rooms.
+    void RoomsDisconnected( const Coordinate rm_1, const Coordinate rm_2 );
+
+    // This method re-reads every wall of the Labyrinth.
+    void LabyrinthReset();
+
+  private:
+
+    const Labyrinth* const l_;
+    const size_t x_size_;
+    const size_t y_size_;
+    const size_t stride_;  // Row length including the border
+
+    uint16_t decay_ = 16;
+
+    // Padded arrays, indexed as ((y + 1) * stride_ + (x + 1))
+    std::vector<uint16_t> scent_;
+    std::vector<uint16_t> next_;
+    std::vector<uint16_t> open_north_;  // 0xFFFF if open, otherwise 0
+    std::vector<uint16_t> open_east_;
+    std::vector<uint16_t> open_south_;
+    std::vector<uint16_t> open_west_;
+
+    // Worker w updates band w of rows_per_band_ rows; the calling thread is
+    // worker 0.
+    const size_t rows_per_band_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    size_t round_ = 0;
+    size_t remaining_ = 0;
+    bool stopping_ = false;
+
+    // This private method returns the index of the given Room in the
+    // padded arrays.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    size_t Index( const Coordinate rm ) const;
+
+    // This private method re-reads the walls of the given Room.
+    void ReadWalls( const Coordinate rm );
+
+    // This private method updates the Labyrinth rows [y_begin, y_end) from
+    // scent_ into next_.
+    void UpdateRows( const size_t y_begin, const size_t y_end );
+
+    // This private method updates the band of rows of the given worker.
+    void UpdateBand( const size_t worker );
+
+    // This private method is run by each worker thread.
+    void RunWorker( const size_t worker );
+};
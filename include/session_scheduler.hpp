@@ -0,0 +1,328 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the SessionScheduler class, which runs
+ * many game sessions on one thread, waking each when its player's input
+ * arrives or its timer expires, and the GameSession interface which it
+ * drives.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sys/epoll.h>
+
+// This struct is what a GameSession waits for before it is resumed.
+struct Await
+{
+  enum class Kind : uint8_t
+  {
+    kInput,         // Input from the session's file descriptor
+    kTimer,         // The timeout
+    kInputOrTimer,  // Whichever comes first
+    kDone,          // Nothing; the session is destroyed
+  };
+
+  Kind kind;
+  std::chrono::milliseconds timeout;
+
+  // This function returns an Await for input.
+  static Await Input()
+  {
+    return Await{ Kind::kInput, std::chrono::milliseconds(0) };
+  }
+
+  // This function returns an Await for the timeout.
+  static Await Timer( const std::chrono::milliseconds timeout )
+  {
+    return Await{ Kind::kTimer, timeout };
+  }
+
+  // This function returns an Await for input or the timeout, whichever
+  // comes first.
+  static Await InputOrTimer( const std::chrono::milliseconds timeout )
+  {
+    return Await{ Kind::kInputOrTimer, timeout };
+  }
+
+  // This function returns an Await which ends the session.
+  static Await Done()
+  {
+    return Await{ Kind::kDone, std::chrono::milliseconds(0) };
+  }
+};
+
+// This enum is why a GameSession was resumed.
+enum class Wake : uint8_t
+{
+  kStart,   // The session was just spawned
+  kInput,   // Input arrived
+  kTimer,   // The timeout passed
+  kClosed,  // The input ended, or could not be read
+};
+
+// This class is a template for the game sessions run by a
+// SessionScheduler.
+//
+// A session is a coroutine written as a state machine: Resume() applies
+// whatever the wake-up allows (e.g. a turn to its Labyrinth), keeps the
+// state it needs in members, and returns what to wait for next. It must
+// not block.
+//
+// A session without input which waits only for input is ended, and a
+// session whose Resume() throws is ended before the exception is passed
+// on; the other sessions woken with it are woken again by the next
+// RunOnce().
+class GameSession
+{
+  public:
+
+    // Destructor
+    // Prevents error messages about non-virtual destructors
+    virtual ~GameSession()
+    {
+    }
+
+    // This method continues the session after a wake-up, and returns what
+    // it waits for next.
+    // For Wake::kInput, input holds the bytes read, which are only valid
+    // during the call.
+    virtual Await Resume( const Wake why,
+                          const char* const input,
+                          const size_t size ) = 0;
+};
+
+// This class runs game sessions on the calling thread.
+//
+// Sessions are constructed in frames of kFrameSize bytes from a pool
+// allocated by the constructor, along with a timer queue holding at most
+// one timer per session, so spawning and ending sessions does not
+// allocate. A session's timer is moved in place whenever the session waits
+// again, rather than a new one being queued. An idle session costs its
+// frame plus BytesPerSession() - kFrameSize bytes of bookkeeping, plus
+// whatever it refers to, such as its Labyrinth.
+//
+// The scheduler sleeps in epoll_wait() until an input arrives or the
+// nearest timer expires, so idle sessions use no CPU. Input is read into a
+// buffer shared by every session, so sessions keep no input buffer.
+class SessionScheduler
+{
+  public:
+
+    // The size of a session frame; larger sessions cannot be spawned.
+    static const size_t kFrameSize = 256;
+
+    // Parameterized constructor
+    // Allocates frames for the given number of sessions.
+    // An exception is thrown if:
+    //   capacity is 0 (invalid_argument)
+    //   The epoll instance cannot be created (runtime_error)
+    explicit SessionScheduler( const size_t capacity );
+
+    // Destructor
+    // Destroys the remaining sessions, without resuming them.
+    ~SessionScheduler();
+
+    SessionScheduler( const SessionScheduler& ) = delete;
+    SessionScheduler& operator=( const SessionScheduler& ) = delete;
+
+    // This method constructs a session of type S (a GameSession) with the
+    // given arguments in a free frame, and starts it by resuming it with
+    // Wake::kStart. Input is read from fd, which is owned by the caller, or
+    // -1 for a session which only waits for timers.
+    // Returns false if every frame is in use.
+    // An exception is thrown if:
+    //   fd is less than -1 (invalid_argument)
+    //   fd cannot be watched (runtime_error)
+    template <typename S, typename... Args>
+    bool Spawn( const int fd, Args&&... args );
+
+    // This method waits up to max_wait for inputs and timers, resumes the
+    // sessions they wake, and returns how many were resumed. If a session
+    // throws, the sessions whose input arrived with its input are woken by
+    // the next call instead.
+    // An exception is thrown if:
+    //   epoll_wait() fails (runtime_error)
+    //   A session's Resume() throws (the same exception)
+    //   A session's file descriptor cannot be watched again (runtime_error)
+    size_t RunOnce( const std::chrono::milliseconds max_wait );
+
+    // This method resumes sessions until every session has ended.
+    // An exception is thrown if:
+    //   epoll_wait() fails (runtime_error)
+    //   A session's Resume() throws (the same exception)
+    //   A session's file descriptor cannot be watched again (runtime_error)
+    void Run();
+
+    // This method returns the number of running sessions.
+    size_t Sessions() const;
+
+    // This method returns the number of times a session was resumed.
+    size_t Resumes() const;
+
+    // This method returns the number of pending timers, which is at most
+    // the number of running sessions.
+    size_t Timers() const;
+
+    // This method returns the bytes used by the scheduler for each idle
+    // session, including its frame.
+    static size_t BytesPerSession();
+
+  private:
+
+    // The bookkeeping of a frame
+    struct Slot
+    {
+      GameSession* session = nullptr;  // Null while the frame is free
+      int fd = -1;
+      Await::Kind waiting = Await::Kind::kDone;
+      uint32_t generation = 0;  // Changes whenever the session is resumed
+      uint32_t next_free = 0;
+      uint32_t timer = kNoSlot;  // Index of its Timer in timers_, if any
+    };
+
+    // The pending timeout of a Slot
+    struct Timer
+    {
+      int64_t deadline;  // Nanoseconds since start_
+      uint32_t slot;
+    };
+
+    typedef std::aligned_storage<kFrameSize,
+                                 alignof(std::max_align_t)>::type Frame;
+
+    static const size_t kMaxEvents = 64;
+    static const uint32_t kNoSlot = UINT32_MAX;
+
+    const std::chrono::steady_clock::time_point start_;
+    std::vector<Frame> frames_;
+    std::vector<Slot> slots_;
+    uint32_t free_;
+    size_t sessions_ = 0;
+    size_t resumes_ = 0;
+
+    std::vector<Timer> timers_;  // A min-heap by deadline, at most one
+                                 // Timer per Slot
+    int epoll_fd_;
+    epoll_event events_[kMaxEvents];
+    char input_[512];
+
+    // This private method returns a free Slot, or kNoSlot.
+    uint32_t Allocate();
+
+    // This private method registers the constructed session of the Slot,
+    // and starts it.
+    // An exception is thrown if:
+    //   fd cannot be watched (runtime_error)
+    void Start( const uint32_t slot, GameSession* const session,
+                const int fd );
+
+    // This private method returns true if the event was armed before its
+    // session was last resumed (or its Slot reused), or its session no
+    // longer waits for input.
+    bool Stale( const epoll_event& e ) const;
+
+    // This private method watches the file descriptors of events first to
+    // ready - 1 of events_ again, for the sessions which still wait for
+    // them, so that they are reported by the next wait.
+    void RearmEvents( const int first, const int ready );
+
+    // This private method returns the Slot to the free list.
+    void Release( const uint32_t slot );
+
+    // This private method resumes the session of the Slot, and waits for
+    // what it returns.
+    // An exception is thrown if:
+    //   The file descriptor cannot be watched again (runtime_error)
+    void Step( const uint32_t slot,
+               const Wake why,
+               const char* const input,
+               const size_t size );
+
+    // This private method watches the file descriptor of the Slot for the
+    // next input, which wakes the session once.
+    // An exception is thrown if:
+    //   The file descriptor cannot be watched (runtime_error), after the
+    //     session is ended
+    void Arm( const uint32_t slot );
+
+    // This private method destroys the session of the Slot.
+    void Finish( const uint32_t slot );
+
+    // This private method sets the deadline of the Timer of the Slot,
+    // adding the Timer if the Slot has none.
+    void SetTimer( const uint32_t slot, const int64_t deadline );
+
+    // This private method removes the Timer of the Slot, if it has one.
+    void CancelTimer( const uint32_t slot );
+
+    // This private method moves the Timer at index i of timers_ towards
+    // the front until its parent expires no later than it does.
+    void SiftUp( size_t i );
+
+    // This private method moves the Timer at index i of timers_ towards
+    // the back until neither of its children expires before it does.
+    void SiftDown( size_t i );
+
+    // This private method stores the Timer at index i of timers_, and
+    // records the index in its Slot.
+    void PlaceTimer( const size_t i, const Timer& t );
+
+    // This private method returns the nanoseconds since start_.
+    int64_t Now() const;
+};
+
+// This method constructs a session of type S (a GameSession) with the
+// given arguments in a free frame, and starts it by resuming it with
+// Wake::kStart. Input is read from fd, which is owned by the caller, or
+// -1 for a session which only waits for timers.
+// Returns false if every frame is in use.
+// An exception is thrown if:
+//   fd is less than -1 (invalid_argument)
+//   fd cannot be watched (runtime_error)
+template <typename S, typename... Args>
+bool SessionScheduler::Spawn( const int fd, Args&&... args )
+{
+  static_assert( std::is_base_of<GameSession, S>::value,
+                 "Sessions must be GameSessions." );
+  static_assert( sizeof(S) <= kFrameSize,
+                 "The session does not fit in a frame." );
+  static_assert( alignof(S) <= alignof(std::max_align_t),
+                 "The session is over-aligned for a frame." );
+
+  if( fd < -1 )
+  {
+    throw std::invalid_argument( "Error: Spawn() was given an invalid "\
+      "file descriptor.\n" );
+  }
+
+  const uint32_t slot = Allocate();
+  if( slot == kNoSlot )
+  {
+    return false;
+  }
+
+  S* session = nullptr;
+  try
+  {
+    session = new( &frames_[slot] ) S( std::forward<Args>(args)... );
+  }
+  catch( ... )
+  {
+    Release( slot );
+    throw;
+  }
+  Start( slot, session, fd );
+  return true;
+}
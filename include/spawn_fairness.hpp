@@ -0,0 +1,115 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the SpawnFairness class, which measures
+ * whether the two spawns of a Labyrinth give both players an equal start,
+ * and finds the most balanced pair of spawns.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+
+// The distances, in steps, which decide whether two spawns are fair.
+// Index 0 is measured from the first spawn and index 1 from the second.
+// A distance is kUnreachable if there is no path, including when the
+// Labyrinth has no Treasure, exit or live Minotaur.
+struct SpawnReport
+{
+  static const uint32_t kUnreachable = UINT32_MAX;
+
+  uint32_t between = kUnreachable;  // From one spawn to the other
+  uint32_t treasure[2] = { kUnreachable, kUnreachable };
+  uint32_t exit[2] = { kUnreachable, kUnreachable };
+  uint32_t minotaur[2] = { kUnreachable, kUnreachable };  // The nearest
+                                                          // live Minotaur
+
+  // The sum of the differences between the spawns' distances. A target
+  // which neither spawn can reach adds nothing, and one which only a
+  // single spawn can reach makes the imbalance kUnreachable.
+  uint32_t imbalance = 0;
+};
+
+// This class compares the two spawns of a Labyrinth by their distances to
+// the Treasure, the exit, and the nearest live Minotaur.
+//
+// Both spawns are measured by a single breadth-first search which expands
+// them in turn, level by level, over a copy of the walls read once per
+// call. The same search from the Treasure and the exit, with a search
+// from every live Minotaur, gives the distances of every Room at once, so
+// the most balanced pair of Rooms can be found by comparing them.
+//
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class SpawnFairness
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    explicit SpawnFairness( const Labyrinth* const l );
+
+    // This method measures the current spawns of the Labyrinth.
+    SpawnReport Evaluate();
+
+    // This method measures the given pair of spawns.
+    // An exception is thrown if:
+    //   One or both Rooms are outside the Labyrinth (domain_error)
+    SpawnReport Evaluate( const Coordinate spawn_1, const Coordinate spawn_2 );
+
+    // This method finds the pair of Rooms, at least min_separation steps
+    // apart in both x and y combined (so at least as far through the
+    // Labyrinth), with the least imbalance, and returns false if no pair
+    // can reach the Treasure and the exit. Ties go to the pair furthest
+    // apart. Rooms holding a live Minotaur are not considered.
+    bool FindBalancedSpawns( const size_t min_separation,
+                             Coordinate& spawn_1,
+                             Coordinate& spawn_2 );
+
+  private:
+
+    static const uint16_t kUnreached = 0xFFFF;
+    static const RoomId kNoRoom = UINT32_MAX;
+
+    const Labyrinth* const l_;
+    const size_t x_size_;
+    const size_t num_rooms_;
+
+    // Read from the Labyrinth by Scan()
+    std::vector<unsigned char> masks_;
+    RoomId treasure_ = kNoRoom;
+    RoomId exit_ = kNoRoom;
+    std::vector<RoomId> minotaurs_;
+
+    // Distance fields, indexed by RoomId
+    std::vector<uint16_t> distance_[2];
+    std::vector<uint16_t> minotaur_distance_;
+
+    std::vector<uint32_t> queue_;
+    std::vector<RoomId> candidates_;
+
+    // This private method reads the walls of every Room, and finds the
+    // Treasure, the exit and the live Minotaurs.
+    void Scan();
+
+    // This private method fills distance_[0] from a and distance_[1] from b
+    // with one search which alternates between them. A source of kNoRoom
+    // leaves its field unreached.
+    void PairedSearch( const RoomId a, const RoomId b );
+
+    // This private method fills minotaur_distance_ from every live
+    // Minotaur.
+    void MinotaurSearch();
+
+    // This private method returns the imbalance of two Rooms by the
+    // distances of the Treasure, exit and Minotaur fields.
+    uint32_t Imbalance( const RoomId a, const RoomId b ) const;
+};
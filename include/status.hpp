@@ -0,0 +1,162 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the Status and Expected classes, which
+ * return errors as values, and the functions which turn them into
+ * exceptions for the methods which throw.
+ *
+ * Room, Labyrinth and LabyrinthMap report every error through these: the
+ * Try methods return them, and the methods which throw raise them with
+ * RaiseError(). If LABYRINTH_NO_EXCEPTIONS is defined (which it is when
+ * compiling with -fno-exceptions), RaiseError() prints the message and
+ * aborts instead, so code which must recover from errors uses the Try
+ * methods.
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+#if !defined(LABYRINTH_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && \
+    !defined(__EXCEPTIONS)
+#define LABYRINTH_NO_EXCEPTIONS
+#endif
+
+// This enum is the kind of an error, matching the exception which the
+// throwing methods raise for it.
+enum class ErrorCode
+{
+  kOk,
+  kInvalidArgument,  // invalid_argument
+  kDomainError,      // domain_error
+  kLogicError,       // logic_error
+  kRuntimeError,     // runtime_error
+};
+
+// This class is the result of an operation which returns no value: either
+// success, or an error with a message.
+// Messages are string literals, so a Status is two words and is never
+// allocated.
+class Status
+{
+  public:
+
+    // Default constructor
+    // Creates a successful Status.
+    Status()
+    {
+    }
+
+    // Parameterized constructor
+    // Creates an error with the given message, which must outlive the
+    // Status (e.g. a string literal).
+    Status( const ErrorCode code, const char* const message ) :
+      code_(code),
+      message_(message)
+    {
+    }
+
+    // This method returns true if the operation succeeded.
+    bool IsOk() const
+    {
+      return code_ == ErrorCode::kOk;
+    }
+
+    // This method returns the kind of error, or ErrorCode::kOk.
+    ErrorCode Code() const
+    {
+      return code_;
+    }
+
+    // This method returns the message of the error, or an empty string.
+    const char* Message() const
+    {
+      return message_;
+    }
+
+  private:
+
+    ErrorCode code_ = ErrorCode::kOk;
+    const char* message_ = "";
+};
+
+// This class is the result of an operation which returns a value: either
+// the value, or the Status of the error.
+// T must be default constructible.
+template <typename T>
+class Expected
+{
+  public:
+
+    // Parameterized constructor
+    // Holds the given value.
+    Expected( const T& value ) :
+      value_(value)
+    {
+    }
+
+    // Parameterized constructor
+    // Holds the given error, which must not be a successful Status.
+    Expected( const Status& error ) :
+      error_(error)
+    {
+    }
+
+    // This method returns true if a value is held rather than an error.
+    bool HasValue() const
+    {
+      return error_.IsOk();
+    }
+
+    // This method returns the value, which is only meaningful if
+    // HasValue() is true.
+    const T& Value() const
+    {
+      return value_;
+    }
+
+    // This method returns the error, or a successful Status if a value
+    // is held.
+    const Status& Error() const
+    {
+      return error_;
+    }
+
+  private:
+
+    T value_ = T();
+    Status error_;
+};
+
+// This function raises the error as the exception matching its ErrorCode,
+// or prints it and aborts if LABYRINTH_NO_EXCEPTIONS is defined.
+// A successful Status is raised as a logic_error.
+[[noreturn]] void RaiseError( const Status& s );
+
+// This function raises the error with the given message, for messages
+// which are built at run time.
+[[noreturn]] void RaiseError( const ErrorCode code,
+                              const std::string& message );
+
+// This function raises s if it is an error.
+inline void RaiseIfError( const Status& s )
+{
+  if( !s.IsOk() )
+  {
+    RaiseError( s );
+  }
+}
+
+// This function returns the value of e, or raises its error.
+template <typename T>
+T ValueOrRaise( const Expected<T>& e )
+{
+  if( !e.HasValue() )
+  {
+    RaiseError( e.Error() );
+  }
+  return e.Value();
+}
@@ -0,0 +1,136 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the TerminalEventLoop class, which reads
+ * keys from a terminal without blocking the rendering of frames, and the
+ * TerminalHandler interface which it drives.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <termios.h>
+
+// This enum is a key read from the terminal.
+enum class Key
+{
+  kUp,
+  kDown,
+  kLeft,
+  kRight,
+  kEnter,
+  kEscape,
+  kInterrupt,  // Ctrl-C, which also stops the loop
+  kCharacter,  // Any other byte, given in KeyEvent::c
+};
+
+// This struct is a key read from the terminal.
+struct KeyEvent
+{
+  Key key;
+  char c;  // The byte read, for Key::kCharacter
+};
+
+// This class is a template for the game sessions driven by a
+// TerminalEventLoop.
+class TerminalHandler
+{
+  public:
+
+    // Destructor
+    // Prevents error messages about non-virtual destructors
+    virtual ~TerminalHandler()
+    {
+    }
+
+    // This method is given every key read since the last frame, in order,
+    // and returns false to stop the loop.
+    virtual bool HandleInput( const std::vector<KeyEvent>& keys ) = 0;
+
+    // This method draws a frame, e.g. with LabyrinthMap::Display().
+    virtual void DrawFrame() = 0;
+};
+
+// This class runs a game session from a terminal.
+//
+// The loop sleeps in poll() until a key arrives, so it uses no CPU between
+// keys. Keys which arrive within one frame budget of the last frame are
+// collected and handled together, so one frame is drawn for all of them;
+// a key is therefore drawn at most one frame budget (plus the time to draw)
+// after it arrives.
+//
+// If the input is a terminal, it is put in raw mode (no echo, and keys are
+// read as they are pressed rather than by line) until the loop is
+// destroyed. Raw mode also turns off the signals sent by keys, so that
+// Ctrl-C cannot kill the process with the terminal left in raw mode:
+// Ctrl-C is read as Key::kInterrupt instead, and the loop returns once the
+// handler has been given it. Ctrl-Z and Ctrl-\ are read as characters.
+class TerminalEventLoop
+{
+  public:
+
+    // Parameterized constructor
+    // Reads keys from input_fd, which is owned by the caller.
+    // An exception is thrown if:
+    //   input_fd is negative (invalid_argument)
+    //   frame_budget is not positive (invalid_argument)
+    //   The terminal cannot be put in raw mode (runtime_error)
+    TerminalEventLoop( const int input_fd,
+                       const std::chrono::milliseconds frame_budget );
+
+    // Destructor
+    // Restores the terminal mode.
+    ~TerminalEventLoop();
+
+    TerminalEventLoop( const TerminalEventLoop& ) = delete;
+    TerminalEventLoop& operator=( const TerminalEventLoop& ) = delete;
+
+    // This method draws a first frame, then handles keys and draws frames
+    // until the handler returns false, Ctrl-C is pressed or the input
+    // ends.
+    // An exception is thrown if:
+    //   The input cannot be read (runtime_error)
+    void Run( TerminalHandler& handler );
+
+    // This method returns the number of frames drawn.
+    size_t Frames() const;
+
+    // This method returns the number of keys read.
+    size_t Keys() const;
+
+  private:
+
+    const int fd_;
+    const std::chrono::milliseconds frame_budget_;
+    bool raw_ = false;  // original_ must be restored
+    termios original_;
+
+    std::vector<KeyEvent> keys_;
+    std::string pending_;  // Bytes of an incomplete escape sequence
+    size_t frames_ = 0;
+    size_t num_keys_ = 0;
+
+    // This private method waits until input arrives or the timeout (in
+    // milliseconds, or -1 for none) passes, and returns true if input
+    // arrived.
+    // An exception is thrown if:
+    //   The input cannot be polled (runtime_error)
+    bool Wait( const int timeout ) const;
+
+    // This private method reads the available input into keys_, and
+    // returns false if the input has ended.
+    // An exception is thrown if:
+    //   The input cannot be read (runtime_error)
+    bool ReadKeys();
+
+    // This private method converts the bytes in pending_ into keys_,
+    // leaving an incomplete escape sequence unless the input has ended.
+    void DecodeKeys( const bool ended );
+};
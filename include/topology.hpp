@@ -0,0 +1,122 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the grid topologies used by GridLabyrinth:
+ * square, hexagonal and triangular cells.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "coordinate.hpp"
+
+// A topology is a struct with only static members, given as a template
+// parameter so that every lookup is resolved at compile time:
+//   kNeighbours      The number of sides of a cell (at most 8)
+//   Neighbour()      Finds the cell across side d, if it is in the grid
+//   Opposite()       The side of that cell which faces back across side d
+// A wall is encoded as bit d of a cell's open mask, set if side d is open.
+
+// This struct is the topology of square cells, with sides north, east,
+// south and west in that order, matching Room::OpenMask().
+struct SquareTopology
+{
+  static constexpr uint32_t kNeighbours = 4;
+
+  // This method sets out to the cell across side d of c and returns true,
+  // or returns false if that cell is outside a grid of the given sizes.
+  static bool Neighbour( const Coordinate c,
+                         const uint32_t d,
+                         const size_t x_size,
+                         const size_t y_size,
+                         Coordinate& out )
+  {
+    static const int kDx[] = { 0, 1, 0, -1 };
+    static const int kDy[] = { -1, 0, 1, 0 };
+
+    // Moving off the low edge wraps around to a huge value
+    out.x = c.x + kDx[d];
+    out.y = c.y + kDy[d];
+    return out.x < x_size && out.y < y_size;
+  }
+
+  // This method returns the side of the cell across side d of c which
+  // faces c.
+  static uint32_t Opposite( const Coordinate, const uint32_t d )
+  {
+    return d ^ 2;
+  }
+};
+
+// This struct is the topology of hexagonal cells with pointed tops, where
+// odd rows are shifted half a cell east. The sides are east, north-east,
+// north-west, west, south-west and south-east in that order.
+struct HexTopology
+{
+  static constexpr uint32_t kNeighbours = 6;
+
+  // This method sets out to the cell across side d of c and returns true,
+  // or returns false if that cell is outside a grid of the given sizes.
+  static bool Neighbour( const Coordinate c,
+                         const uint32_t d,
+                         const size_t x_size,
+                         const size_t y_size,
+                         Coordinate& out )
+  {
+    // Indexed by row parity, then side
+    static const int kDx[2][6] =
+    {
+      { 1, 0, -1, -1, -1, 0 },
+      { 1, 1, 0, -1, 0, 1 },
+    };
+    static const int kDy[] = { 0, -1, -1, 0, 1, 1 };
+
+    out.x = c.x + kDx[c.y & 1][d];
+    out.y = c.y + kDy[d];
+    return out.x < x_size && out.y < y_size;
+  }
+
+  // This method returns the side of the cell across side d of c which
+  // faces c.
+  static uint32_t Opposite( const Coordinate, const uint32_t d )
+  {
+    return d < 3 ? d + 3 : d - 3;
+  }
+};
+
+// This struct is the topology of triangular cells, which point up when
+// (x + y) is even and down otherwise. The sides are west, east, and the
+// base, which is south of a cell pointing up and north of a cell pointing
+// down.
+struct TriangleTopology
+{
+  static constexpr uint32_t kNeighbours = 3;
+
+  // This method sets out to the cell across side d of c and returns true,
+  // or returns false if that cell is outside a grid of the given sizes.
+  static bool Neighbour( const Coordinate c,
+                         const uint32_t d,
+                         const size_t x_size,
+                         const size_t y_size,
+                         Coordinate& out )
+  {
+    static const int kDx[] = { -1, 1, 0 };
+    const int base = ((c.x + c.y) & 1) ? -1 : 1;
+
+    out.x = c.x + kDx[d];
+    out.y = c.y + (d == 2 ? base : 0);
+    return out.x < x_size && out.y < y_size;
+  }
+
+  // This method returns the side of the cell across side d of c which
+  // faces c.
+  static uint32_t Opposite( const Coordinate, const uint32_t d )
+  {
+    return d == 2 ? 2 : d ^ 1;
+  }
+};
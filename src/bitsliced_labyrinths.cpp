@@ -0,0 +1,357 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the BitslicedLabyrinths
+ * class, which holds the walls of 64 Labyrinths of the same size and
+ * measures all of them at once.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/bitsliced_labyrinths.hpp"
+
+// Definitions of the constants which are passed by reference
+const size_t BitslicedLabyrinths::kLanes;
+const uint16_t BitslicedLabyrinths::kUnreachable;
+
+namespace
+{
+
+// This struct counts, for each of 64 lanes, how many of the words added
+// had the lane's bit set. Plane k holds bit k of every lane's count, so
+// adding a word is a ripple-carry addition of all 64 counts at once.
+struct LaneCounter
+{
+  static const size_t kPlanes = 16;
+
+  uint64_t planes[kPlanes] = {};
+
+  // This method adds 1 to the count of every lane set in w.
+  void Add( uint64_t w )
+  {
+    for( size_t k = 0; k < kPlanes && w != 0; ++k )
+    {
+      const uint64_t carry = planes[k] & w;
+      planes[k] ^= w;
+      w = carry;
+    }
+  }
+
+  // This method writes the count of each lane into counts.
+  void Read( uint32_t counts[BitslicedLabyrinths::kLanes] ) const
+  {
+    for( size_t lane = 0; lane < BitslicedLabyrinths::kLanes; ++lane )
+    {
+      uint32_t count = 0;
+      for( size_t k = 0; k < kPlanes; ++k )
+      {
+        count |= static_cast<uint32_t>( planes[k] >> lane & 1 ) << k;
+      }
+      counts[lane] = count;
+    }
+  }
+};
+
+}  // Local namespace
+
+// Parameterized constructor
+// An exception is thrown if:
+//   The sizes are not valid for a Labyrinth (domain_error)
+BitslicedLabyrinths::BitslicedLabyrinths( const size_t x_size,
+                                          const size_t y_size ) :
+  x_size_(x_size),
+  y_size_(y_size),
+  num_rooms_(x_size * y_size)
+{
+  if( !Labyrinth::CheckSizes(x_size, y_size).IsOk() )
+  {
+    throw std::domain_error( "Error: BitslicedLabyrinths() was given sizes "\
+      "which are not valid for a Labyrinth.\n" );
+  }
+
+  east_.resize( num_rooms_, 0 );
+  south_.resize( num_rooms_, 0 );
+  visited_.resize( num_rooms_ );
+  frontier_.resize( num_rooms_ );
+  next_.resize( num_rooms_ );
+}
+
+// This method copies the connections of l into the lane.
+// An exception is thrown if:
+//   lane is not less than kLanes (domain_error)
+//   The size of l does not match (domain_error)
+void BitslicedLabyrinths::Load( const size_t lane, const Labyrinth& l )
+{
+  CheckLane( lane, l, "Load" );
+
+  const uint64_t bit = uint64_t(1) << lane;
+  size_t id = 0;
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x, ++id )
+    {
+      // Bit 1 of the mask is east, and bit 2 is south
+      const unsigned char mask = l.OpenMask( Coordinate(x, y) );
+      east_[id] = (east_[id] & ~bit) | ((mask >> 1 & 1) ? bit : 0);
+      south_[id] = (south_[id] & ~bit) | ((mask >> 2 & 1) ? bit : 0);
+    }
+  }
+}
+
+// This method connects and disconnects the Rooms of l so that they
+// match the lane. Items, Inhabitants and the exit of l are kept.
+// An exception is thrown if:
+//   lane is not less than kLanes (domain_error)
+//   The size of l does not match (domain_error)
+void BitslicedLabyrinths::Store( const size_t lane, Labyrinth& l ) const
+{
+  CheckLane( lane, l, "Store" );
+
+  size_t id = 0;
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x, ++id )
+    {
+      const Coordinate rm( x, y );
+      if( x + 1 < x_size_ )
+      {
+        const bool open = (east_[id] >> lane & 1) != 0;
+        if( open != (l.DirectionCheck(rm, Direction::kEast) ==
+                     RoomBorder::kRoom) )
+        {
+          if( open )
+          {
+            l.ConnectRooms( rm, Coordinate(x + 1, y) );
+          }
+          else
+          {
+            l.DisconnectRooms( rm, Coordinate(x + 1, y) );
+          }
+        }
+      }
+      if( y + 1 < y_size_ )
+      {
+        const bool open = (south_[id] >> lane & 1) != 0;
+        if( open != (l.DirectionCheck(rm, Direction::kSouth) ==
+                     RoomBorder::kRoom) )
+        {
+          if( open )
+          {
+            l.ConnectRooms( rm, Coordinate(x, y + 1) );
+          }
+          else
+          {
+            l.DisconnectRooms( rm, Coordinate(x, y + 1) );
+          }
+        }
+      }
+    }
+  }
+}
+
+// This method sets reached[id] to the lanes in which the Room with
+// RoomId id can be reached from src.
+// An exception is thrown if:
+//   The Room is outside the Labyrinths (domain_error)
+void BitslicedLabyrinths::Reachable( const Coordinate src,
+                                     std::vector<uint64_t>& reached )
+{
+  StartSearch( src, "Error: Reachable() was given a Coordinate outside of "\
+    "the Labyrinths.\n" );
+  while( Expand() )
+  {
+  }
+  reached = visited_;
+}
+
+// This method sets counts[i] to the number of Rooms of lane i which can
+// be reached from src, including src.
+// An exception is thrown if:
+//   The Room is outside the Labyrinths (domain_error)
+void BitslicedLabyrinths::CountReachable( const Coordinate src,
+                                          uint32_t counts[kLanes] )
+{
+  StartSearch( src, "Error: CountReachable() was given a Coordinate "\
+    "outside of the Labyrinths.\n" );
+  while( Expand() )
+  {
+  }
+
+  LaneCounter counter;
+  for( const uint64_t w : visited_ )
+  {
+    counter.Add( w );
+  }
+  counter.Read( counts );
+}
+
+// This method sets counts[i] to the number of dead ends (Rooms with
+// exactly one connection) of lane i.
+void BitslicedLabyrinths::CountDeadEnds( uint32_t counts[kLanes] ) const
+{
+  LaneCounter counter;
+  size_t id = 0;
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x, ++id )
+    {
+      const uint64_t n = y > 0 ? south_[id - x_size_] : 0;
+      const uint64_t e = east_[id];
+      const uint64_t s = south_[id];
+      const uint64_t w = x > 0 ? east_[id - 1] : 0;
+
+      // At least one connection, but not two
+      const uint64_t two = (n & e) | (n & s) | (n & w) |
+                           (e & s) | (e & w) | (s & w);
+      counter.Add( (n | e | s | w) & ~two );
+    }
+  }
+  counter.Read( counts );
+}
+
+// This method writes the breadth-first search layers from src into
+// layers, and returns the number of layers. The Rooms of lane i at
+// distance d from src are the Rooms with bit i set in
+// layers[d * x_size * y_size + id].
+// An exception is thrown if:
+//   The Room is outside the Labyrinths (domain_error)
+size_t BitslicedLabyrinths::Layers( const Coordinate src,
+                                    std::vector<uint64_t>& layers )
+{
+  StartSearch( src, "Error: Layers() was given a Coordinate outside of the "\
+    "Labyrinths.\n" );
+  layers.assign( frontier_.begin(), frontier_.end() );
+  size_t num_layers = 1;
+  while( Expand() )
+  {
+    layers.insert( layers.end(), frontier_.begin(), frontier_.end() );
+    ++num_layers;
+  }
+  return num_layers;
+}
+
+// This method sets distances[i] to the number of steps from src to dst
+// in lane i, or kUnreachable. The search stops once dst has been
+// reached in every lane where it can be.
+// An exception is thrown if:
+//   src or dst is outside the Labyrinths (domain_error)
+void BitslicedLabyrinths::Distances( const Coordinate src,
+                                     const Coordinate dst,
+                                     uint16_t distances[kLanes] )
+{
+  const char* const message = "Error: Distances() was given a Coordinate "\
+    "outside of the Labyrinths.\n";
+  if( dst.x >= x_size_ || dst.y >= y_size_ )
+  {
+    throw std::domain_error( message );
+  }
+  StartSearch( src, message );
+
+  std::fill( distances, distances + kLanes, kUnreachable );
+  const size_t target = dst.y * x_size_ + dst.x;
+  uint64_t arrived = 0;
+  uint16_t distance = 0;
+  do
+  {
+    const uint64_t now = frontier_[target] & ~arrived;
+    for( size_t lane = 0; lane < kLanes && now >> lane != 0; ++lane )
+    {
+      if( now >> lane & 1 )
+      {
+        distances[lane] = distance;
+      }
+    }
+    arrived |= now;
+    ++distance;
+  }
+  while( arrived != ~uint64_t(0) && Expand() );
+}
+
+// PRIVATE METHODS:
+
+// This private method starts a search from src in every lane.
+// An exception is thrown if:
+//   The Room is outside the Labyrinths (domain_error)
+void BitslicedLabyrinths::StartSearch( const Coordinate src,
+                                       const char* const message )
+{
+  if( src.x >= x_size_ || src.y >= y_size_ )
+  {
+    throw std::domain_error( message );
+  }
+
+  std::fill( visited_.begin(), visited_.end(), 0 );
+  std::fill( frontier_.begin(), frontier_.end(), 0 );
+  const size_t id = src.y * x_size_ + src.x;
+  visited_[id] = ~uint64_t(0);
+  frontier_[id] = ~uint64_t(0);
+}
+
+// This private method moves the search one layer outward into
+// frontier_, and returns false if no lane reached a new Room.
+bool BitslicedLabyrinths::Expand()
+{
+  uint64_t any = 0;
+  size_t id = 0;
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x, ++id )
+    {
+      // A Room is reached in the lanes where a neighbour in the frontier
+      // is connected to it
+      uint64_t w = 0;
+      if( x > 0 )
+      {
+        w |= frontier_[id - 1] & east_[id - 1];
+      }
+      if( x + 1 < x_size_ )
+      {
+        w |= frontier_[id + 1] & east_[id];
+      }
+      if( y > 0 )
+      {
+        w |= frontier_[id - x_size_] & south_[id - x_size_];
+      }
+      if( y + 1 < y_size_ )
+      {
+        w |= frontier_[id + x_size_] & south_[id];
+      }
+      w &= ~visited_[id];
+      visited_[id] |= w;
+      next_[id] = w;
+      any |= w;
+    }
+  }
+  frontier_.swap( next_ );
+  return any != 0;
+}
+
+// This private method throws if the lane or the size of l is invalid.
+// An exception is thrown if:
+//   lane is not less than kLanes (domain_error)
+//   The size of l does not match (domain_error)
+void BitslicedLabyrinths::CheckLane( const size_t lane,
+                                     const Labyrinth& l,
+                                     const char* const method ) const
+{
+  if( lane >= kLanes )
+  {
+    throw std::domain_error( std::string("Error: ") + method + "() was "\
+      "given a lane outside of the set.\n" );
+  }
+  else if( l.GetXSize() != x_size_ || l.GetYSize() != y_size_ )
+  {
+    throw std::domain_error( std::string("Error: ") + method + "() was "\
+      "given a Labyrinth of a different size.\n" );
+  }
+}
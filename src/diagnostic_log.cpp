@@ -0,0 +1,587 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the DiagnosticLog class,
+ * which writes diagnostic messages to a file descriptor from a background
+ * thread.
+ *
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../include/status.hpp"
+#include "../include/diagnostic_log.hpp"
+
+// Definitions of the constants which are passed by reference
+const size_t DiagnosticLog::kMaxBurst;
+const size_t DiagnosticLog::kMaxCopied;
+
+namespace
+{
+
+// Indexed by Severity
+const char* const kSeverityNames[] =
+{
+  "DEBUG",
+  "INFO",
+  "WARNING",
+  "ERROR",
+};
+
+// How long the writer sleeps when it may have missed a wake-up
+const std::chrono::milliseconds kIdleWait( 50 );
+
+// This local function returns the key of a message and severity in the
+// table of rate limits, which is never 0.
+uint64_t LimitKey( const uint64_t identity, const Severity s );
+
+// This local function returns the FNV-1a hash of the text, which
+// identifies a copied message for the rate limit.
+uint64_t HashText( const std::string& text );
+
+// This local function returns the severity of a key of LimitKey().
+Severity KeySeverity( const uint64_t key );
+
+// This local function returns the line which reports the repeats of a
+// message.
+std::string Repeated( const size_t repeats, const std::string& message );
+
+// This local function returns the key of a message and severity in the
+// table of rate limits, which is never 0.
+uint64_t LimitKey( const uint64_t identity, const Severity s )
+{
+  // The severity is below 7, so the sum never wraps to 0
+  return (identity << 3 | static_cast<uint64_t>(s)) + 1;
+}
+
+// This local function returns the FNV-1a hash of the text, which
+// identifies a copied message for the rate limit.
+uint64_t HashText( const std::string& text )
+{
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for( const char c : text )
+  {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+// This local function returns the severity of a key of LimitKey().
+Severity KeySeverity( const uint64_t key )
+{
+  return static_cast<Severity>( (key - 1) & 7 );
+}
+
+// This local function returns the line which reports the repeats of a
+// message.
+std::string Repeated( const size_t repeats, const std::string& message )
+{
+  return "(repeated " + std::to_string(repeats) + " more times) " + message;
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// Writes messages of the given level or more severe to fd, which is
+// owned by the caller.
+// An exception is thrown if:
+//   fd is negative (invalid_argument)
+//   burst is 0 or more than kMaxBurst (invalid_argument)
+DiagnosticLog::DiagnosticLog( const int fd,
+                              const Severity level,
+                              const size_t burst,
+                              const std::chrono::milliseconds window ) :
+  fd_(fd),
+  burst_(burst),
+  window_(window.count()),
+  start_(std::chrono::steady_clock::now()),
+  level_(level),
+  slots_(std::make_unique<Slot[]>(kCapacity)),
+  enqueue_pos_(0),
+  written_pos_(0),
+  written_(0),
+  suppressed_(0),
+  dropped_(0),
+  limits_(std::make_unique<Limit[]>(kLimits)),
+  idle_(false),
+  stopping_(false),
+  limit_texts_(kLimits)
+{
+  if( fd < 0 )
+  {
+    RaiseError( Status(ErrorCode::kInvalidArgument, "Error: DiagnosticLog() "\
+      "was given an invalid (negative) file descriptor.\n") );
+  }
+  else if( burst == 0 )
+  {
+    RaiseError( Status(ErrorCode::kInvalidArgument, "Error: DiagnosticLog() "\
+      "was given a burst of 0 messages.\n") );
+  }
+  else if( burst > kMaxBurst )
+  {
+    RaiseError( Status(ErrorCode::kInvalidArgument, "Error: DiagnosticLog() "\
+      "was given a burst of more than kMaxBurst messages.\n") );
+  }
+
+  for( size_t i = 0; i < kCapacity; ++i )
+  {
+    slots_[i].sequence.store( i, std::memory_order_relaxed );
+  }
+  for( size_t i = 0; i < kLimits; ++i )
+  {
+    limits_[i].key.store( 0, std::memory_order_relaxed );
+    limits_[i].state.store( 0, std::memory_order_relaxed );
+    limits_[i].suppressed.store( 0, std::memory_order_relaxed );
+    limit_texts_[i].key = 0;
+  }
+}
+
+// Destructor
+// Writes every queued message, then stops the background thread.
+DiagnosticLog::~DiagnosticLog()
+{
+  if( writer_.joinable() )
+  {
+    stopping_.store( true );
+    wake_.notify_one();
+    writer_.join();
+  }
+}
+
+// This method returns the log which Log() writes to, which writes to
+// standard error.
+DiagnosticLog& DiagnosticLog::Global()
+{
+  static DiagnosticLog log( STDERR_FILENO );
+  return log;
+}
+
+// This method sets the least severe level of messages to write.
+void DiagnosticLog::SetLevel( const Severity level )
+{
+  level_.store( level, std::memory_order_relaxed );
+}
+
+// This method queues the message to be written, if its severity is
+// enabled. The message is not copied.
+void DiagnosticLog::Write( const Severity s, const char* const message )
+{
+  if( Enabled(s) )
+  {
+    Enqueue( s, message, nullptr, 0, reinterpret_cast<uintptr_t>(message) );
+  }
+}
+
+// This method queues a copy of the message to be written, if its
+// severity is enabled.
+void DiagnosticLog::Write( const Severity s, const std::string& message )
+{
+  if( Enabled(s) )
+  {
+    Enqueue( s, nullptr, message.data(), message.size(),
+             HashText(message) );
+  }
+}
+// This method waits until every message queued before the call has
+// been written.
+void DiagnosticLog::Flush()
+{
+  const size_t target = enqueue_pos_.load( std::memory_order_acquire );
+  while( written_pos_.load(std::memory_order_acquire) < target )
+  {
+    wake_.notify_one();
+    std::this_thread::sleep_for( std::chrono::microseconds(100) );
+  }
+}
+
+// This method returns the number of messages written.
+size_t DiagnosticLog::Written() const
+{
+  return written_.load();
+}
+
+// This method returns the number of repeated messages not written
+// because of the rate limit.
+size_t DiagnosticLog::Suppressed() const
+{
+  return suppressed_.load();
+}
+
+// This method returns the number of messages dropped because the
+// queue was full.
+size_t DiagnosticLog::Dropped() const
+{
+  return dropped_.load();
+}
+
+// PRIVATE METHODS:
+
+// This private method queues the message, or the size characters of
+// text if message is null, identified by identity for the rate limit.
+void DiagnosticLog::Enqueue( const Severity s,
+                             const char* const message,
+                             const char* const text,
+                             const size_t size,
+                             const uint64_t identity )
+{
+  Start();
+  const int64_t now = Now();
+
+  // Repeats are counted before the message takes a slot, so that they
+  // never fill the queue
+  const uint64_t key = LimitKey( identity, s );
+  const size_t limit = FindLimit( key, now / 1000000 );
+  size_t repeats = 0;
+  if( limit != kNoLimit && !Admit(limits_[limit], now / 1000000, repeats) )
+  {
+    suppressed_.fetch_add( 1, std::memory_order_relaxed );
+    return;
+  }
+
+  // Claims a slot; the queue is bounded, multiple-producer and
+  // single-consumer, after Dmitry Vyukov's bounded queue
+  Slot* slot = nullptr;
+  size_t pos = enqueue_pos_.load( std::memory_order_relaxed );
+  for( ;; )
+  {
+    slot = &slots_[pos & (kCapacity - 1)];
+    const size_t sequence = slot->sequence.load( std::memory_order_acquire );
+    const intptr_t difference = static_cast<intptr_t>( sequence ) -
+                                static_cast<intptr_t>( pos );
+    if( difference == 0 )
+    {
+      if( enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed) )
+      {
+        break;
+      }
+    }
+    else if( difference < 0 )
+    {
+      // The writer has not emptied the slot since the last lap; the
+      // repeats are left for the writer to report
+      if( repeats > 0 )
+      {
+        limits_[limit].suppressed.fetch_add( repeats );
+      }
+      dropped_.fetch_add( 1, std::memory_order_relaxed );
+      return;
+    }
+    else
+    {
+      pos = enqueue_pos_.load( std::memory_order_relaxed );
+    }
+  }
+
+  slot->severity = s;
+  slot->limit = limit;
+  slot->repeats = repeats;
+  slot->key = key;
+  slot->message = message;
+  if( message == nullptr )
+  {
+    // Long messages are cut, and end with "..." to show it
+    size_t copied = size;
+    if( size > kMaxCopied )
+    {
+      copied = kMaxCopied;
+      std::memcpy( slot->text, text, kMaxCopied - 3 );
+      std::memcpy( slot->text + kMaxCopied - 3, "...", 3 );
+    }
+    else
+    {
+      std::memcpy( slot->text, text, size );
+    }
+    slot->text[copied] = '\0';
+  }
+  slot->time = now;
+  slot->sequence.store( pos + 1, std::memory_order_release );
+
+  if( idle_.load(std::memory_order_relaxed) )
+  {
+    wake_.notify_one();
+  }
+}
+
+// This private method returns the nanoseconds since the log was
+// created.
+int64_t DiagnosticLog::Now() const
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - start_).count();
+}
+
+// This private method returns the entry of limits_ for the key, taking
+// an unused entry or one whose window has ended, or kNoLimit if there
+// is none.
+size_t DiagnosticLog::FindLimit( const uint64_t key, const int64_t now )
+{
+  const size_t home = static_cast<size_t>(
+    (key * 0x9E3779B97F4A7C15ull) >> 58 );
+  for( size_t probe = 0; probe < kProbes; ++probe )
+  {
+    Limit& limit = limits_[(home + probe) & (kLimits - 1)];
+    uint64_t found = limit.key.load( std::memory_order_acquire );
+    if( found == 0 )
+    {
+      limit.key.compare_exchange_strong( found, key );
+      found = limit.key.load( std::memory_order_acquire );
+    }
+    if( found == key )
+    {
+      return (home + probe) & (kLimits - 1);
+    }
+  }
+
+  // Another message may take an entry once its repeats are reported
+  for( size_t probe = 0; probe < kProbes; ++probe )
+  {
+    Limit& limit = limits_[(home + probe) & (kLimits - 1)];
+    uint64_t found = limit.key.load( std::memory_order_acquire );
+    if( WindowEnded(limit.state.load(std::memory_order_acquire), now) &&
+        limit.suppressed.load() == 0 &&
+        limit.key.compare_exchange_strong(found, key) )
+    {
+      return (home + probe) & (kLimits - 1);
+    }
+  }
+  return kNoLimit;
+}
+
+// This private method counts a message against its limit at the given
+// time in milliseconds, and returns true if it may be written. If it
+// starts a new window, repeats is set to the number suppressed in the
+// previous one.
+bool DiagnosticLog::Admit( Limit& limit, const int64_t now, size_t& repeats )
+{
+  // The state is the start of the window plus 1 (so that 0 means no
+  // window) above the count of messages written in it
+  const uint64_t count_mask = (uint64_t(1) << kCountBits) - 1;
+  uint64_t state = limit.state.load( std::memory_order_acquire );
+  for( ;; )
+  {
+    uint64_t next = 0;
+    const bool new_window = WindowEnded( state, now ) || state == 0;
+    if( new_window )
+    {
+      next = static_cast<uint64_t>( now + 1 ) << kCountBits | 1;
+    }
+    else if( (state & count_mask) < burst_ )
+    {
+      next = state + 1;
+    }
+    else
+    {
+      limit.suppressed.fetch_add( 1 );
+      return false;
+    }
+
+    if( limit.state.compare_exchange_weak(state, next) )
+    {
+      if( new_window )
+      {
+        repeats = limit.suppressed.exchange( 0 );
+      }
+      return true;
+    }
+  }
+}
+
+// This private method returns true if the window of the given state
+// has ended at the given time in milliseconds.
+bool DiagnosticLog::WindowEnded( const uint64_t state,
+                                 const int64_t now ) const
+{
+  // A producer may store a window which starts after its caller's time
+  const int64_t start = static_cast<int64_t>( state >> kCountBits ) - 1;
+  return state != 0 && now - start >= window_;
+}
+
+// This private method starts the background thread, if it has not been
+// started yet.
+void DiagnosticLog::Start()
+{
+  std::call_once( started_, [this]()
+  {
+    writer_ = std::thread( &DiagnosticLog::Run, this );
+  } );
+}
+
+// This private method is the background thread, which writes messages
+// until the log is destroyed.
+void DiagnosticLog::Run()
+{
+  for( ;; )
+  {
+    if( Drain() )
+    {
+      continue;
+    }
+    if( stopping_.load() )
+    {
+      break;
+    }
+
+    // Producers do not take the lock, so a wake-up may be missed; the
+    // wait is bounded so that the message is written soon anyway
+    std::unique_lock<std::mutex> lock( wake_mutex_ );
+    idle_.store( true );
+    wake_.wait_for( lock, kIdleWait );
+    idle_.store( false );
+  }
+
+  // Reports the repeats of the windows which have not ended
+  ReportRepeats( Now(), true );
+  WriteBuffer();
+}
+
+// This private method writes every queued message, and the repeats of
+// the windows which have ended, and returns true if anything was
+// written.
+bool DiagnosticLog::Drain()
+{
+  const int64_t now = Now();
+  bool any = false;
+
+  for( ;; )
+  {
+    Slot& slot = slots_[dequeue_pos_ & (kCapacity - 1)];
+    const size_t sequence = slot.sequence.load( std::memory_order_acquire );
+    if( sequence != dequeue_pos_ + 1 )
+    {
+      break;  // Empty, or a producer is still filling the slot
+    }
+    const Severity s = slot.severity;
+    const size_t limit = slot.limit;
+    const size_t repeats = slot.repeats;
+    const uint64_t key = slot.key;
+    const std::string message( slot.message != nullptr ? slot.message :
+                                                         slot.text );
+    const int64_t time = slot.time;
+    slot.sequence.store( dequeue_pos_ + kCapacity,
+                         std::memory_order_release );
+    ++dequeue_pos_;
+    any = true;
+
+    // The producers have already applied the rate limit; the repeats of
+    // the window before are reported ahead of the message
+    if( repeats > 0 )
+    {
+      Format( time, s, Repeated(repeats, message) );
+    }
+    Format( time, s, message );
+    written_.fetch_add( 1, std::memory_order_relaxed );
+    if( limit != kNoLimit )
+    {
+      limit_texts_[limit].key = key;
+      limit_texts_[limit].message = message;
+    }
+  }
+
+  // Windows which ended without another repeat
+  any = ReportRepeats( now, false ) || any;
+
+  const size_t dropped = dropped_.load( std::memory_order_relaxed );
+  if( dropped != dropped_reported_ )
+  {
+    Format( now, Severity::kWarning, "(dropped " +
+              std::to_string(dropped - dropped_reported_) +
+              " messages because the queue was full)" );
+    dropped_reported_ = dropped;
+    any = true;
+  }
+
+  WriteBuffer();
+  written_pos_.store( dequeue_pos_, std::memory_order_release );
+  return any;
+}
+
+// This private method writes the repeats of the windows which have
+// ended, or of every window if all is true, and returns true if
+// anything was written.
+bool DiagnosticLog::ReportRepeats( const int64_t time, const bool all )
+{
+  bool any = false;
+  for( size_t i = 0; i < kLimits; ++i )
+  {
+    Limit& limit = limits_[i];
+    const uint64_t key = limit.key.load( std::memory_order_acquire );
+    if( key == 0 || limit.suppressed.load() == 0 )
+    {
+      continue;
+    }
+
+    // Until the writer has seen a message of the key, its text is unknown
+    if( !all && (limit_texts_[i].key != key ||
+                 !WindowEnded(limit.state.load(std::memory_order_acquire),
+                              time / 1000000)) )
+    {
+      continue;
+    }
+    const size_t repeats = limit.suppressed.exchange( 0 );
+    if( repeats > 0 )
+    {
+      Format( time, KeySeverity(key),
+              Repeated(repeats, limit_texts_[i].message) );
+      any = true;
+    }
+  }
+  return any;
+}
+
+// This private method appends a line with the given time, severity
+// and message to buffer_.
+void DiagnosticLog::Format( const int64_t time,
+                            const Severity s,
+                            const std::string& message )
+{
+  char prefix[48];
+  std::snprintf( prefix, sizeof(prefix), "[%10.6f] %s: ",
+                 static_cast<double>(time) / 1e9,
+                 kSeverityNames[static_cast<size_t>(s)] );
+  buffer_ += prefix;
+  buffer_ += message;
+
+  // Status messages end with their own newline
+  if( buffer_.back() != '\n' )
+  {
+    buffer_ += '\n';
+  }
+}
+
+// This private method writes buffer_ to the file descriptor, and
+// empties it.
+void DiagnosticLog::WriteBuffer()
+{
+  // Errors are ignored: a diagnostic log must not stop the program
+  size_t offset = 0;
+  while( offset < buffer_.size() )
+  {
+    const ssize_t size = write( fd_, buffer_.data() + offset,
+                                buffer_.size() - offset );
+    if( size < 0 && errno == EINTR )
+    {
+      continue;
+    }
+    else if( size <= 0 )
+    {
+      break;
+    }
+    offset += static_cast<size_t>( size );
+  }
+  buffer_.clear();
+}
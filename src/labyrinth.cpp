@@ -8,15 +8,71 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
-#include <iostream>
 #include <memory>
-#include <stdexcept>
 
 #include "../include/room_properties.hpp"
+#include "../include/status.hpp"
 #include "../include/room.hpp"
 #include "../include/coordinate.hpp"
+#include "../include/labyrinth_snapshot.hpp"
+#include "../include/labyrinth_listener.hpp"
 #include "../include/labyrinth.hpp"
+#include "../include/labyrinth_neighbourhood.hpp"
+
+namespace
+{
+
+// Rooms are prefetched this many places ahead, once a list has at least
+// kPrefetchMinimum Rooms; shorter lists finish before a prefetch helps.
+const size_t kPrefetchDistance = 8;
+const size_t kPrefetchMinimum = 64;
+
+// This local function asks for the Room to be brought into the cache.
+void PrefetchRoom( const Room* const r );
+
+// This local function writes the contents of the Room into position i of
+// each output which is not null.
+void GatherRoom( const Room& r,
+                 const size_t i,
+                 Inhabitant* const inhabitants,
+                 Item* const items,
+                 unsigned char* const masks );
+
+// This local function asks for the Room to be brought into the cache.
+void PrefetchRoom( const Room* const r )
+{
+#if defined(__GNUC__)
+  __builtin_prefetch( r );
+#else
+  (void)r;
+#endif
+}
+
+// This local function writes the contents of the Room into position i of
+// each output which is not null.
+void GatherRoom( const Room& r,
+                 const size_t i,
+                 Inhabitant* const inhabitants,
+                 Item* const items,
+                 unsigned char* const masks )
+{
+  if( inhabitants != nullptr )
+  {
+    inhabitants[i] = r.GetInhabitant();
+  }
+  if( items != nullptr )
+  {
+    items[i] = r.GetItem();
+  }
+  if( masks != nullptr )
+  {
+    masks[i] = r.OpenMask();
+  }
+}
+
+}  // Local namespace
 
 // CONSTRUCTOR/DESTRUCTOR:
 
@@ -26,54 +82,62 @@
 //   An x or y size greater than the maximum is given (domain_error)
 Labyrinth::Labyrinth( const size_t x_size, const size_t y_size ) :
   x_size_(x_size), y_size_(y_size)
+{
+  RaiseIfError( CheckSizes(x_size, y_size) );
+
+  auto rooms_temp_1 = std::make_unique<std::unique_ptr<Room[]>[]>(y_size);
+
+  rooms_ = std::move( rooms_temp_1 );
+  for( size_t i = 0; i < y_size; ++i )
+  {
+    auto rooms_temp_2 = std::make_unique<Room[]>(x_size);
+    rooms_[i] = std::move( rooms_temp_2 );
+  }
+
+}
+
+// This method returns the error which the constructor would throw for
+// the given sizes, so that they may be checked without exceptions.
+Status Labyrinth::CheckSizes( const size_t x_size, const size_t y_size )
 {
   if( x_size == 0 )
   {
     if( y_size == 0 )
     {
-      throw std::domain_error( "Error: Labyrinth() was given empty x and "\
-        "y sizes.\n" );
+      return Status( ErrorCode::kDomainError, "Error: Labyrinth() was "\
+        "given empty x and y sizes.\n" );
     }
     else
     {
-      throw std::domain_error( "Error: Labyrinth() was given an empty "\
-        "x size.\n" );
+      return Status( ErrorCode::kDomainError, "Error: Labyrinth() was "\
+        "given an empty x size.\n" );
     }
   }
   else if( y_size == 0 )
   {
-    throw std::domain_error( "Error: Labyrinth() was given an empty "\
-      "y size.\n" );
+    return Status( ErrorCode::kDomainError, "Error: Labyrinth() was given "\
+      "an empty y size.\n" );
   }
 
   if( x_size > MAX_X_SIZE_ )
   {
     if( y_size > MAX_Y_SIZE_ )
     {
-      throw std::domain_error( "Error: Labyrinth() was given x and y sizes "\
-        "greater than the maximum (20).\n" );
+      return Status( ErrorCode::kDomainError, "Error: Labyrinth() was "\
+        "given x and y sizes greater than the maximum (20).\n" );
     }
     else
     {
-      throw std::domain_error( "Error: Labyrinth() was given an x size "\
-        "greater than the maximum (20).\n" );
+      return Status( ErrorCode::kDomainError, "Error: Labyrinth() was "\
+        "given an x size greater than the maximum (20).\n" );
     }
   }
   else if( y_size > MAX_Y_SIZE_ )
   {
-    throw std::domain_error( "Error: Labyrinth() was given a y size "\
-      "greater than the maximum (20).\n" );
+    return Status( ErrorCode::kDomainError, "Error: Labyrinth() was given "\
+      "a y size greater than the maximum (20).\n" );
   }
-
-  auto rooms_temp_1 = std::make_unique<std::unique_ptr<Room[]>[]>(y_size);
-
-  rooms_ = std::move( rooms_temp_1 );
-  for( size_t i = 0; i < y_size; ++i )
-  {
-    auto rooms_temp_2 = std::make_unique<Room[]>(x_size);
-    rooms_[i] = std::move( rooms_temp_2 );
-  }
-
+  return Status();
 }
 
 // SETUP:
@@ -85,6 +149,325 @@ Labyrinth::Labyrinth( const size_t x_size, const size_t y_size ) :
 //   The Rooms are the same (logic_error)
 //   The Rooms are already connected (logic_error)
 void Labyrinth::ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
+{
+  RaiseIfError( TryConnectRooms(rm_1, rm_2) );
+}
+
+// This method disconnects two connected Rooms by rebuilding their
+// walls, e.g. when a tunnel collapses.
+// An exception is thrown if:
+//   One or both Rooms are outside the Labyrinth (domain_error)
+//   The Rooms are the same (logic_error)
+//   The Rooms are not connected (logic_error)
+void Labyrinth::DisconnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
+{
+  RaiseIfError( TryDisconnectRooms(rm_1, rm_2) );
+}
+
+// This method sets the primary (initial) spawn Room.
+// Spawns can be changed at any time.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+void Labyrinth::SetSpawn1( const Coordinate rm )
+{
+  RaiseIfError( TrySetSpawn1(rm) );
+}
+
+
+// This method sets the secondary spawn Room.
+// Spawns can be changed at any time.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+void Labyrinth::SetSpawn2( const Coordinate rm )
+{
+  RaiseIfError( TrySetSpawn2(rm) );
+}
+
+// This method returns the primary spawn Room.
+Coordinate Labyrinth::GetSpawn1() const
+{
+  return spawn_1_;
+}
+
+// This method returns the secondary spawn Room.
+Coordinate Labyrinth::GetSpawn2() const
+{
+  return spawn_2_;
+}
+
+// This method sets the exit of the Labyrinth on a Wall.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The Direction is invalid (kNone) (invalid_argument)
+//   The Direction has another Room (invalid_argument)
+//   The Exit has already been set (logic_error)
+void Labyrinth::SetExit( const Coordinate rm, const Direction d )
+{
+  RaiseIfError( TrySetExit(rm, d) );
+}
+
+// This method places an Inhabitant in a Room.
+// Cannot change an existing Inhabitant; use the EnemyAttacked() method
+// for that.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   Inhabitant inh is a null Inhabitant (i.e. Inhabitant::kNone)
+//     (invalid_argument)
+//   The Inhabitant of the Room has already been set (logic_error)
+void Labyrinth::SetInhabitant( const Coordinate rm, const Inhabitant inh )
+{
+  RaiseIfError( TrySetInhabitant(rm, inh) );
+}
+
+// This method places an Item in a Room.
+// Cannot change an existing Item; use the TakeItem() method for that.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   Item itm is a null Item (i.e. Item::kNone) (invalid_argument)
+//   The Item of the Room has already been set (logic_error)
+//   Item itm is a Treasure but the Treasure has already been placed
+//     in another room (logic_error)
+void Labyrinth::SetItem( const Coordinate rm, const Item itm )
+{
+  RaiseIfError( TrySetItem(rm, itm) );
+}
+
+// PLAY:
+
+// This method returns the current Inhabitant of the Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+Inhabitant Labyrinth::GetInhabitant( const Coordinate rm ) const
+{
+  return ValueOrRaise( TryGetInhabitant(rm) );
+}
+
+// This method attacks the Inhabitant of the Room, and sets the resultant
+// Inhabitant.
+// The bullet is not removed from the Player.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   There is no enemy to attack (i.e. Inhabitant::kNone, dead Minotaur,
+//     or cracked Mirror) (invalid_argument)
+void Labyrinth::AttackEnemy( const Coordinate rm )
+{
+  RaiseIfError( TryAttackEnemy(rm) );
+}
+
+// This method returns the current Item in the given Room, but does not
+// change it.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+Item Labyrinth::ItemAt( const Coordinate rm ) const
+{
+  return ValueOrRaise( TryItemAt(rm) );
+}
+
+// This method takes the Item from the Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   There is no Item to take (i.e. Item::kNone or Item taken already)
+//     (logic_error)
+void Labyrinth::TakeItem( const Coordinate rm )
+{
+  RaiseIfError( TryTakeItem(rm) );
+}
+
+// This method drops the Treasure in the given Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The Treasure has already been set in another Room (logic_error)
+void Labyrinth::DropTreasure( const Coordinate rm )
+{
+  RaiseIfError( TryDropTreasure(rm) );
+}
+
+// This method returns the type of RoomBorder in the given direction.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   Direction d is kNone (invalid_argument)
+RoomBorder Labyrinth::DirectionCheck( const Coordinate rm,
+                                      const Direction d ) const
+{
+  return ValueOrRaise( TryDirectionCheck(rm, d) );
+}
+
+// This method returns the Directions of the Room which lead to another
+// Room, as a mask with bit 0 set for north, bit 1 for east, bit 2 for
+// south, and bit 3 for west.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+unsigned char Labyrinth::OpenMask( const Coordinate rm ) const
+{
+  return ValueOrRaise( TryOpenMask(rm) );
+}
+
+// WEIGHTS:
+
+// This method sets the cost of entering the given Room, for solvers
+// which take costs into account.
+// Every Room costs 1 until a weight is set; the weights are only
+// allocated once the first weight is set.
+// Weights are not part of snapshots or level files.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The weight is 0 (invalid_argument)
+void Labyrinth::SetRoomWeight( const Coordinate rm,
+                               const unsigned char weight )
+{
+  RaiseIfError( TrySetRoomWeight(rm, weight) );
+}
+
+// This method returns the cost of entering the given Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+unsigned char Labyrinth::GetRoomWeight( const Coordinate rm ) const
+{
+  return ValueOrRaise( TryGetRoomWeight(rm) );
+}
+
+// LAYOUT:
+
+// This method returns the number of Rooms along the x-axis.
+size_t Labyrinth::GetXSize() const
+{
+  return x_size_;
+}
+
+// This method returns the number of Rooms along the y-axis.
+size_t Labyrinth::GetYSize() const
+{
+  return y_size_;
+}
+
+// This method returns the RoomId of the given Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+RoomId Labyrinth::GetRoomId( const Coordinate rm ) const
+{
+  return ValueOrRaise( TryGetRoomId(rm) );
+}
+
+// This method returns the Coordinate of the Room with the given RoomId.
+// An exception is thrown if:
+//   The RoomId is outside the Labyrinth (domain_error)
+Coordinate Labyrinth::GetCoordinate( const RoomId id ) const
+{
+  return ValueOrRaise( TryGetCoordinate(id) );
+}
+
+// NEIGHBOURHOODS:
+
+// This method writes the Rooms which can be reached from rm in at most
+// radius steps into out, grouped into rings by distance, with a
+// breadth-first search which stops at radius.
+// stamps is scratch memory owned by the caller. Once it has grown to
+// the size of the Labyrinth, the cost depends only on the number of
+// Rooms found.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+void Labyrinth::RoomsWithin( const Coordinate rm,
+                             const size_t radius,
+                             VisitStamps& stamps,
+                             Neighbourhood& out ) const
+{
+  RaiseIfError( TryRoomsWithin(rm, radius, stamps, out) );
+}
+
+// GATHERING:
+
+// This method writes the Inhabitant, Item and open Directions (as
+// OpenMask() returns them) of each of the count Rooms into the same
+// position of inhabitants, items and masks.
+// An exception is thrown if:
+//   rooms is null and count is not 0 (invalid_argument)
+//   One or more Rooms are outside the Labyrinth (domain_error)
+void Labyrinth::GatherRooms( const Coordinate* const rooms,
+                             const size_t count,
+                             Inhabitant* const inhabitants,
+                             Item* const items,
+                             unsigned char* const masks ) const
+{
+  RaiseIfError( TryGatherRooms(rooms, count, inhabitants, items, masks) );
+}
+
+// This method writes the Inhabitant, Item and open Directions of each
+// of the count Rooms with the given RoomIds, as GatherRooms() does for
+// Coordinates.
+// An exception is thrown if:
+//   ids is null and count is not 0 (invalid_argument)
+//   One or more RoomIds are outside the Labyrinth (domain_error)
+void Labyrinth::GatherRooms( const RoomId* const ids,
+                             const size_t count,
+                             Inhabitant* const inhabitants,
+                             Item* const items,
+                             unsigned char* const masks ) const
+{
+  RaiseIfError( TryGatherRooms(ids, count, inhabitants, items, masks) );
+}
+
+// SAVING:
+
+// This method copies the complete state of the Labyrinth into s.
+// The buffers of s are reused, so snapshotting into the same
+// LabyrinthSnapshot repeatedly does not allocate.
+void Labyrinth::TakeSnapshot( LabyrinthSnapshot& s ) const
+{
+  s.x_size = x_size_;
+  s.y_size = y_size_;
+  s.spawn_1 = spawn_1_;
+  s.spawn_2 = spawn_2_;
+  s.exit_set = exit_set_;
+  s.treasure_set = treasure_set_;
+
+  // Rooms are plain values, so each row is a single block copy
+  s.rooms.resize( x_size_ * y_size_ );
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    std::copy( rooms_[y].get(),
+               rooms_[y].get() + x_size_,
+               s.rooms.begin() + y * x_size_ );
+  }
+}
+
+// This method replaces the complete state of the Labyrinth with the
+// contents of s.
+// An exception is thrown if:
+//   The sizes of s do not match the Labyrinth (domain_error)
+//   s does not contain a Room for every Coordinate (logic_error)
+void Labyrinth::RestoreSnapshot( const LabyrinthSnapshot& s )
+{
+  RaiseIfError( TryRestoreSnapshot(s) );
+}
+
+// LISTENERS:
+
+// This method registers a LabyrinthListener to be notified of changes
+// to the Labyrinth.
+// The listener must be removed before it is destroyed.
+// An exception is thrown if:
+//   listener is null (invalid_argument)
+void Labyrinth::AddListener( LabyrinthListener* const listener ) const
+{
+  RaiseIfError( TryAddListener(listener) );
+}
+
+// This method stops notifying the given LabyrinthListener.
+// Removing a listener which was never added does nothing.
+void Labyrinth::RemoveListener( LabyrinthListener* const listener ) const
+{
+  listeners_.erase( std::remove( listeners_.begin(),
+                                 listeners_.end(),
+                                 listener ),
+                    listeners_.end() );
+}
+
+// ERRORS AS VALUES:
+
+// This method connects two Rooms as ConnectRooms() does, returning the
+// error instead of throwing it.
+Status Labyrinth::TryConnectRooms( const Coordinate rm_1,
+                                   const Coordinate rm_2 )
 {
   if( !WithinBounds(rm_1) || !WithinBounds(rm_2) )
   {
@@ -92,38 +475,39 @@ void Labyrinth::ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
     {
       if( !WithinBounds(rm_2) )
       {
-        throw std::domain_error( "Error: ConnectRooms() was given invalid "\
-          "coordinates for both rm_1 and rm_2.\n" );
+        return Status( ErrorCode::kDomainError, "Error: ConnectRooms() was "\
+          "given invalid coordinates for both rm_1 and rm_2.\n" );
       }
       else
       {
-        throw std::domain_error( "Error: ConnectRooms() was given "\
-          "an invalid coordinate for rm_1.\n" );
+        return Status( ErrorCode::kDomainError, "Error: ConnectRooms() was "\
+          "given an invalid coordinate for rm_1.\n" );
       }
     }
 
     else
     {
-      throw std::domain_error( "Error: ConnectRooms() was given an "\
-        "invalid coordinate for rm_2.\n" );
+      return Status( ErrorCode::kDomainError, "Error: ConnectRooms() was "\
+        "given an invalid coordinate for rm_2.\n" );
     }
   }
-  else if( !IsAdjacent(rm_1, rm_2) )
+  else if( rm_1 == rm_2 )
   {
-    throw std::logic_error( "Error: ConnectRooms() was given two coordinates "\
-      "which are not adjacent, and therefore cannot be connected.\n" );
+    return Status( ErrorCode::kLogicError, "Error: ConnectRooms() was given "\
+      "the same coordinate for the two Rooms.\n" );
   }
-  else if( rm_1 == rm_2 )
+  else if( !IsAdjacent(rm_1, rm_2) )
   {
-    throw std::logic_error( "Error: ConnectRooms() was given the same "\
-      "coordinate for the two Rooms.\n" );
+    return Status( ErrorCode::kLogicError, "Error: ConnectRooms() was given "\
+      "two coordinates which are not adjacent, and therefore cannot be "\
+      "connected.\n" );
   }
 
   int x_distance = (int)(rm_2.x) - (int)(rm_1.x);
   int y_distance = (int)(rm_2.y) - (int)(rm_1.y);
 
-  Direction break_wall_1;
-  Direction break_wall_2;
+  Direction break_wall_1 = Direction::kNone;
+  Direction break_wall_2 = Direction::kNone;
 
   if( x_distance == 0 )
   {
@@ -153,318 +537,296 @@ void Labyrinth::ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
     }
   }
 
-  if( RoomAt(rm_1).DirectionCheck(break_wall_1) == RoomBorder::kRoom )
+  if( RoomAt(rm_1).TryDirectionCheck(break_wall_1).Value() ==
+      RoomBorder::kRoom )
   {
-    throw std::logic_error( "Error: ConnectRooms() was given two Rooms "\
-      "which are already connected.\n" );
+    return Status( ErrorCode::kLogicError, "Error: ConnectRooms() was given "\
+      "two Rooms which are already connected.\n" );
   }
 
-  RoomAt(rm_1).BreakWall(break_wall_1);
-  RoomAt(rm_2).BreakWall(break_wall_2);
-  return;
+  // Either wall may be the exit, which cannot be broken again
+  Status broken = RoomAt(rm_1).TryBreakWall(break_wall_1);
+  if( !broken.IsOk() )
+  {
+    return broken;
+  }
+  broken = RoomAt(rm_2).TryBreakWall(break_wall_2);
+  if( !broken.IsOk() )
+  {
+    RoomAt(rm_1).TryBuildWall(break_wall_1);
+    return broken;
+  }
+
+  for( LabyrinthListener* const listener : listeners_ )
+  {
+    listener->RoomsConnected( rm_1, rm_2 );
+  }
+  return Status();
 }
 
-// This method sets the primary (initial) spawn Room.
-// Spawns can be changed at any time.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-void Labyrinth::SetSpawn1( const Coordinate rm )
+// This method disconnects two connected Rooms as DisconnectRooms() does,
+// returning the error instead of throwing it.
+Status Labyrinth::TryDisconnectRooms( const Coordinate rm_1,
+                                      const Coordinate rm_2 )
+{
+  if( !WithinBounds(rm_1) || !WithinBounds(rm_2) )
+  {
+    return Status( ErrorCode::kDomainError, "Error: DisconnectRooms() was "\
+      "given a coordinate outside of the Labyrinth.\n" );
+  }
+  else if( rm_1 == rm_2 )
+  {
+    return Status( ErrorCode::kLogicError, "Error: DisconnectRooms() was "\
+      "given the same coordinate for the two Rooms.\n" );
+  }
+  else if( !IsAdjacent(rm_1, rm_2) )
+  {
+    return Status( ErrorCode::kLogicError, "Error: DisconnectRooms() was "\
+      "given two Rooms which are not connected.\n" );
+  }
+
+  Direction wall_1 = Direction::kNone;
+  Direction wall_2 = Direction::kNone;
+  if( rm_1.x == rm_2.x )
+  {
+    wall_1 = rm_1.y < rm_2.y ? Direction::kSouth : Direction::kNorth;
+    wall_2 = rm_1.y < rm_2.y ? Direction::kNorth : Direction::kSouth;
+  }
+  else
+  {
+    wall_1 = rm_1.x < rm_2.x ? Direction::kEast : Direction::kWest;
+    wall_2 = rm_1.x < rm_2.x ? Direction::kWest : Direction::kEast;
+  }
+
+  if( RoomAt(rm_1).TryDirectionCheck(wall_1).Value() != RoomBorder::kRoom )
+  {
+    return Status( ErrorCode::kLogicError, "Error: DisconnectRooms() was "\
+      "given two Rooms which are not connected.\n" );
+  }
+
+  // Connected walls are broken on both sides and are not the exit
+  RoomAt(rm_1).TryBuildWall(wall_1);
+  RoomAt(rm_2).TryBuildWall(wall_2);
+
+  for( LabyrinthListener* const listener : listeners_ )
+  {
+    listener->RoomsDisconnected( rm_1, rm_2 );
+  }
+  return Status();
+}
+
+// This method sets the primary spawn Room as SetSpawn1() does, returning
+// the error instead of throwing it.
+Status Labyrinth::TrySetSpawn1( const Coordinate rm )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: SetSpawn1() was given an "\
-      "invalid Coordinate.\n" );
+    return Status( ErrorCode::kDomainError, "Error: SetSpawn1() was given "\
+      "an invalid Coordinate.\n" );
   }
 
   spawn_1_ = rm;
-  return;
+  return Status();
 }
 
-
-// This method sets the secondary spawn Room.
-// Spawns can be changed at any time.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-void Labyrinth::SetSpawn2( const Coordinate rm )
+// This method sets the secondary spawn Room as SetSpawn2() does,
+// returning the error instead of throwing it.
+Status Labyrinth::TrySetSpawn2( const Coordinate rm )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: SetSpawn2() was given an "\
-      "invalid Coordinate.\n" );
+    return Status( ErrorCode::kDomainError, "Error: SetSpawn2() was given "\
+      "an invalid Coordinate.\n" );
   }
 
   spawn_2_ = rm;
-  return;
+  return Status();
 }
 
-// This method sets the exit of the Labyrinth on a Wall.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   The Direction is invalid (kNone) (invalid_argument)
-//   The Direction has another Room (invalid_argument)
-//   The Exit has already been set (logic_error)
-void Labyrinth::SetExit( const Coordinate rm, const Direction d )
+// This method sets the exit of the Labyrinth as SetExit() does, returning
+// the error instead of throwing it.
+Status Labyrinth::TrySetExit( const Coordinate rm, const Direction d )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: SetExit() was given an "\
+    return Status( ErrorCode::kDomainError, "Error: SetExit() was given an "\
       "invalid Coordinate.\n" );
   }
   else if( d == Direction::kNone )
   {
-    throw std::invalid_argument( "Error: SetExit() was given an "\
-      "invalid direction (kNone).\n" );
+    return Status( ErrorCode::kInvalidArgument, "Error: SetExit() was given "\
+      "an invalid direction (kNone).\n" );
   }
 
-  auto rb = RoomBorder::kRoom;
-  try
-  {
-    rb = RoomAt(rm).DirectionCheck(d);
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
-  if (rb == RoomBorder::kRoom)
+  if( RoomAt(rm).TryDirectionCheck(d).Value() == RoomBorder::kRoom )
   {
-    throw std::invalid_argument( "Error: SetExit() was given a "\
-      "direction with a Room, not a Wall.\n" );
+    return Status( ErrorCode::kInvalidArgument, "Error: SetExit() was given "\
+      "a direction with a Room, not a Wall.\n" );
   }
 
   if( exit_set_ )
   {
-    throw std::logic_error( "Error: SetExit() was called when an exit "\
-      "already exists.\n" );
+    return Status( ErrorCode::kLogicError, "Error: SetExit() was called "\
+      "when an exit already exists.\n" );
   }
 
-  try
-  {
-    RoomAt(rm).CreateExit(d);
-  }
-  catch( const std::exception& e )
+  const Status created = RoomAt(rm).TryCreateExit(d);
+  if( !created.IsOk() )
   {
-    std::cout << e.what();
-    return;
+    return created;
   }
 
   exit_set_ = true;
-  return;
+  NotifyRoomChanged( rm );
+  return Status();
 }
 
-// This method places an Inhabitant in a Room.
-// Cannot change an existing Inhabitant; use the EnemyAttacked() method
-// for that.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   Inhabitant inh is a null Inhabitant (i.e. Inhabitant::kNone)
-//     (invalid_argument)
-//   The Inhabitant of the Room has already been set (logic_error)
-void Labyrinth::SetInhabitant( const Coordinate rm, const Inhabitant inh )
+// This method places an Inhabitant in a Room as SetInhabitant() does,
+// returning the error instead of throwing it.
+Status Labyrinth::TrySetInhabitant( const Coordinate rm,
+                                    const Inhabitant inh )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: SetInhabitant() was given an "\
-      "invalid Coordinate.\n" );
+    return Status( ErrorCode::kDomainError, "Error: SetInhabitant() was "\
+      "given an invalid Coordinate.\n" );
   }
   else if( inh == Inhabitant::kNone )
   {
-    throw std::invalid_argument( "Error: SetInhabitant() was given a null "\
-      "Inhabitant.\n" );
+    return Status( ErrorCode::kInvalidArgument, "Error: SetInhabitant() was "\
+      "given a null Inhabitant.\n" );
   }
   else if( RoomAt(rm).GetInhabitant() != Inhabitant::kNone )
   {
-    throw std::logic_error( "Error: SetInhabitant() cannot replace an "\
-      "existing Inhabitant; EnemyAttacked() should be used instead.\n" );
+    return Status( ErrorCode::kLogicError, "Error: SetInhabitant() cannot "\
+      "replace an existing Inhabitant; EnemyAttacked() should be used "\
+      "instead.\n" );
   }
 
   RoomAt(rm).SetInhabitant(inh);
-  return;
+  NotifyRoomChanged( rm );
+  return Status();
 }
 
-// This method places an Item in a Room.
-// Cannot change an existing Item; use the TakeItem() method for that.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   Item itm is a null Item (i.e. Item::kNone) (invalid_argument)
-//   The Item of the Room has already been set (logic_error)
-//   Item itm is a Treasure but the Treasure has already been placed
-//     in another room (logic_error)
-void Labyrinth::SetItem( const Coordinate rm, const Item itm )
+// This method places an Item in a Room as SetItem() does, returning the
+// error instead of throwing it.
+Status Labyrinth::TrySetItem( const Coordinate rm, const Item itm )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error("Error: SetItem() was given an invalid "\
-      "Coordinate.\n");
+    return Status( ErrorCode::kDomainError, "Error: SetItem() was given an "\
+      "invalid Coordinate.\n" );
   }
   else if( itm == Item::kNone )
   {
-    throw std::invalid_argument( "Error: SetItem() was given an invalid "\
-      "Item.\n" );
+    return Status( ErrorCode::kInvalidArgument, "Error: SetItem() was given "\
+      "an invalid Item.\n" );
   }
   else if( RoomAt(rm).GetItem() != Item::kNone )
   {
-    throw std::logic_error("Error: SetItem() cannot replace an existing "\
-      "Item.\n");
+    return Status( ErrorCode::kLogicError, "Error: SetItem() cannot replace "\
+      "an existing Item.\n" );
   }
   else if( itm == Item::kTreasure && treasure_set_ )
   {
-    throw std::logic_error( "Error: SetItem() was given a Treasure, "\
-      "but the Treasure has already been set in the Labyrinth.\n" );
-  }
-
-  try
-  {
-    RoomAt(rm).SetItem(itm);
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
+    return Status( ErrorCode::kLogicError, "Error: SetItem() was given a "\
+      "Treasure, but the Treasure has already been set in the "\
+      "Labyrinth.\n" );
   }
 
+  RoomAt(rm).SetItem(itm);
   if( itm == Item::kTreasure )
   {
     treasure_set_ = true;
   }
+  NotifyRoomChanged( rm );
+  return Status();
 }
 
-// PLAY:
-
-// This method returns the current Inhabitant of the Room.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-Inhabitant Labyrinth::GetInhabitant( const Coordinate rm ) const
+// This method returns the current Inhabitant of the Room as
+// GetInhabitant() does, returning the error instead of throwing it.
+Expected<Inhabitant> Labyrinth::TryGetInhabitant( const Coordinate rm ) const
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: GetInhabitant() was given a "\
-      "Coordinate outside of the Labyrinth.\n" );
+    return Status( ErrorCode::kDomainError, "Error: GetInhabitant() was "\
+      "given a Coordinate outside of the Labyrinth.\n" );
   }
   return RoomAt(rm).GetInhabitant();
 }
 
-// This method attacks the Inhabitant of the Room, and sets the resultant
-// Inhabitant.
-// The bullet is not removed from the Player.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   There is no enemy to attack (i.e. Inhabitant::kNone, dead Minotaur,
-//     or cracked Mirror) (invalid_argument)
-void Labyrinth::AttackEnemy( const Coordinate rm )
+// This method attacks the Inhabitant of the Room as AttackEnemy() does,
+// returning the error instead of throwing it.
+Status Labyrinth::TryAttackEnemy( const Coordinate rm )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: AttackEnemy() was given an invalid "\
-      "Coordinate.\n" );
-  }
-
-  auto inh = Inhabitant::kNone;
-  try
-  {
-    inh = RoomAt(rm).GetInhabitant();
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
+    return Status( ErrorCode::kDomainError, "Error: AttackEnemy() was given "\
+      "an invalid Coordinate.\n" );
   }
 
-  switch( inh )
+  switch( RoomAt(rm).GetInhabitant() )
   {
     case Inhabitant::kNone:
-      throw std::invalid_argument( "Error: AttackEnemy() was given a "\
-        "Coordinate with an invalid Inhabitant (kNone).\n" );
-      break;
+      return Status( ErrorCode::kInvalidArgument, "Error: AttackEnemy() was "\
+        "given a Coordinate with an invalid Inhabitant (kNone).\n" );
 
     case Inhabitant::kMinotaurDead:
-      throw std::invalid_argument( "Error: AttackEnemy() was given a "\
-        "Coordinate with an invalid Inhabitant (a dead Minotaur).\n" );
-      break;
+      return Status( ErrorCode::kInvalidArgument, "Error: AttackEnemy() was "\
+        "given a Coordinate with an invalid Inhabitant (a dead "\
+        "Minotaur).\n" );
 
     case Inhabitant::kMirrorCracked:
-      throw std::invalid_argument( "Error: AttackEnemy() was given a "\
-        "Coordinate with an invalid Inhabitant (a cracked mirror).\n" );
-      break;
+      return Status( ErrorCode::kInvalidArgument, "Error: AttackEnemy() was "\
+        "given a Coordinate with an invalid Inhabitant (a cracked "\
+        "mirror).\n" );
 
     // Actual code, not error-checking
     case Inhabitant::kMinotaur:
-      try
-      {
-        RoomAt(rm).SetInhabitant(Inhabitant::kMinotaurDead);
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-        return;
-      }
+      RoomAt(rm).SetInhabitant(Inhabitant::kMinotaurDead);
       break;
 
     case Inhabitant::kMirror:
-      try
-      {
-        RoomAt(rm).SetInhabitant(Inhabitant::kMirrorCracked);
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-        return;
-      }
+      RoomAt(rm).SetInhabitant(Inhabitant::kMirrorCracked);
       break;
   }
+  NotifyRoomChanged( rm );
+  return Status();
 }
 
-// This method returns the current Item in the given Room, but does not
-// change it.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-Item Labyrinth::ItemAt( const Coordinate rm ) const
+// This method returns the current Item in the given Room as ItemAt()
+// does, returning the error instead of throwing it.
+Expected<Item> Labyrinth::TryItemAt( const Coordinate rm ) const
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: ItemAt() was given a "\
+    return Status( ErrorCode::kDomainError, "Error: ItemAt() was given a "\
       "Coordinate outside of the Labyrinth.\n" );
   }
   return RoomAt(rm).GetItem();
 }
 
-// This method takes the Item from the Room.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   There is no Item to take (i.e. Item::kNone or Item taken already)
-//     (logic_error)
-void Labyrinth::TakeItem( const Coordinate rm )
+// This method takes the Item from the Room as TakeItem() does, returning
+// the error instead of throwing it.
+Status Labyrinth::TryTakeItem( const Coordinate rm )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: TakeItem() was given an "\
+    return Status( ErrorCode::kDomainError, "Error: TakeItem() was given an "\
       "invalid Coordinate.\n" );
   }
 
-  auto itm = Item::kNone;
-
-  try
-  {
-    itm = RoomAt(rm).GetItem();
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
-
   auto itm_new = Item::kNone;
 
-  switch( itm )
+  switch( RoomAt(rm).GetItem() )
   {
     case Item::kNone:
-      throw std::logic_error( "Error: TakeItem() cannot take "\
+      return Status( ErrorCode::kLogicError, "Error: TakeItem() cannot take "\
         "no item (kNone).\n" );
-      break;
 
     case Item::kTreasureGone:
-      throw std::logic_error( "Error: TakeItem() attempted to take "\
-        "the Treasure, but the Treasure is gone from this Room.\n" );
-      break;
+      return Status( ErrorCode::kLogicError, "Error: TakeItem() attempted to "\
+        "take the Treasure, but the Treasure is gone from this Room.\n" );
 
     case Item::kBullet:
       itm_new = Item::kNone;
@@ -475,129 +837,353 @@ void Labyrinth::TakeItem( const Coordinate rm )
       break;
   }
 
-  try
-  {
-    RoomAt(rm).SetItem(itm_new);
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
-
-  // treasure_set_ is not changed upon failure in the try/catch block.
+  RoomAt(rm).SetItem(itm_new);
   if( itm_new == Item::kTreasureGone )
   {
     treasure_set_ = false;
   }
+  NotifyRoomChanged( rm );
+  return Status();
 }
 
-// This method drops the Treasure in the given Room.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   The Treasure has already been set in another Room (logic_error)
-void Labyrinth::DropTreasure( const Coordinate rm )
+// This method drops the Treasure in the given Room as DropTreasure()
+// does, returning the error instead of throwing it.
+Status Labyrinth::TryDropTreasure( const Coordinate rm )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: DropTreasure() was given an "\
-      "invalid Coordinate\n." );
+    return Status( ErrorCode::kDomainError, "Error: DropTreasure() was "\
+      "given an invalid Coordinate\n." );
   }
   else if( treasure_set_ )
   {
-    throw std::logic_error( "Error: DropTreasure() was called when the "
-      "Treasure was already set in a Room of the Labyrinth.\n" );
+    return Status( ErrorCode::kLogicError, "Error: DropTreasure() was "\
+      "called when the Treasure was already set in a Room of the "\
+      "Labyrinth.\n" );
   }
 
-  try
+  RoomAt(rm).SetItem(Item::kTreasure);
+  treasure_set_ = true;
+  NotifyRoomChanged( rm );
+  return Status();
+}
+
+// This method returns the type of RoomBorder in the given direction as
+// DirectionCheck() does, returning the error instead of throwing it.
+Expected<RoomBorder> Labyrinth::TryDirectionCheck( const Coordinate rm,
+                                                   const Direction d ) const
+{
+  if( !WithinBounds(rm) )
   {
-    RoomAt(rm).SetItem(Item::kTreasure);
+    return Status( ErrorCode::kDomainError, "Error: DirectionCheck() was "\
+      "given a Coordinate outside of the Labyrinth.\n" );
   }
-  catch( const std::exception& e )
+  else if( d == Direction::kNone )
   {
-    std::cout << e.what();
-    return;
+    return Status( ErrorCode::kInvalidArgument, "Error: DirectionCheck() "\
+      "was given an invalid direction (kNone).\n" );
   }
 
-  treasure_set_ = true;  // Not modified upon failure of try/catch block
+  return RoomAt(rm).TryDirectionCheck(d);
 }
 
-// This method returns the type of RoomBorder in the given direction.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   Direction d is kNone (invalid_argument)
-RoomBorder Labyrinth::DirectionCheck( const Coordinate rm,
-                                      const Direction d ) const
+// This method returns the open Directions of the Room as OpenMask()
+// does, returning the error instead of throwing it.
+Expected<unsigned char> Labyrinth::TryOpenMask( const Coordinate rm ) const
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: DirectionCheck() was given a "\
+    return Status( ErrorCode::kDomainError, "Error: OpenMask() was given a "\
       "Coordinate outside of the Labyrinth.\n" );
   }
-  else if( d == Direction::kNone )
+
+  return RoomAt(rm).OpenMask();
+}
+
+// This method sets the cost of entering the given Room as
+// SetRoomWeight() does, returning the error instead of throwing it.
+Status Labyrinth::TrySetRoomWeight( const Coordinate rm,
+                                    const unsigned char weight )
+{
+  if( !WithinBounds(rm) )
+  {
+    return Status( ErrorCode::kDomainError, "Error: SetRoomWeight() was "\
+      "given an invalid Coordinate.\n" );
+  }
+  else if( weight == 0 )
   {
-    throw std::invalid_argument( "Error: DirectionCheck() was given an "\
-      "invalid direction (kNone).\n" );
+    return Status( ErrorCode::kInvalidArgument, "Error: SetRoomWeight() was "\
+      "given a weight of 0.\n" );
   }
 
-  return RoomAt(rm).DirectionCheck(d);
+  if( !weights_ )
+  {
+    weights_ = std::make_unique<unsigned char[]>( x_size_ * y_size_ );
+    std::fill( weights_.get(), weights_.get() + x_size_ * y_size_, 1 );
+  }
+  weights_[rm.y * x_size_ + rm.x] = weight;
+  return Status();
 }
 
-// PRIVATE METHODS:
+// This method returns the cost of entering the given Room as
+// GetRoomWeight() does, returning the error instead of throwing it.
+Expected<unsigned char>
+Labyrinth::TryGetRoomWeight( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    return Status( ErrorCode::kDomainError, "Error: GetRoomWeight() was "\
+      "given a Coordinate outside of the Labyrinth.\n" );
+  }
+  return static_cast<unsigned char>(
+    weights_ ? weights_[rm.y * x_size_ + rm.x] : 1 );
+}
 
-// This private method returns a reference to the Room at the given
-// coordinate.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-Room& Labyrinth::RoomAt( const Coordinate rm ) const
+// This method returns the RoomId of the given Room as GetRoomId() does,
+// returning the error instead of throwing it.
+Expected<RoomId> Labyrinth::TryGetRoomId( const Coordinate rm ) const
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: RoomAt() was given an invalid "\
-      "coordinate for rm.\n" );
+    return Status( ErrorCode::kDomainError, "Error: GetRoomId() was given a "\
+      "Coordinate outside of the Labyrinth.\n" );
   }
-  return rooms_[rm.y][rm.x];
+  return static_cast<RoomId>( rm.y * x_size_ + rm.x );
 }
 
-// This private method returns true if the Room is within the bounds of
-// the Labyrinth, and false otherwise.
-bool Labyrinth::WithinBounds( const Coordinate rm ) const
+// This method returns the Coordinate of the Room with the given RoomId as
+// GetCoordinate() does, returning the error instead of throwing it.
+Expected<Coordinate> Labyrinth::TryGetCoordinate( const RoomId id ) const
 {
-  return( rm.x < x_size_ && rm.y < y_size_ );
+  if( id >= x_size_ * y_size_ )
+  {
+    return Status( ErrorCode::kDomainError, "Error: GetCoordinate() was "\
+      "given a RoomId outside of the Labyrinth.\n" );
+  }
+  return Coordinate( id % x_size_, id / x_size_ );
 }
 
-// This private method returns true if the two Rooms are adjacent, and
-// false otherwise.
-// An exception is thrown if:
-//   One or both Rooms are outside the Labyrinth (domain_error)
-//   The same Room is given twice (logic_error)
-bool Labyrinth::IsAdjacent( const Coordinate rm_1, const Coordinate rm_2 ) const
+// This method finds the Rooms within radius steps of rm as RoomsWithin()
+// does, returning the error instead of throwing it.
+Status Labyrinth::TryRoomsWithin( const Coordinate rm,
+                                  const size_t radius,
+                                  VisitStamps& stamps,
+                                  Neighbourhood& out ) const
 {
-  if( !WithinBounds(rm_1) )
+  if( !WithinBounds(rm) )
   {
-    if( !WithinBounds(rm_2) )
+    return Status( ErrorCode::kDomainError, "Error: RoomsWithin() was given "\
+      "a Coordinate outside of the Labyrinth.\n" );
+  }
+
+  const size_t num_rooms = x_size_ * y_size_;
+  if( stamps.stamps.size() < num_rooms )
+  {
+    stamps.stamps.resize( num_rooms, 0 );
+  }
+  if( ++stamps.generation == 0 )
+  {
+    // Every old stamp could now match, so they are cleared once per 2^32
+    // queries
+    std::fill( stamps.stamps.begin(), stamps.stamps.end(), 0 );
+    stamps.generation = 1;
+  }
+  const uint32_t generation = stamps.generation;
+
+  // The rooms found so far are also the queue: the ring being expanded is
+  // rooms[ring_start] up to rooms[ring_end]
+  out.rooms.clear();
+  out.ring_starts.clear();
+  const RoomId start = static_cast<RoomId>( rm.y * x_size_ + rm.x );
+  stamps.stamps[start] = generation;
+  out.rooms.push_back( start );
+  out.ring_starts.push_back( 0 );
+
+  const RoomId x_size = static_cast<RoomId>( x_size_ );
+  size_t ring_start = 0;
+  for( size_t d = 0; d < radius; ++d )
+  {
+    const size_t ring_end = out.rooms.size();
+    for( size_t i = ring_start; i < ring_end; ++i )
     {
-      throw std::domain_error( "Error: IsAdjacent() was given invalid "\
-      "coordinates for both rm_1 and rm_2.\n" );
+      const RoomId id = out.rooms[i];
+      const unsigned char mask = rooms_[id / x_size][id % x_size].OpenMask();
+
+      // North, east, south and west, as in OpenMask()
+      const RoomId neighbours[4] = { id - x_size, id + 1, id + x_size, id - 1 };
+      for( unsigned char bit = 0; bit < 4; ++bit )
+      {
+        if( (mask >> bit & 1) && stamps.stamps[neighbours[bit]] != generation )
+        {
+          stamps.stamps[neighbours[bit]] = generation;
+          out.rooms.push_back( neighbours[bit] );
+        }
+      }
     }
-    else
+    if( out.rooms.size() == ring_end )
     {
-      throw std::domain_error( "Error: IsAdjacent() was given an invalid "\
-      "coordinate for rm_1.\n" );
+      break;  // Every reachable Room has been found
     }
+    out.ring_starts.push_back( static_cast<uint32_t>(ring_end) );
+    ring_start = ring_end;
+  }
+  out.ring_starts.push_back( static_cast<uint32_t>(out.rooms.size()) );
+  return Status();
+}
+
+// This method reads many Rooms as GatherRooms() does, returning the
+// error instead of throwing it.
+Status Labyrinth::TryGatherRooms( const Coordinate* const rooms,
+                                  const size_t count,
+                                  Inhabitant* const inhabitants,
+                                  Item* const items,
+                                  unsigned char* const masks ) const
+{
+  if( rooms == nullptr && count != 0 )
+  {
+    return Status( ErrorCode::kInvalidArgument, "Error: GatherRooms() was "\
+      "given an invalid (null) pointer for the Rooms.\n" );
+  }
+
+  // Checked in one pass first, so the reads below need no checks and
+  // nothing is written when a Room is invalid
+  bool within_bounds = true;
+  for( size_t i = 0; i < count; ++i )
+  {
+    within_bounds &= rooms[i].x < x_size_ && rooms[i].y < y_size_;
+  }
+  if( !within_bounds )
+  {
+    return Status( ErrorCode::kDomainError, "Error: GatherRooms() was given "\
+      "a Coordinate outside of the Labyrinth.\n" );
+  }
+
+  const size_t prefetched = count >= kPrefetchMinimum ?
+                            count - kPrefetchDistance : 0;
+  size_t i = 0;
+  for( ; i < prefetched; ++i )
+  {
+    PrefetchRoom( &RoomAt(rooms[i + kPrefetchDistance]) );
+    GatherRoom( RoomAt(rooms[i]), i, inhabitants, items, masks );
+  }
+  for( ; i < count; ++i )
+  {
+    GatherRoom( RoomAt(rooms[i]), i, inhabitants, items, masks );
+  }
+  return Status();
+}
+
+// This method reads many Rooms by RoomId as GatherRooms() does,
+// returning the error instead of throwing it.
+Status Labyrinth::TryGatherRooms( const RoomId* const ids,
+                                  const size_t count,
+                                  Inhabitant* const inhabitants,
+                                  Item* const items,
+                                  unsigned char* const masks ) const
+{
+  if( ids == nullptr && count != 0 )
+  {
+    return Status( ErrorCode::kInvalidArgument, "Error: GatherRooms() was "\
+      "given an invalid (null) pointer for the RoomIds.\n" );
+  }
+
+  const size_t num_rooms = x_size_ * y_size_;
+  bool within_bounds = true;
+  for( size_t i = 0; i < count; ++i )
+  {
+    within_bounds &= ids[i] < num_rooms;
+  }
+  if( !within_bounds )
+  {
+    return Status( ErrorCode::kDomainError, "Error: GatherRooms() was given "\
+      "a RoomId outside of the Labyrinth.\n" );
+  }
+
+  const size_t prefetched = count >= kPrefetchMinimum ?
+                            count - kPrefetchDistance : 0;
+  size_t i = 0;
+  for( ; i < prefetched; ++i )
+  {
+    const RoomId ahead = ids[i + kPrefetchDistance];
+    PrefetchRoom( &rooms_[ahead / x_size_][ahead % x_size_] );
+    GatherRoom( rooms_[ids[i] / x_size_][ids[i] % x_size_], i,
+                inhabitants, items, masks );
+  }
+  for( ; i < count; ++i )
+  {
+    GatherRoom( rooms_[ids[i] / x_size_][ids[i] % x_size_], i,
+                inhabitants, items, masks );
+  }
+  return Status();
+}
+
+// This method replaces the complete state of the Labyrinth as
+// RestoreSnapshot() does, returning the error instead of throwing it.
+Status Labyrinth::TryRestoreSnapshot( const LabyrinthSnapshot& s )
+{
+  if( s.x_size != x_size_ || s.y_size != y_size_ )
+  {
+    return Status( ErrorCode::kDomainError, "Error: RestoreSnapshot() was "\
+      "given a snapshot of a Labyrinth with different sizes.\n" );
+  }
+  else if( s.rooms.size() != x_size_ * y_size_ )
+  {
+    return Status( ErrorCode::kLogicError, "Error: RestoreSnapshot() was "\
+      "given a snapshot with the wrong number of Rooms.\n" );
   }
-  else if( !WithinBounds(rm_2) )
+
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    std::copy( s.rooms.begin() + y * x_size_,
+               s.rooms.begin() + (y + 1) * x_size_,
+               rooms_[y].get() );
+  }
+
+  spawn_1_ = s.spawn_1;
+  spawn_2_ = s.spawn_2;
+  exit_set_ = s.exit_set;
+  treasure_set_ = s.treasure_set;
+
+  for( LabyrinthListener* const listener : listeners_ )
   {
-    throw std::domain_error( "Error: IsAdjacent() was given an invalid "\
-      "coordinate for rm_2.\n" );
+    listener->LabyrinthReset();
   }
+  return Status();
+}
 
-  if( rm_1 == rm_2 )
+// This method registers a LabyrinthListener as AddListener() does,
+// returning the error instead of throwing it.
+Status Labyrinth::TryAddListener( LabyrinthListener* const listener ) const
+{
+  if( listener == nullptr )
   {
-    throw std::logic_error( "Error: IsAdjacent() was given the same "\
-      "coordinate for the Rooms.\n" );
+    return Status( ErrorCode::kInvalidArgument, "Error: AddListener() was "\
+      "given an invalid (null) pointer for the listener.\n" );
   }
+  listeners_.push_back( listener );
+  return Status();
+}
+
+// PRIVATE METHODS:
+
+// This private method returns a reference to the Room at the given
+// coordinate, which must be within the Labyrinth.
+Room& Labyrinth::RoomAt( const Coordinate rm ) const
+{
+  return rooms_[rm.y][rm.x];
+}
 
+// This private method returns true if the Room is within the bounds of
+// the Labyrinth, and false otherwise.
+bool Labyrinth::WithinBounds( const Coordinate rm ) const
+{
+  return( rm.x < x_size_ && rm.y < y_size_ );
+}
+
+// This private method returns true if the two Rooms are adjacent, and
+// false otherwise (including when the same Room is given twice).
+bool Labyrinth::IsAdjacent( const Coordinate rm_1, const Coordinate rm_2 ) const
+{
   size_t x_distance;
   if( rm_1.x > rm_2.x )
   {
@@ -625,3 +1211,13 @@ bool Labyrinth::IsAdjacent( const Coordinate rm_1, const Coordinate rm_2 ) const
   }
   return false;
 }
+
+// This private method notifies every listener that the contents of the
+// Room have changed.
+void Labyrinth::NotifyRoomChanged( const Coordinate rm ) const
+{
+  for( LabyrinthListener* const listener : listeners_ )
+  {
+    listener->RoomChanged( rm );
+  }
+}
@@ -0,0 +1,474 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementations of the LabyrinthConnectivity
+ * class, which answers whether two Rooms of a Labyrinth are connected while
+ * walls are both broken and rebuilt, and the EulerTourForest class.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_listener.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_connectivity.hpp"
+
+const uint32_t EulerTourForest::kNil_;
+
+// Parameterized constructor
+// Edges are numbered from 0 to num_edges - 1; each edge may be in the
+// forest at most once at a time.
+EulerTourForest::EulerTourForest( const uint32_t num_vertices,
+                                  const uint32_t num_edges ) :
+  num_vertices_(num_vertices)
+{
+  const size_t num_nodes = num_vertices + 2 * static_cast<size_t>(num_edges);
+  left_.resize( num_nodes );
+  right_.resize( num_nodes );
+  parent_.resize( num_nodes );
+  size_.resize( num_nodes );
+  vertices_.resize( num_nodes );
+
+  // A fixed seed keeps the shape of the treaps, and so the running time,
+  // the same from run to run
+  std::mt19937 rng( 0x5EED );
+  priority_.resize( num_nodes );
+  for( uint32_t& p : priority_ )
+  {
+    p = rng();
+  }
+
+  Clear();
+}
+
+// This method removes every edge.
+void EulerTourForest::Clear()
+{
+  for( uint32_t x = 0; x < left_.size(); ++x )
+  {
+    Reset( x );
+  }
+}
+
+// This method adds edge e between vertices u and v, which must be in
+// different trees.
+void EulerTourForest::Link( const uint32_t e,
+                            const uint32_t u,
+                            const uint32_t v )
+{
+  const uint32_t u_to_v = num_vertices_ + 2 * e;
+  const uint32_t v_to_u = u_to_v + 1;
+  Reset( u_to_v );
+  Reset( v_to_u );
+
+  // The tours become (u ...) (u, v) (v ...) (v, u)
+  Reroot( u );
+  Reroot( v );
+  const uint32_t tour = Merge( Merge(Merge(Root(u), u_to_v), Root(v)),
+                               v_to_u );
+  parent_[tour] = kNil_;
+}
+
+// This method removes edge e, which must be in the forest.
+void EulerTourForest::Cut( const uint32_t e )
+{
+  uint32_t first = num_vertices_ + 2 * e;
+  uint32_t second = first + 1;
+  uint32_t first_position = Position( first );
+  uint32_t second_position = Position( second );
+  if( first_position > second_position )
+  {
+    std::swap( first, second );
+    std::swap( first_position, second_position );
+  }
+
+  // The tour is (before) first (inside) second (after); the inside is one
+  // tree, and the before and after together are the other
+  uint32_t before, rest, arc, inside, after;
+  Split( Root(first), first_position, before, rest );
+  Split( rest, 1, arc, rest );
+  Split( rest, second_position - first_position - 1, inside, rest );
+  Split( rest, 1, arc, after );
+  const uint32_t outside = Merge( before, after );
+  if( outside != kNil_ )
+  {
+    parent_[outside] = kNil_;
+  }
+
+  Reset( first );
+  Reset( second );
+}
+
+// This method returns true if u and v are in the same tree, and false
+// otherwise.
+bool EulerTourForest::Connected( const uint32_t u, const uint32_t v ) const
+{
+  return Root( u ) == Root( v );
+}
+
+// This method returns the number of vertices in the tree of u.
+uint32_t EulerTourForest::TreeSize( const uint32_t u ) const
+{
+  return vertices_[Root(u)];
+}
+
+// This method replaces the contents of out with the vertices in the
+// tree of u.
+void EulerTourForest::TreeVertices( const uint32_t u,
+                                    std::vector<uint32_t>& out ) const
+{
+  out.clear();
+
+  // An in-order walk by parent pointers, which needs no stack
+  uint32_t x = Root( u );
+  while( left_[x] != kNil_ )
+  {
+    x = left_[x];
+  }
+  while( x != kNil_ )
+  {
+    if( x < num_vertices_ )
+    {
+      out.push_back( x );
+    }
+
+    if( right_[x] != kNil_ )
+    {
+      x = right_[x];
+      while( left_[x] != kNil_ )
+      {
+        x = left_[x];
+      }
+    }
+    else
+    {
+      while( parent_[x] != kNil_ && right_[parent_[x]] == x )
+      {
+        x = parent_[x];
+      }
+      x = parent_[x];
+    }
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method makes x a tree of its own.
+void EulerTourForest::Reset( const uint32_t x )
+{
+  left_[x] = kNil_;
+  right_[x] = kNil_;
+  parent_[x] = kNil_;
+  size_[x] = 1;
+  vertices_[x] = x < num_vertices_ ? 1 : 0;
+}
+
+// This private method recomputes the counts of x from its children.
+void EulerTourForest::Update( const uint32_t x )
+{
+  size_[x] = 1;
+  vertices_[x] = x < num_vertices_ ? 1 : 0;
+  for( const uint32_t child : {left_[x], right_[x]} )
+  {
+    if( child != kNil_ )
+    {
+      size_[x] += size_[child];
+      vertices_[x] += vertices_[child];
+      parent_[child] = x;
+    }
+  }
+}
+
+// This private method returns the root of the treap containing x.
+uint32_t EulerTourForest::Root( uint32_t x ) const
+{
+  while( parent_[x] != kNil_ )
+  {
+    x = parent_[x];
+  }
+  return x;
+}
+
+// This private method returns the position of x in its tour.
+uint32_t EulerTourForest::Position( uint32_t x ) const
+{
+  uint32_t position = left_[x] != kNil_ ? size_[left_[x]] : 0;
+  while( parent_[x] != kNil_ )
+  {
+    const uint32_t p = parent_[x];
+    if( right_[p] == x )
+    {
+      position += 1 + (left_[p] != kNil_ ? size_[left_[p]] : 0);
+    }
+    x = p;
+  }
+  return position;
+}
+
+// This private method joins two treaps, a before b, and returns the
+// root of the result.
+uint32_t EulerTourForest::Merge( const uint32_t a, const uint32_t b )
+{
+  if( a == kNil_ )
+  {
+    return b;
+  }
+  else if( b == kNil_ )
+  {
+    return a;
+  }
+
+  if( priority_[a] > priority_[b] )
+  {
+    right_[a] = Merge( right_[a], b );
+    Update( a );
+    return a;
+  }
+  left_[b] = Merge( a, left_[b] );
+  Update( b );
+  return b;
+}
+
+// This private method splits the treap t into its first k nodes, a,
+// and the rest, b.
+void EulerTourForest::Split( const uint32_t t,
+                             const uint32_t k,
+                             uint32_t& a,
+                             uint32_t& b )
+{
+  if( t == kNil_ )
+  {
+    a = kNil_;
+    b = kNil_;
+    return;
+  }
+
+  const uint32_t left_size = left_[t] != kNil_ ? size_[left_[t]] : 0;
+  if( k <= left_size )
+  {
+    uint32_t left;
+    Split( left_[t], k, a, left );
+    left_[t] = left;
+    Update( t );
+    b = t;
+  }
+  else
+  {
+    uint32_t right;
+    Split( right_[t], k - left_size - 1, right, b );
+    right_[t] = right;
+    Update( t );
+    a = t;
+  }
+
+  // Roots have no parent; a caller higher up re-attaches them
+  if( a != kNil_ )
+  {
+    parent_[a] = kNil_;
+  }
+  if( b != kNil_ )
+  {
+    parent_[b] = kNil_;
+  }
+}
+
+// This private method rotates the tour of the tree of vertex v to
+// begin at v.
+void EulerTourForest::Reroot( const uint32_t v )
+{
+  uint32_t before, after;
+  Split( Root(v), Position(v), before, after );
+  const uint32_t tour = Merge( after, before );
+  parent_[tour] = kNil_;
+}
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+LabyrinthConnectivity::LabyrinthConnectivity( const Labyrinth* const l ) :
+  l_(l),
+  x_size_(l != nullptr ? static_cast<uint32_t>(l->GetXSize()) : 0),
+  y_size_(l != nullptr ? static_cast<uint32_t>(l->GetYSize()) : 0),
+  num_east_edges_((x_size_ > 0 ? x_size_ - 1 : 0) * y_size_),
+  forest_(x_size_ * y_size_,
+          num_east_edges_ + x_size_ * (y_size_ > 0 ? y_size_ - 1 : 0)),
+  edges_(num_east_edges_ + x_size_ * (y_size_ > 0 ? y_size_ - 1 : 0),
+         Edge::kWall)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthConnectivity() was given "\
+      "an invalid (null) pointer for the Labyrinth.\n" );
+  }
+  half_.reserve( x_size_ * y_size_ );
+
+  LabyrinthReset();
+  l_->AddListener( this );
+}
+
+// Destructor
+// Stops listening to the Labyrinth.
+LabyrinthConnectivity::~LabyrinthConnectivity()
+{
+  l_->RemoveListener( this );
+}
+
+// This method returns true if there is a path between the two Rooms,
+// and false otherwise.
+// An exception is thrown if:
+//   A Room is outside the Labyrinth (domain_error)
+bool LabyrinthConnectivity::Connected( const Coordinate rm_1,
+                                       const Coordinate rm_2 ) const
+{
+  // GetRoomId() throws domain_error for a Room outside of the Labyrinth
+  return forest_.Connected( l_->GetRoomId(rm_1), l_->GetRoomId(rm_2) );
+}
+
+// This method returns the number of Rooms reachable from the given Room,
+// including itself.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+size_t LabyrinthConnectivity::ComponentSize( const Coordinate rm ) const
+{
+  return forest_.TreeSize( l_->GetRoomId(rm) );
+}
+
+// This method adds the connection between the two Rooms.
+void LabyrinthConnectivity::RoomsConnected( const Coordinate rm_1,
+                                            const Coordinate rm_2 )
+{
+  Insert( EdgeBetween(rm_1, rm_2), l_->GetRoomId(rm_1), l_->GetRoomId(rm_2) );
+}
+
+// This method removes the connection between the two Rooms, and finds
+// a replacement if it was part of the spanning forest.
+void LabyrinthConnectivity::RoomsDisconnected( const Coordinate rm_1,
+                                               const Coordinate rm_2 )
+{
+  const uint32_t e = EdgeBetween( rm_1, rm_2 );
+  const Edge removed = edges_[e];
+  edges_[e] = Edge::kWall;
+  if( removed != Edge::kTree )
+  {
+    return;
+  }
+
+  forest_.Cut( e );
+  const uint32_t u = l_->GetRoomId( rm_1 );
+  const uint32_t v = l_->GetRoomId( rm_2 );
+  const uint32_t small = forest_.TreeSize(u) <= forest_.TreeSize(v) ? u : v;
+
+  // Any spare leaving the smaller half must lead to the other half
+  forest_.TreeVertices( small, half_ );
+  for( const uint32_t rm : half_ )
+  {
+    uint32_t edges[4];
+    uint32_t rooms[4];
+    const uint32_t n = Incident( rm, edges, rooms );
+    for( uint32_t i = 0; i < n; ++i )
+    {
+      if( edges_[edges[i]] == Edge::kSpare &&
+          !forest_.Connected(rooms[i], small) )
+      {
+        forest_.Link( edges[i], rm, rooms[i] );
+        edges_[edges[i]] = Edge::kTree;
+        return;
+      }
+    }
+  }
+}
+
+// This method re-reads every connection of the Labyrinth.
+void LabyrinthConnectivity::LabyrinthReset()
+{
+  forest_.Clear();
+  std::fill( edges_.begin(), edges_.end(), Edge::kWall );
+
+  for( uint32_t y = 0; y < y_size_; ++y )
+  {
+    for( uint32_t x = 0; x < x_size_; ++x )
+    {
+      const Coordinate rm( x, y );
+      const uint32_t u = y * x_size_ + x;
+      const unsigned char open = l_->OpenMask( rm );
+      if( open & 2 )  // East
+      {
+        Insert( EdgeBetween(rm, Coordinate(x + 1, y)), u, u + 1 );
+      }
+      if( open & 4 )  // South
+      {
+        Insert( EdgeBetween(rm, Coordinate(x, y + 1)), u, u + x_size_ );
+      }
+    }
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the number of the edge between two
+// adjacent Rooms.
+uint32_t LabyrinthConnectivity::EdgeBetween( const Coordinate rm_1,
+                                             const Coordinate rm_2 ) const
+{
+  const size_t x = std::min( rm_1.x, rm_2.x );
+  const size_t y = std::min( rm_1.y, rm_2.y );
+  if( rm_1.y == rm_2.y )
+  {
+    return static_cast<uint32_t>( y * (x_size_ - 1) + x );
+  }
+  return static_cast<uint32_t>( num_east_edges_ + y * x_size_ + x );
+}
+
+// This private method adds edge e between Rooms u and v.
+void LabyrinthConnectivity::Insert( const uint32_t e,
+                                    const uint32_t u,
+                                    const uint32_t v )
+{
+  if( forest_.Connected(u, v) )
+  {
+    edges_[e] = Edge::kSpare;
+    return;
+  }
+  forest_.Link( e, u, v );
+  edges_[e] = Edge::kTree;
+}
+
+// This private method writes the edges of Room u into edges and the
+// Rooms across them into rooms, and returns how many there are.
+uint32_t LabyrinthConnectivity::Incident( const uint32_t u,
+                                          uint32_t edges[4],
+                                          uint32_t rooms[4] ) const
+{
+  const uint32_t x = u % x_size_;
+  const uint32_t y = u / x_size_;
+  uint32_t n = 0;
+  if( y > 0 )
+  {
+    edges[n] = num_east_edges_ + (y - 1) * x_size_ + x;
+    rooms[n++] = u - x_size_;
+  }
+  if( x + 1 < x_size_ )
+  {
+    edges[n] = y * (x_size_ - 1) + x;
+    rooms[n++] = u + 1;
+  }
+  if( y + 1 < y_size_ )
+  {
+    edges[n] = num_east_edges_ + y * x_size_ + x;
+    rooms[n++] = u + x_size_;
+  }
+  if( x > 0 )
+  {
+    edges[n] = y * (x_size_ - 1) + x - 1;
+    rooms[n++] = u - 1;
+  }
+  return n;
+}
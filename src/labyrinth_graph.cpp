@@ -0,0 +1,180 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementations of the LabyrinthCsrGraph and
+ * LabyrinthEdgeView classes, which present the connected Rooms of a
+ * Labyrinth as a graph.
+ *
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_graph.hpp"
+
+namespace
+{
+
+// This local function writes the RoomIds selected by an open mask of the
+// Room u into out, in the order north, east, south, west, and returns how
+// many there are.
+uint32_t MaskNeighbours( const unsigned char mask,
+                         const uint32_t u,
+                         const uint32_t x_size,
+                         uint32_t out[4] );
+
+// This local function writes the RoomIds selected by an open mask of the
+// Room u into out, in the order north, east, south, west, and returns how
+// many there are.
+uint32_t MaskNeighbours( const unsigned char mask,
+                         const uint32_t u,
+                         const uint32_t x_size,
+                         uint32_t out[4] )
+{
+  // Each neighbour is written unconditionally, and the count only moves
+  // past it if its bit is set
+  uint32_t n = 0;
+  out[n] = u - x_size;
+  n += mask & 1;
+  out[n] = u + 1;
+  n += (mask >> 1) & 1;
+  out[n] = u + x_size;
+  n += (mask >> 2) & 1;
+  out[n] = u - 1;
+  n += (mask >> 3) & 1;
+  return n;
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+LabyrinthCsrGraph::LabyrinthCsrGraph( const Labyrinth* const l ) :
+  l_(l)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthCsrGraph() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+  Rebuild();
+}
+
+// This method rebuilds the graph from the current Labyrinth.
+// The arrays are reused, so rebuilding does not allocate.
+void LabyrinthCsrGraph::Rebuild()
+{
+  const uint32_t x_size = static_cast<uint32_t>( l_->GetXSize() );
+  const uint32_t y_size = static_cast<uint32_t>( l_->GetYSize() );
+  const uint32_t num_nodes = x_size * y_size;
+
+  // A node has at most 4 neighbours, so the targets are sized for the
+  // worst case and trimmed afterwards, keeping the capacity
+  offsets_.resize( num_nodes + 1 );
+  targets_.resize( num_nodes * 4 );
+
+  uint32_t num_edges = 0;
+  uint32_t u = 0;
+  for( uint32_t y = 0; y < y_size; ++y )
+  {
+    for( uint32_t x = 0; x < x_size; ++x, ++u )
+    {
+      offsets_[u] = num_edges;
+      num_edges += MaskNeighbours( l_->OpenMask(Coordinate(x, y)),
+                                   u,
+                                   x_size,
+                                   &targets_[num_edges] );
+    }
+  }
+  offsets_[num_nodes] = num_edges;
+  targets_.resize( num_edges );
+}
+
+// This method returns the number of nodes.
+uint32_t LabyrinthCsrGraph::NumNodes() const
+{
+  return static_cast<uint32_t>( offsets_.size() - 1 );
+}
+
+// This method returns the number of edges, counting each direction.
+uint32_t LabyrinthCsrGraph::NumEdges() const
+{
+  return static_cast<uint32_t>( targets_.size() );
+}
+
+// This method writes the neighbours of node u into out, in the order
+// north, east, south, west, and returns how many there are.
+// An exception is thrown if:
+//   u is not a node of the graph (domain_error)
+uint32_t LabyrinthCsrGraph::Neighbours( const uint32_t u,
+                                        uint32_t out[4] ) const
+{
+  if( u >= NumNodes() )
+  {
+    throw std::domain_error( "Error: Neighbours() was given a node "\
+      "outside of the graph.\n" );
+  }
+
+  const uint32_t begin = offsets_[u];
+  const uint32_t end = offsets_[u + 1];
+  for( uint32_t i = begin; i < end; ++i )
+  {
+    out[i - begin] = targets_[i];
+  }
+  return end - begin;
+}
+
+// This method returns the NumNodes() + 1 row offsets into Targets().
+const uint32_t* LabyrinthCsrGraph::Offsets() const
+{
+  return offsets_.data();
+}
+
+// This method returns the NumEdges() neighbour node ids.
+const uint32_t* LabyrinthCsrGraph::Targets() const
+{
+  return targets_.data();
+}
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+LabyrinthEdgeView::LabyrinthEdgeView( const Labyrinth* const l ) :
+  l_(l)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthEdgeView() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+}
+
+// This method returns the number of nodes.
+uint32_t LabyrinthEdgeView::NumNodes() const
+{
+  return static_cast<uint32_t>( l_->GetXSize() * l_->GetYSize() );
+}
+
+// This method writes the neighbours of node u into out, in the order
+// north, east, south, west, and returns how many there are.
+// An exception is thrown if:
+//   u is not a node of the graph (domain_error)
+uint32_t LabyrinthEdgeView::Neighbours( const uint32_t u,
+                                        uint32_t out[4] ) const
+{
+  if( u >= NumNodes() )
+  {
+    throw std::domain_error( "Error: Neighbours() was given a node "\
+      "outside of the graph.\n" );
+  }
+
+  const uint32_t x_size = static_cast<uint32_t>( l_->GetXSize() );
+  const Coordinate rm( u % x_size, u / x_size );
+  return MaskNeighbours( l_->OpenMask(rm), u, x_size, out );
+}
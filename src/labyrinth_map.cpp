@@ -8,15 +8,98 @@
  *
  */
 
+#include <cstdint>
 #include <cstring>
 #include <iostream>
-#include <stdexcept>
 #include <string>
 
 #include "../include/room_properties.hpp"
+#include "../include/status.hpp"
+#include "../include/diagnostic_log.hpp"
 #include "../include/labyrinth.hpp"
 #include "../include/labyrinth_map.hpp"
 
+namespace
+{
+
+// A character as the bytes which encode it
+struct Glyph
+{
+  char bytes[4];
+  uint8_t size;
+};
+
+// The characters of a GlyphSet. Borders are indexed by which of their
+// walls exist: bit 0 north, bit 1 east, bit 2 south and bit 3 west.
+struct GlyphTable
+{
+  Glyph border[16];
+  Glyph bullet;
+};
+
+// Indexed by GlyphSet
+//
+// Characters taken from the Unicode section of:
+// https://en.wikipedia.org/wiki/Box-drawing_character
+// Code page 437 has no half lines, so those use whole lines instead.
+const GlyphTable kGlyphTables[] =
+{
+  // kUnicode
+  {
+    {
+      { " ", 1 },   { u8"╵", 3 }, { u8"╶", 3 }, { u8"└", 3 },
+      { u8"╷", 3 }, { u8"│", 3 }, { u8"┌", 3 }, { u8"├", 3 },
+      { u8"╴", 3 }, { u8"┘", 3 }, { u8"─", 3 }, { u8"┴", 3 },
+      { u8"┐", 3 }, { u8"┤", 3 }, { u8"┬", 3 }, { u8"┼", 3 },
+    },
+    { u8"•", 3 },
+  },
+
+  // kAscii
+  {
+    {
+      { " ", 1 }, { "|", 1 }, { "-", 1 }, { "+", 1 },
+      { "|", 1 }, { "|", 1 }, { "+", 1 }, { "+", 1 },
+      { "-", 1 }, { "+", 1 }, { "-", 1 }, { "+", 1 },
+      { "+", 1 }, { "+", 1 }, { "+", 1 }, { "+", 1 },
+    },
+    { "*", 1 },
+  },
+
+  // kCodePage437
+  {
+    {
+      { " ", 1 },    { "\xB3", 1 }, { "\xC4", 1 }, { "\xC0", 1 },
+      { "\xB3", 1 }, { "\xB3", 1 }, { "\xDA", 1 }, { "\xC3", 1 },
+      { "\xC4", 1 }, { "\xD9", 1 }, { "\xC4", 1 }, { "\xC1", 1 },
+      { "\xBF", 1 }, { "\xB4", 1 }, { "\xC2", 1 }, { "\xC5", 1 },
+    },
+    { "\xF9", 1 },
+  },
+};
+
+// Indices into GlyphTable::border
+const size_t kHorizontal  = 0xA;
+const size_t kVertical    = 0x5;
+const size_t kTopLeft     = 0x6;
+const size_t kTopRight    = 0xC;
+const size_t kBottomLeft  = 0x3;
+const size_t kBottomRight = 0x9;
+
+// This local function appends the glyph to out count times.
+void Append( std::string& out, const Glyph& g, const size_t count );
+
+// This local function appends the glyph to out count times.
+void Append( std::string& out, const Glyph& g, const size_t count )
+{
+  for( size_t i = 0; i < count; ++i )
+  {
+    out.append( g.bytes, g.size );
+  }
+}
+
+}  // Local namespace
+
 // This method returns whether a given Wall coordinate has a wall in the
 // given direction.
 // An exception is thrown if:
@@ -34,8 +117,8 @@ bool LabyrinthMapCoordinateBorder::IsWall( const Direction d ) const
     case Direction::kWest:
       return wall_west_;
     default:
-      throw std::invalid_argument( "Error: IsWall() was given an invalid " \
-        "direction (kNone).\n" );
+      RaiseError( Status(ErrorCode::kInvalidArgument, "Error: IsWall() was "\
+        "given an invalid direction (kNone).\n") );
   }
 }
 
@@ -63,8 +146,8 @@ void LabyrinthMapCoordinateBorder::SetWall( const Direction d,
       wall_west_ = exists;
       return;
     default:
-      throw std::invalid_argument( "Error: SetWall() was given an invalid "\
-        "direction (kNone).\n" );
+      RaiseError( Status(ErrorCode::kInvalidArgument, "Error: SetWall() was "\
+        "given an invalid direction (kNone).\n") );
   }
   return;
 }
@@ -111,43 +194,186 @@ void LabyrinthMapCoordinateRoom::SetItem( const Item i )
 }
 
 // Parameterized constructor
+// The map is drawn with the given glyph set, and reads the Labyrinth
+// with the given storage.
 // An exception is thrown if:
 //   l is null (invalid_argument)
 //   A size of 0 is given (domain_error)
 LabyrinthMap::LabyrinthMap( const Labyrinth* const l,
                             const size_t x_size,
-                            const size_t y_size ) :
+                            const size_t y_size,
+                            const GlyphSet glyphs,
+                            const MapStorage storage ) :
   l_(l),
   x_size_(x_size),
   y_size_(y_size),
+  glyphs_(glyphs),
+  storage_(storage),
   map_x_size_(x_size * 2 + 1),
   map_y_size_(y_size * 2 + 1)
+{
+  RaiseIfError( CheckArguments(l, x_size, y_size) );
+
+  // The map itself is only created when it is first displayed
+  l_->AddListener( this );
+}
+
+// This method returns the error which the constructor would throw for
+// the given arguments, so that they may be checked without exceptions.
+Status LabyrinthMap::CheckArguments( const Labyrinth* const l,
+                                     const size_t x_size,
+                                     const size_t y_size )
 {
   if( l == nullptr )
   {
-    throw std::invalid_argument( "Error: LabyrinthMap() was given an "\
-      "invalid (null) pointer for the Labyrinth.\n" );
+    return Status( ErrorCode::kInvalidArgument, "Error: LabyrinthMap() was "\
+      "given an invalid (null) pointer for the Labyrinth.\n" );
   }
   else if( x_size == 0 )
   {
     if( y_size == 0 )
     {
-      throw std::domain_error( "Error: LabyrinthMap() was given empty x and "\
-        "y sizes.\n" );
+      return Status( ErrorCode::kDomainError, "Error: LabyrinthMap() was "\
+        "given empty x and y sizes.\n" );
     }
     else
     {
-      throw std::domain_error( "Error: LabyrinthMap() was given an empty "\
-        "x size.\n" );
+      return Status( ErrorCode::kDomainError, "Error: LabyrinthMap() was "\
+        "given an empty x size.\n" );
     }
   }
   else if( y_size == 0 )
   {
-    throw std::domain_error( "Error: LabyrinthMap() was given an empty "\
-      "y size.\n" );
+    return Status( ErrorCode::kDomainError, "Error: LabyrinthMap() was "\
+      "given an empty y size.\n" );
+  }
+  return Status();
+}
+
+// Destructor
+// Stops listening to the Labyrinth.
+LabyrinthMap::~LabyrinthMap()
+{
+  l_->RemoveListener( this );
+}
+
+// This method displays a map of the current Labyrinth on std::cout.
+void LabyrinthMap::Display()
+{
+  StreamSink sink( std::cout );
+  Display( sink );
+}
+
+// This method writes a map of the current Labyrinth to the given sink,
+// as the axis labels, the map itself and the legend in one call to
+// OutputSink::WriteSegments().
+// An exception is thrown if:
+//   The sink cannot write the map (runtime_error)
+void LabyrinthMap::Display( OutputSink& sink )
+{
+  CreateMap();
+  if( changed_ && map_ != nullptr )
+  {
+    UpdateBorders();
+    UpdateRooms();
+    stale_.assign( y_size_, false );
+  }
+  changed_ = false;
+
+  // The labels and legend do not change, so they are only drawn once
+  if( header_.empty() )
+  {
+    LabelXAxis( header_ );
+    legend_ = "\n\n";
+    DisplayLegend( legend_ );
+  }
+
+  // Each row is its own segment, so unchanged rows are not copied
+  segments_.clear();
+  segments_.push_back( OutputSegment{ header_.data(), header_.size() } );
+  for( size_t y = 0; y < map_y_size_; ++y )
+  {
+    CachedRow& row = rows_[y];
+    if( row.version != row_versions_[y] )
+    {
+      row.bytes.clear();
+      DisplayRow( y, row.bytes );
+      row.version = row_versions_[y];
+    }
+    segments_.push_back( OutputSegment{ row.bytes.data(), row.bytes.size() } );
+  }
+  segments_.push_back( OutputSegment{ legend_.data(), legend_.size() } );
+
+  sink.WriteSegments( segments_.data(), segments_.size() );
+}
+
+// This method returns true if the map's copy of the Labyrinth has been
+// created, which is not done until it is first displayed, and never
+// with MapStorage::kView.
+bool LabyrinthMap::Allocated() const
+{
+  return map_ != nullptr;
+}
+
+// This method marks the rows around both Rooms as changed.
+void LabyrinthMap::RoomsConnected( const Coordinate rm_1,
+                                   const Coordinate rm_2 )
+{
+  MarkRoom( rm_1 );
+  MarkRoom( rm_2 );
+}
+
+// This method marks the rows around both Rooms as changed.
+void LabyrinthMap::RoomsDisconnected( const Coordinate rm_1,
+                                      const Coordinate rm_2 )
+{
+  MarkRoom( rm_1 );
+  MarkRoom( rm_2 );
+}
+
+// This method marks the rows around the Room as changed.
+void LabyrinthMap::RoomChanged( const Coordinate rm )
+{
+  MarkRoom( rm );
+}
+
+// This method marks every row as changed.
+void LabyrinthMap::LabyrinthReset()
+{
+  if( !created_ )
+  {
+    return;  // Everything is read when the map is created
+  }
+  for( uint32_t& version : row_versions_ )
+  {
+    ++version;
+  }
+  if( map_ != nullptr )
+  {
+    stale_.assign( y_size_, true );
+  }
+  changed_ = true;
+}
+
+// PRIVATE METHODS:
+
+// This private method creates the map from the Labyrinth, if it has not
+// been created yet. Only the rendered rows are created with
+// MapStorage::kView.
+void LabyrinthMap::CreateMap()
+{
+  if( created_ )
+  {
+    return;
+  }
+  created_ = true;
+  rows_.resize( map_y_size_ );
+  row_versions_.assign( map_y_size_, 1 );
+  if( storage_ == MapStorage::kView )
+  {
+    return;
   }
 
-  // Creation of the map array
   auto map_temp_1 = std::make_unique<
     std::unique_ptr<std::unique_ptr<LabyrinthMapCoordinate>[]>[]
   >(map_y_size_);
@@ -185,46 +411,107 @@ LabyrinthMap::LabyrinthMap( const Labyrinth* const l,
   }
 
   CleanBorders();
-  UpdateBorders();
-  UpdateRooms();
+
+  // Every row is read from the Labyrinth and drawn by Display()
+  stale_.assign( y_size_, true );
+  changed_ = true;
 }
 
-// This method displays a map of the current Labyrinth.
-void LabyrinthMap::Display()
+// This private method returns true if there is a wall on the west side
+// of the given Room, read from the Labyrinth.
+// x may be x_size, for the east side of the Labyrinth.
+bool LabyrinthMap::WallWestOf( const size_t x, const size_t y ) const
 {
-  UpdateBorders();
-  UpdateRooms();
+  // The outer wall is drawn whole, even where the exit is
+  return x == 0 || x == x_size_ ||
+         l_->DirectionCheck( Coordinate(x, y), Direction::kWest ) !=
+           RoomBorder::kRoom;
+}
 
-  LabelXAxis();
+// This private method returns true if there is a wall on the north side
+// of the given Room, read from the Labyrinth.
+// y may be y_size, for the south side of the Labyrinth.
+bool LabyrinthMap::WallNorthOf( const size_t x, const size_t y ) const
+{
+  return y == 0 || y == y_size_ ||
+         l_->DirectionCheck( Coordinate(x, y), Direction::kNorth ) !=
+           RoomBorder::kRoom;
+}
 
-  for( size_t y = 0; y < map_y_size_; ++y )
+// This private method returns the walls of the given Border Coordinate
+// as a mask, with bit 0 set for north, bit 1 for east, bit 2 for south
+// and bit 3 for west.
+unsigned LabyrinthMap::BorderWalls( const Coordinate c ) const
+{
+  if( map_ != nullptr )
   {
-    LabelYAxis( y );
-    for( size_t x = 0; x < map_x_size_; ++x )
-    {
-      Coordinate c(x, y);
-      if( IsRoom(c) )
-      {
-        std::cout << DisplayRoom(c);
-      }
-      else
-      {
-        std::cout << DisplayBorder(c);
+    const LabyrinthMapCoordinate& b = MapCoordinateAt(c);
+    return (b.IsWall( Direction::kNorth ) ? 1 : 0) |
+           (b.IsWall( Direction::kEast )  ? 2 : 0) |
+           (b.IsWall( Direction::kSouth ) ? 4 : 0) |
+           (b.IsWall( Direction::kWest )  ? 8 : 0);
+  }
 
-        // Doubles the horizontal draw distance of a Map Room (and the Borders
-        // directly above/below a Map Room) from 1 to 2 characters
-        if( x % 2 == 1 )
-        {
-          std::cout << DisplayBorder(c);
-        }
-      }
-    }
-    std::cout << std::endl;
+  // Borders between two Rooms only run between them; corners have an arm
+  // for each wall which meets there
+  const size_t x = c.x / 2;
+  const size_t y = c.y / 2;
+  if( c.x % 2 == 1 )
+  {
+    return WallNorthOf( x, y ) ? 0xA : 0;
+  }
+  else if( c.y % 2 == 1 )
+  {
+    return WallWestOf( x, y ) ? 0x5 : 0;
   }
+  return (y > 0 && WallWestOf( x, y - 1 ) ? 1 : 0) |
+         (x < x_size_ && WallNorthOf( x, y ) ? 2 : 0) |
+         (y < y_size_ && WallWestOf( x, y ) ? 4 : 0) |
+         (x > 0 && WallNorthOf( x - 1, y ) ? 8 : 0);
+}
 
-  std::cout << std::endl << std::endl;
-  DisplayLegend();
-  return;
+
+// This private method marks the Room's row as stale, and bumps the
+// versions of the map rows showing the Room and the Borders above and
+// below it.
+void LabyrinthMap::MarkRoom( const Coordinate rm )
+{
+  if( !created_ || rm.y >= y_size_ )
+  {
+    return;
+  }
+  if( map_ != nullptr )
+  {
+    stale_[rm.y] = true;
+  }
+
+  // The Border row below a Room also shows the corners of its east wall
+  for( size_t y = rm.y * 2; y <= rm.y * 2 + 2 && y < map_y_size_; ++y )
+  {
+    ++row_versions_[y];
+  }
+  changed_ = true;
+}
+
+// This private method appends the given row of the map to out.
+void LabyrinthMap::DisplayRow( const size_t y, std::string& out ) const
+{
+  LabelYAxis( y, out );
+  for( size_t x = 0; x < map_x_size_; ++x )
+  {
+    Coordinate c(x, y);
+    if( IsRoom(c) )
+    {
+      DisplayRoom( c, out );
+    }
+    else
+    {
+      // Doubles the horizontal draw distance of a Map Room (and the Borders
+      // directly above/below a Map Room) from 1 to 2 characters
+      DisplayBorder( c, x % 2 == 1 ? 2 : 1, out );
+    }
+  }
+  out += '\n';
 }
 
 // This private method returns true if the Coordinate is within the bounds
@@ -247,8 +534,8 @@ bool LabyrinthMap::IsRoom( const Coordinate c ) const
   }
   else
   {
-    throw std::domain_error( "Error: IsRoom() was given a Coordinate "\
-      "outside of the Map.\n" );
+    RaiseError( Status(ErrorCode::kDomainError, "Error: IsRoom() was given a "\
+      "Coordinate outside of the Map.\n") );
   }
 }
 
@@ -261,8 +548,8 @@ LabyrinthMap::MapCoordinateAt( const Coordinate c ) const
 {
   if( !WithinBoundsOfMap(c) )
   {
-    throw std::domain_error( "Error: MapCoordinateAt() was given a "\
-      "Coordinate outside of the Map.\n" );
+    RaiseError( Status(ErrorCode::kDomainError, "Error: MapCoordinateAt() was "\
+      "given a Coordinate outside of the Map.\n") );
   }
 
   return *(map_[c.y][c.x]);
@@ -282,8 +569,8 @@ void LabyrinthMap::LabyrinthToMap( Coordinate& c ) const
   }
   else
   {
-    throw std::invalid_argument( "Error: LabyrinthToMap() was given a "\
-      "Coordinate outside of the Labyrinth.\n" );
+    RaiseError( Status(ErrorCode::kInvalidArgument, "Error: LabyrinthToMap() "\
+      "was given a Coordinate outside of the Labyrinth.\n") );
   }
 }
 
@@ -296,13 +583,13 @@ void LabyrinthMap::MapToLabyrinth( Coordinate& c ) const
 {
   if( !WithinBoundsOfMap(c) )
   {
-    throw std::domain_error( "Error: MapToLabyrinth() was given a "\
-      "Coordinate outside of the LabyrinthMap.\n" );
+    RaiseError( Status(ErrorCode::kDomainError, "Error: MapToLabyrinth() was "\
+      "given a Coordinate outside of the LabyrinthMap.\n") );
   }
   else if( !IsRoom(c) )
   {
-    throw std::logic_error( "Error: MapToLabyrinth() was given a "\
-      "Coordinate designating a Border, not a Room.\n" );
+    RaiseError( Status(ErrorCode::kLogicError, "Error: MapToLabyrinth() was "\
+      "given a Coordinate designating a Border, not a Room.\n") );
   }
   else
   {
@@ -360,8 +647,8 @@ void LabyrinthMap::CleanBorders()
 
 }
 
-// This private method updates the Map Borders by checking the contents
-// of the Labyrinth.
+// This private method updates the Map Borders of the stale rows by
+// checking the contents of the Labyrinth.
 // Borders in the Map but not in the Labyrinth will be removed from
 // the Map; borders in the Labyrinth but not in the Map will not
 // be added to the Map.
@@ -370,35 +657,32 @@ void LabyrinthMap::UpdateBorders()
   // Loops through the Labyrinth, not the Map
   for( size_t y = 0; y < y_size_; ++y )
   {
+    if( !stale_[y] )
+    {
+      continue;
+    }
     for( size_t x = 0; x < x_size_; ++x )
     {
       Coordinate c_laby(x, y);
       Coordinate c_map = c_laby;
-      try
-      {
-        LabyrinthToMap(c_map);
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-      }
+      LabyrinthToMap(c_map);
       Coordinate c_edit_1 = c_map;
       Coordinate c_edit_2 = c_map;
       Coordinate c_edit_3 = c_map;
 
-      RoomBorder rb_east;
-      RoomBorder rb_south;
-      try
+      const Expected<RoomBorder> rb_east =
+        l_->TryDirectionCheck( c_laby, Direction::kEast );
+      const Expected<RoomBorder> rb_south =
+        l_->TryDirectionCheck( c_laby, Direction::kSouth );
+      if( !rb_east.HasValue() || !rb_south.HasValue() )
       {
-        rb_east  = l_->DirectionCheck( c_laby, Direction::kEast );
-        rb_south = l_->DirectionCheck( c_laby, Direction::kSouth );
+        Log( Severity::kError, rb_east.HasValue() ?
+                                 rb_south.Error().Message() :
+                                 rb_east.Error().Message() );
+        continue;
       }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-      }
-      const bool east_border = (rb_east != RoomBorder::kRoom) ? true : false;
-      const bool south_border = (rb_south != RoomBorder::kRoom) ? true : false;
+      const bool east_border = rb_east.Value() != RoomBorder::kRoom;
+      const bool south_border = rb_south.Value() != RoomBorder::kRoom;
 
       // Sets the east border of the relevant Map coordinate
       c_edit_1 = c_map;
@@ -412,17 +696,10 @@ void LabyrinthMap::UpdateBorders()
       (c_edit_3.x)++;
       (c_edit_3.y)++;
 
-      try
-      {
-        (MapCoordinateAt(c_edit_1)).SetWall( Direction::kSouth, east_border );
-        (MapCoordinateAt(c_edit_2)).SetWall( Direction::kNorth, east_border );
-        (MapCoordinateAt(c_edit_2)).SetWall( Direction::kSouth, east_border );
-        (MapCoordinateAt(c_edit_3)).SetWall( Direction::kNorth, east_border );
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-      }
+      (MapCoordinateAt(c_edit_1)).SetWall( Direction::kSouth, east_border );
+      (MapCoordinateAt(c_edit_2)).SetWall( Direction::kNorth, east_border );
+      (MapCoordinateAt(c_edit_2)).SetWall( Direction::kSouth, east_border );
+      (MapCoordinateAt(c_edit_3)).SetWall( Direction::kNorth, east_border );
 
       // Sets the south border of the relevant Map coordinate
       c_edit_1 = c_map;
@@ -436,58 +713,50 @@ void LabyrinthMap::UpdateBorders()
       (c_edit_3.y)++;
       (c_edit_3.x)++;
 
-      try
-      {
-        (MapCoordinateAt(c_edit_1)).SetWall( Direction::kEast, south_border );
-        (MapCoordinateAt(c_edit_2)).SetWall( Direction::kWest, south_border );
-        (MapCoordinateAt(c_edit_2)).SetWall( Direction::kEast, south_border );
-        (MapCoordinateAt(c_edit_3)).SetWall( Direction::kWest, south_border );
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-      }
+      (MapCoordinateAt(c_edit_1)).SetWall( Direction::kEast, south_border );
+      (MapCoordinateAt(c_edit_2)).SetWall( Direction::kWest, south_border );
+      (MapCoordinateAt(c_edit_2)).SetWall( Direction::kEast, south_border );
+      (MapCoordinateAt(c_edit_3)).SetWall( Direction::kWest, south_border );
 
     }  // For loop
   }  // For loop
 
 }
 
-// This private method updates the Map Rooms by checking the contents
-// of the Labyrinth.
+// This private method updates the Map Rooms of the stale rows by
+// checking the contents of the Labyrinth.
 void LabyrinthMap::UpdateRooms()
 {
   for( size_t y = 0; y < y_size_; ++y )
   {
+    if( !stale_[y] )
+    {
+      continue;
+    }
     for( size_t x = 0; x < x_size_; ++x )
     {
       Coordinate c_laby(x, y);
       Coordinate c_map = c_laby;
-      try
-      {
-        LabyrinthToMap(c_map);
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-      }
+      LabyrinthToMap(c_map);
 
-      try
+      const Expected<Inhabitant> inh = l_->TryGetInhabitant( c_laby );
+      if( inh.HasValue() )
       {
-        MapCoordinateAt(c_map).SetInhabitant( l_->GetInhabitant(c_laby) );
+        MapCoordinateAt(c_map).SetInhabitant( inh.Value() );
       }
-      catch( const std::exception& e )
+      else
       {
-        std::cout << e.what();
+        Log( Severity::kError, inh.Error().Message() );
       }
 
-      try
+      const Expected<Item> itm = l_->TryItemAt( c_laby );
+      if( itm.HasValue() )
       {
-        MapCoordinateAt(c_map).SetItem( l_->ItemAt(c_laby) );
+        MapCoordinateAt(c_map).SetItem( itm.Value() );
       }
-      catch( const std::exception& e )
+      else
       {
-        std::cout << e.what();
+        Log( Severity::kError, itm.Error().Message() );
       }
     }
   }
@@ -495,10 +764,10 @@ void LabyrinthMap::UpdateRooms()
   return;
 }
 
-// This private method displays the x-axis label as well as numbering
-// of the x-coordinates of Rooms.
+// This private method appends the x-axis label as well as numbering
+// of the x-coordinates of Rooms to out.
 // Only to be used by Display().
-void LabyrinthMap::LabelXAxis() const
+void LabyrinthMap::LabelXAxis( std::string& out ) const
 {
   // X label
   //
@@ -507,67 +776,60 @@ void LabyrinthMap::LabelXAxis() const
   // because the final map consists of Rooms which have 1 Border character
   // and 2 space characters.
   const size_t kXMiddle = (x_size_ * 3)/2 + 1;
-  for( size_t i = 0; i < kXMiddle; ++i )
-  {
-    std::cout << " ";
-  }
-  std::cout << "     ";  // Alignment with y-axis label
-  std::cout << "X" << std::endl << std::endl;
+  out.append( kXMiddle, ' ' );
+  out += "     ";  // Alignment with y-axis label
+  out += "X\n\n";
 
   // X-axis marks
-  std::cout << "     ";  // Alignment with y-axis label
+  out += "     ";  // Alignment with y-axis label
   for( size_t i = 0; i < x_size_; ++i )
   {
     if( i < 10 )  // Correcting for digit positions
     {
-      std::cout << " ";
+      out += ' ';
     }
-    std::cout << " " << i;
+    out += ' ';
+    out += std::to_string( i );
   }
-  std::cout << std::endl;
+  out += '\n';
 
   return;
 }
 
-// This private method displays numbering of the y-coordinates of a Room
+// This private method appends numbering of the y-coordinates of a Room
 // as well as the y-axis label (if in the correct position), or padding
-// if the row has no Rooms.
+// if the row has no Rooms, to out.
 // Only to be used by Display().
 // Should be called every time a row of the Map is printed.
-void LabyrinthMap::LabelYAxis( const size_t y ) const
+void LabyrinthMap::LabelYAxis( const size_t y, std::string& out ) const
 {
   // Y-axis label position
   const size_t kYMiddle = (y_size_)/2 + 1;
 
   // Y label
-  if( y == kYMiddle )
-  {
-    std::cout << "Y";
-  }
-  else
-  {
-    std::cout << " ";
-  }
+  out += y == kYMiddle ? 'Y' : ' ';
 
   // Numbers rows with Rooms
   if( y % 2 == 1 )
   {
     if( y < 10 )  // Correcting for digit positions
     {
-      std::cout << " ";
+      out += ' ';
     }
     Coordinate c(1, y);
     MapToLabyrinth(c);
-    std::cout << " " << c.y << " ";
+    out += ' ';
+    out += std::to_string( c.y );
+    out += ' ';
   }
   else
   {
-    std::cout << "    ";  // Alignment
+    out += "    ";  // Alignment
   }
 }
 
-// This private method returns characters with the contents of the
-// given Room Coordinate.
+// This private method appends characters with the contents of the
+// given Room Coordinate to out.
 // Legend of symbols:
 //   Inhabitants:
 //     None:
@@ -577,185 +839,138 @@ void LabyrinthMap::LabelYAxis( const size_t y ) const
 //     Mirror (cracked): 0
 //   Items:
 //     None:
-//     Bullet:   •
+//     Bullet:   • (* in ASCII)
 //     Treasure: T
 // An exception is thrown if:
 //   The Coordinate is outside of the Labyrinth (domain_error)
 //   The Coordinate designates a Border (logic_error)
-std::string LabyrinthMap::DisplayRoom( const Coordinate c ) const
+void LabyrinthMap::DisplayRoom( const Coordinate c, std::string& out ) const
 {
   if( !WithinBoundsOfMap(c) )
   {
-    throw std::domain_error( "Error: DisplayRoom() was given an invalid "\
-      "Coordinate.\n" );
+    RaiseError( Status(ErrorCode::kDomainError, "Error: DisplayRoom() was "\
+      "given an invalid Coordinate.\n") );
   }
   else if( !IsRoom(c) )
   {
-    throw std::logic_error( "Error: DisplayRoom() was given a "\
-      "Border Coordinate.\n" );
+    RaiseError( Status(ErrorCode::kLogicError, "Error: DisplayRoom() was "\
+      "given a Border Coordinate.\n") );
   }
 
-  std::string s;
-
   Inhabitant inh = Inhabitant::kNone;
-  try
+  Item itm = Item::kNone;
+  if( map_ != nullptr )
   {
     inh = MapCoordinateAt(c).GetInhabitant();
+    itm = MapCoordinateAt(c).ItemAt();
   }
-  catch( const std::exception& e )
+  else
   {
-    std::cout << e.what();
+    const Coordinate rm( (c.x - 1) / 2, (c.y - 1) / 2 );
+    inh = l_->GetInhabitant( rm );
+    itm = l_->ItemAt( rm );
   }
+
   switch( inh )
   {
     case Inhabitant::kMinotaur:
-      s += "M";
+      out += 'M';
       break;
     case Inhabitant::kMinotaurDead:
-      s += "m";
+      out += 'm';
       break;
     case Inhabitant::kMirror:
-      s += "O";
+      out += 'O';
       break;
     case Inhabitant::kMirrorCracked:
-      s += "0";
+      out += '0';
       break;
     default:
-      s += " ";
+      out += ' ';
       break;
   }
 
-  Item itm = Item::kNone;
-  try
-  {
-    itm = MapCoordinateAt(c).ItemAt();
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-  }
   switch( itm )
   {
     case Item::kBullet:
-      s += "•";
+      Append( out, kGlyphTables[static_cast<size_t>(glyphs_)].bullet, 1 );
       break;
     case Item::kTreasure:
-      s += "T";
+      out += 'T';
       break;
     default:
-      s += " ";
+      out += ' ';
       break;
   }
-
-  return s;
 }
 
-// This private method returns a character representing the given
-// Border Coordinate.
+// This private method appends the character representing the given
+// Border Coordinate to out, count times.
 // An exception is thrown if:
 //   The Coordinate is outside of the Labyrinth (domain_error)
 //   The Coordinate designates a Room (logic_error)
-std::string LabyrinthMap::DisplayBorder( const Coordinate c ) const
+void LabyrinthMap::DisplayBorder( const Coordinate c,
+                                  const size_t count,
+                                  std::string& out ) const
 {
   if( !WithinBoundsOfMap(c) )
   {
-    throw std::domain_error( "Error: DisplayBorder() was given an invalid "\
-      "Coordinate.\n" );
+    RaiseError( Status(ErrorCode::kDomainError, "Error: DisplayBorder() was "\
+      "given an invalid Coordinate.\n") );
   }
   else if( IsRoom(c) )
   {
-    throw std::logic_error( "Error: DisplayBorder() was given a "\
-      "Room Coordinate.\n" );
-  }
-
-  bool n;
-  bool e;
-  bool s;
-  bool w;
-
-  try
-  {
-    n = MapCoordinateAt(c).IsWall( Direction::kNorth );
-    e = MapCoordinateAt(c).IsWall( Direction::kEast );
-    s = MapCoordinateAt(c).IsWall( Direction::kSouth );
-    w = MapCoordinateAt(c).IsWall( Direction::kWest );
-  }
-  catch( std::exception& e )
-  {
-    std::cout << e.what();
-  }
-
-  char borders_nesw[5] = "0000";
-
-  if( n )
-  {
-    borders_nesw[0] = '1';
+    RaiseError( Status(ErrorCode::kLogicError, "Error: DisplayBorder() was "\
+      "given a Room Coordinate.\n") );
   }
-  if( e )
-  {
-    borders_nesw[1] = '1';
-  }
-  if( s )
-  {
-    borders_nesw[2] = '1';
-  }
-  if( w )
-  {
-    borders_nesw[3] = '1';
-  }
-
-  // A true abomination lies ahead.
-  // Please let me know if you have any alternative ideas so I can put this
-  // out of its misery.
-  //
-  // Characters taken from the Unicode section of:
-  // https://en.wikipedia.org/wiki/Box-drawing_character
-
-  if( strcmp(borders_nesw, "0000") == 0 ) return " ";
-
-  else if( strcmp(borders_nesw, "1000") == 0 ) return u8"╵";
-  else if( strcmp(borders_nesw, "0100") == 0 ) return u8"╶";
-  else if( strcmp(borders_nesw, "0010") == 0 ) return u8"╷";
-  else if( strcmp(borders_nesw, "0001") == 0 ) return u8"╴";
-
-  else if( strcmp(borders_nesw, "1100") == 0 ) return u8"└";
-  else if( strcmp(borders_nesw, "1010") == 0 ) return u8"│";
-  else if( strcmp(borders_nesw, "1001") == 0 ) return u8"┘";
-  else if( strcmp(borders_nesw, "0110") == 0 ) return u8"┌";
-  else if( strcmp(borders_nesw, "0101") == 0 ) return u8"─";
-  else if( strcmp(borders_nesw, "0011") == 0 ) return u8"┐";
-
-  else if( strcmp(borders_nesw, "1110") == 0 ) return u8"├";
-  else if( strcmp(borders_nesw, "1101") == 0 ) return u8"┴";
-  else if( strcmp(borders_nesw, "1011") == 0 ) return u8"┤";
-  else if( strcmp(borders_nesw, "0111") == 0 ) return u8"┬";
-
-  else if( strcmp(borders_nesw, "1111") == 0 ) return u8"┼";
 
-  else
-  {
-    throw std::logic_error( "Error: DisplayBorder()'s check for "\
-      "NESW values missed a possible value.\n" );
-  }
+  const GlyphTable& g = kGlyphTables[static_cast<size_t>(glyphs_)];
+  Append( out, g.border[BorderWalls(c)], count );
 }
 
-// This private method displays a legend for the Map symbols.
-void LabyrinthMap::DisplayLegend() const
+// This private method appends a legend for the Map symbols to out.
+void LabyrinthMap::DisplayLegend( std::string& out ) const
 {
-  std::cout << "        LEGEND" << std::endl;
-  std::cout << "┌─────────────────────┐" << std::endl;
-
-  std::cout << "│ INHABITANTS         │" << std::endl;
-  std::cout << "│ Minotaur (live):  M │" << std::endl;
-  std::cout << "│ Minotaur (dead):  m │" << std::endl;
-  std::cout << "│ Mirror (intact):  O │" << std::endl;
-  std::cout << "│ Mirror (cracked): 0 │" << std::endl;
-
-  std::cout << "│                     │" << std::endl;
-
-  std::cout << "│ ITEMS               │" << std::endl;
-  std::cout << "│ Bullet:           • │" << std::endl;
-  std::cout << "│ Treasure:         T │" << std::endl;
+  const GlyphTable& g = kGlyphTables[static_cast<size_t>(glyphs_)];
+  const Glyph& v = g.border[kVertical];
+
+  out += "        LEGEND\n";
+  Append( out, g.border[kTopLeft], 1 );
+  Append( out, g.border[kHorizontal], 21 );
+  Append( out, g.border[kTopRight], 1 );
+  out += '\n';
+
+  const char* const kLines[] =
+  {
+    " INHABITANTS         ",
+    " Minotaur (live):  M ",
+    " Minotaur (dead):  m ",
+    " Mirror (intact):  O ",
+    " Mirror (cracked): 0 ",
+    "                     ",
+    " ITEMS               ",
+    nullptr,  // Bullet
+    " Treasure:         T ",
+  };
+  for( const char* const line : kLines )
+  {
+    Append( out, v, 1 );
+    if( line == nullptr )
+    {
+      out += " Bullet:           ";
+      Append( out, g.bullet, 1 );
+      out += ' ';
+    }
+    else
+    {
+      out += line;
+    }
+    Append( out, v, 1 );
+    out += '\n';
+  }
 
-  std::cout << "└─────────────────────┘" << std::endl;
+  Append( out, g.border[kBottomLeft], 1 );
+  Append( out, g.border[kHorizontal], 21 );
+  Append( out, g.border[kBottomRight], 1 );
+  out += '\n';
 }
@@ -0,0 +1,547 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the LabyrinthNearest class,
+ * which finds the nearest Rooms holding a given Item or Inhabitant by the
+ * number of steps through a Labyrinth.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_listener.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_neighbourhood.hpp"
+#include "../include/labyrinth_nearest.hpp"
+
+// Definitions of the constants which are passed by reference
+const uint16_t LabyrinthNearest::kUnreachable;
+const RoomId LabyrinthNearest::kNoRoom;
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+LabyrinthNearest::LabyrinthNearest( const Labyrinth* const l,
+                                    const size_t cache_after ) :
+  l_(l),
+  x_size_(l == nullptr ? 0 : l->GetXSize()),
+  num_rooms_(l == nullptr ? 0 : l->GetXSize() * l->GetYSize()),
+  cache_after_(cache_after)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthNearest() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+
+  queue_.reserve( num_rooms_ );
+  queue_distance_.reserve( num_rooms_ );
+  l_->AddListener( this );
+}
+
+// Destructor
+// Stops listening to the Labyrinth.
+LabyrinthNearest::~LabyrinthNearest()
+{
+  l_->RemoveListener( this );
+}
+
+// This method returns the nearest Room to rm holding the Item, which
+// may be rm itself.
+// found is false if no Room holding the Item can be reached.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   itm is Item::kNone (invalid_argument)
+NearestRoom LabyrinthNearest::NearestItem( const Coordinate rm,
+                                           const Item itm )
+{
+  if( itm == Item::kNone )
+  {
+    throw std::invalid_argument( "Error: NearestItem() was given a null "\
+      "Item.\n" );
+  }
+  return Nearest( rm, static_cast<size_t>(itm) );
+}
+
+// This method returns the nearest Room to rm holding the Inhabitant,
+// which may be rm itself.
+// found is false if no Room holding the Inhabitant can be reached.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   inh is Inhabitant::kNone (invalid_argument)
+NearestRoom LabyrinthNearest::NearestInhabitant( const Coordinate rm,
+                                                 const Inhabitant inh )
+{
+  if( inh == Inhabitant::kNone )
+  {
+    throw std::invalid_argument( "Error: NearestInhabitant() was given a "\
+      "null Inhabitant.\n" );
+  }
+  return Nearest( rm, kNumItems + static_cast<size_t>(inh) );
+}
+
+// This method writes the k nearest Rooms to rm holding the Item into
+// out, nearest first, with a search which stops at the kth Room.
+// Fewer than k Rooms are written if fewer can be reached.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   itm is Item::kNone (invalid_argument)
+void LabyrinthNearest::KNearestItems( const Coordinate rm,
+                                      const Item itm,
+                                      const size_t k,
+                                      std::vector<NearestRoom>& out )
+{
+  if( itm == Item::kNone )
+  {
+    throw std::invalid_argument( "Error: KNearestItems() was given a null "\
+      "Item.\n" );
+  }
+  KNearest( rm, static_cast<size_t>(itm), k, out );
+}
+
+// This method writes the k nearest Rooms to rm holding the Inhabitant
+// into out, nearest first, with a search which stops at the kth Room.
+// Fewer than k Rooms are written if fewer can be reached.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   inh is Inhabitant::kNone (invalid_argument)
+void LabyrinthNearest::KNearestInhabitants( const Coordinate rm,
+                                            const Inhabitant inh,
+                                            const size_t k,
+                                            std::vector<NearestRoom>& out )
+{
+  if( inh == Inhabitant::kNone )
+  {
+    throw std::invalid_argument( "Error: KNearestInhabitants() was given a "\
+      "null Inhabitant.\n" );
+  }
+  KNearest( rm, kNumItems + static_cast<size_t>(inh), k, out );
+}
+
+// This method returns the number of distance fields currently kept.
+size_t LabyrinthNearest::FieldsKept() const
+{
+  size_t kept = 0;
+  for( const Field& field : fields_ )
+  {
+    kept += field.kept ? 1 : 0;
+  }
+  return kept;
+}
+
+// This method returns the number of questions answered by a lookup in
+// a distance field.
+size_t LabyrinthNearest::Lookups() const
+{
+  return lookups_;
+}
+
+// This method returns the number of questions answered by searching
+// outward from the Room.
+size_t LabyrinthNearest::Searches() const
+{
+  return searches_;
+}
+
+// This method updates the distance fields around two connected Rooms.
+void LabyrinthNearest::RoomsConnected( const Coordinate rm_1,
+                                       const Coordinate rm_2 )
+{
+  const RoomId id_1 = static_cast<RoomId>( rm_1.y * x_size_ + rm_1.x );
+  const RoomId id_2 = static_cast<RoomId>( rm_2.y * x_size_ + rm_2.x );
+  for( size_t f = 0; f < kNumFields; ++f )
+  {
+    Field& field = fields_[f];
+    if( !field.kept )
+    {
+      continue;
+    }
+
+    // At most one side can be lowered through the new connection
+    if( field.distance[id_1] != kUnreachable &&
+        field.distance[id_1] + 1 < field.distance[id_2] )
+    {
+      field.distance[id_2] =
+        static_cast<uint16_t>( field.distance[id_1] + 1 );
+      field.source[id_2] = field.source[id_1];
+      Lower( f, id_2 );
+    }
+    else if( field.distance[id_2] != kUnreachable &&
+             field.distance[id_2] + 1 < field.distance[id_1] )
+    {
+      field.distance[id_1] =
+        static_cast<uint16_t>( field.distance[id_2] + 1 );
+      field.source[id_1] = field.source[id_2];
+      Lower( f, id_1 );
+    }
+  }
+}
+
+// This method drops every distance field.
+void LabyrinthNearest::RoomsDisconnected( const Coordinate rm_1,
+                                          const Coordinate rm_2 )
+{
+  // Avoiding unused parameter warning
+  (void)(rm_1);
+  (void)(rm_2);
+
+  LabyrinthReset();
+}
+
+// This method adds or removes the Room as a source of the distance
+// fields whose content it has gained or lost.
+void LabyrinthNearest::RoomChanged( const Coordinate rm )
+{
+  const RoomId id = static_cast<RoomId>( rm.y * x_size_ + rm.x );
+  for( size_t f = 0; f < kNumFields; ++f )
+  {
+    if( !fields_[f].kept )
+    {
+      continue;
+    }
+
+    const bool was_source = fields_[f].source[id] == id;
+    const bool is_source = Holds( id, f );
+    if( is_source && !was_source )
+    {
+      AddSource( f, id );
+    }
+    else if( was_source && !is_source )
+    {
+      RemoveSource( f, id );
+    }
+  }
+}
+
+// This method drops every distance field.
+void LabyrinthNearest::LabyrinthReset()
+{
+  // The questions are kept, so the fields are rebuilt on their next use
+  for( Field& field : fields_ )
+  {
+    field.kept = false;
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the nearest Room to rm holding the
+// content of field f.
+NearestRoom LabyrinthNearest::Nearest( const Coordinate rm, const size_t f )
+{
+  if( rm.x >= x_size_ || rm.y >= l_->GetYSize() )
+  {
+    throw std::domain_error( "Error: LabyrinthNearest was given a "\
+      "Coordinate outside of the Labyrinth.\n" );
+  }
+
+  Field& field = fields_[f];
+  ++field.questions;
+  if( !field.kept && field.questions >= cache_after_ )
+  {
+    Build( f );
+  }
+  if( !field.kept )
+  {
+    KNearest( rm, f, 1, found_ );
+    return found_.empty() ? NearestRoom() : found_[0];
+  }
+
+  ++lookups_;
+  const RoomId id = static_cast<RoomId>( rm.y * x_size_ + rm.x );
+  NearestRoom nearest;
+  if( field.distance[id] != kUnreachable )
+  {
+    nearest.found = true;
+    nearest.room = Coordinate( field.source[id] % x_size_,
+                               field.source[id] / x_size_ );
+    nearest.distance = field.distance[id];
+  }
+  return nearest;
+}
+
+// This private method writes the k nearest Rooms to rm holding the
+// content of field f into out.
+void LabyrinthNearest::KNearest( const Coordinate rm,
+                                 const size_t f,
+                                 const size_t k,
+                                 std::vector<NearestRoom>& out )
+{
+  if( rm.x >= x_size_ || rm.y >= l_->GetYSize() )
+  {
+    throw std::domain_error( "Error: LabyrinthNearest was given a "\
+      "Coordinate outside of the Labyrinth.\n" );
+  }
+  ++searches_;
+  out.clear();
+  if( k == 0 )
+  {
+    return;
+  }
+
+  if( stamps_.stamps.size() < num_rooms_ )
+  {
+    stamps_.stamps.resize( num_rooms_, 0 );
+  }
+  if( ++stamps_.generation == 0 )
+  {
+    std::fill( stamps_.stamps.begin(), stamps_.stamps.end(), 0 );
+    stamps_.generation = 1;
+  }
+  const uint32_t generation = stamps_.generation;
+
+  // Rooms are checked as they are dequeued, which is in order of distance
+  queue_.clear();
+  queue_distance_.clear();
+  const RoomId start = static_cast<RoomId>( rm.y * x_size_ + rm.x );
+  stamps_.stamps[start] = generation;
+  queue_.push_back( start );
+  queue_distance_.push_back( 0 );
+  for( size_t i = 0; i < queue_.size(); ++i )
+  {
+    const RoomId id = queue_[i];
+    if( Holds(id, f) )
+    {
+      NearestRoom nearest;
+      nearest.found = true;
+      nearest.room = Coordinate( id % x_size_, id / x_size_ );
+      nearest.distance = queue_distance_[i];
+      out.push_back( nearest );
+      if( out.size() == k )
+      {
+        return;
+      }
+    }
+
+    RoomId neighbours[4];
+    const size_t n = Neighbours( id, neighbours );
+    for( size_t j = 0; j < n; ++j )
+    {
+      if( stamps_.stamps[neighbours[j]] != generation )
+      {
+        stamps_.stamps[neighbours[j]] = generation;
+        queue_.push_back( neighbours[j] );
+        queue_distance_.push_back(
+          static_cast<uint16_t>(queue_distance_[i] + 1) );
+      }
+    }
+  }
+}
+
+// This private method returns true if the Room holds the content of
+// field f.
+bool LabyrinthNearest::Holds( const RoomId id, const size_t f ) const
+{
+  const Coordinate rm( id % x_size_, id / x_size_ );
+  if( f < kNumItems )
+  {
+    return l_->ItemAt( rm ) == static_cast<Item>( f );
+  }
+  return l_->GetInhabitant( rm ) == static_cast<Inhabitant>( f - kNumItems );
+}
+
+// This private method writes the Rooms connected to the Room into out,
+// and returns how many there are.
+size_t LabyrinthNearest::Neighbours( const RoomId id, RoomId out[4] ) const
+{
+  const unsigned char mask = l_->OpenMask(
+    Coordinate(id % x_size_, id / x_size_) );
+  const RoomId x_size = static_cast<RoomId>( x_size_ );
+
+  // North, east, south and west, as in OpenMask()
+  size_t n = 0;
+  if( mask & 1 )
+  {
+    out[n++] = id - x_size;
+  }
+  if( mask & 2 )
+  {
+    out[n++] = id + 1;
+  }
+  if( mask & 4 )
+  {
+    out[n++] = id + x_size;
+  }
+  if( mask & 8 )
+  {
+    out[n++] = id - 1;
+  }
+  return n;
+}
+
+// This private method computes field f from every source.
+void LabyrinthNearest::Build( const size_t f )
+{
+  Field& field = fields_[f];
+  field.distance.assign( num_rooms_, kUnreachable );
+  field.source.assign( num_rooms_, kNoRoom );
+
+  // Every source starts the search at once, so each Room is reached
+  // first from its nearest source
+  queue_.clear();
+  for( RoomId id = 0; id < num_rooms_; ++id )
+  {
+    if( Holds(id, f) )
+    {
+      field.distance[id] = 0;
+      field.source[id] = id;
+      queue_.push_back( id );
+    }
+  }
+  for( size_t i = 0; i < queue_.size(); ++i )
+  {
+    const RoomId id = queue_[i];
+    RoomId neighbours[4];
+    const size_t n = Neighbours( id, neighbours );
+    for( size_t j = 0; j < n; ++j )
+    {
+      if( field.distance[neighbours[j]] == kUnreachable )
+      {
+        field.distance[neighbours[j]] =
+          static_cast<uint16_t>( field.distance[id] + 1 );
+        field.source[neighbours[j]] = field.source[id];
+        queue_.push_back( neighbours[j] );
+      }
+    }
+  }
+  field.kept = true;
+}
+
+// This private method lowers the distances of field f outward from
+// the Room, whose distance has just been lowered.
+void LabyrinthNearest::Lower( const size_t f, const RoomId start )
+{
+  Field& field = fields_[f];
+  queue_.clear();
+  queue_.push_back( start );
+  for( size_t i = 0; i < queue_.size(); ++i )
+  {
+    const RoomId id = queue_[i];
+    RoomId neighbours[4];
+    const size_t n = Neighbours( id, neighbours );
+    for( size_t j = 0; j < n; ++j )
+    {
+      if( field.distance[id] + 1 < field.distance[neighbours[j]] )
+      {
+        field.distance[neighbours[j]] =
+          static_cast<uint16_t>( field.distance[id] + 1 );
+        field.source[neighbours[j]] = field.source[id];
+        queue_.push_back( neighbours[j] );
+      }
+    }
+  }
+}
+
+// This private method makes the Room a source of field f.
+void LabyrinthNearest::AddSource( const size_t f, const RoomId id )
+{
+  fields_[f].distance[id] = 0;
+  fields_[f].source[id] = id;
+  Lower( f, id );
+}
+
+// This private method stops the Room being a source of field f, and
+// recomputes the Rooms which were nearest to it.
+void LabyrinthNearest::RemoveSource( const size_t f, const RoomId id )
+{
+  Field& field = fields_[f];
+
+  // The Rooms nearest to the source are stamped as orphans. A Room may
+  // keep the source after the neighbour it was reached through has found
+  // a nearer one, so the orphans are not always connected to each other,
+  // and are found by a pass over the sources instead of a search
+  if( stamps_.stamps.size() < num_rooms_ )
+  {
+    stamps_.stamps.resize( num_rooms_, 0 );
+  }
+  if( ++stamps_.generation == 0 )
+  {
+    std::fill( stamps_.stamps.begin(), stamps_.stamps.end(), 0 );
+    stamps_.generation = 1;
+  }
+  const uint32_t orphan = stamps_.generation;
+
+  queue_.clear();
+  for( RoomId o = 0; o < num_rooms_; ++o )
+  {
+    if( field.source[o] == id )
+    {
+      stamps_.stamps[o] = orphan;
+      queue_.push_back( o );
+    }
+  }
+  for( const RoomId o : queue_ )
+  {
+    field.distance[o] = kUnreachable;
+    field.source[o] = kNoRoom;
+  }
+
+  // Every other Room still has its distance to a remaining source, so an
+  // orphan bordering one is seeded through it
+  seeds_.clear();
+  for( const RoomId o : queue_ )
+  {
+    RoomId neighbours[4];
+    const size_t n = Neighbours( o, neighbours );
+    for( size_t j = 0; j < n; ++j )
+    {
+      const RoomId b = neighbours[j];
+      if( stamps_.stamps[b] != orphan && field.distance[b] != kUnreachable &&
+          field.distance[b] + 1 < field.distance[o] )
+      {
+        field.distance[o] = static_cast<uint16_t>( field.distance[b] + 1 );
+        field.source[o] = field.source[b];
+      }
+    }
+    if( field.distance[o] != kUnreachable )
+    {
+      seeds_.push_back( static_cast<uint32_t>(field.distance[o]) << 16 | o );
+    }
+  }
+  std::sort( seeds_.begin(), seeds_.end() );
+
+  // The seeds and the Rooms they reach are expanded together in order of
+  // distance, so each orphan is settled by its nearest remaining source
+  queue_.clear();
+  size_t next_seed = 0;
+  size_t next_queued = 0;
+  while( next_seed < seeds_.size() || next_queued < queue_.size() )
+  {
+    RoomId u;
+    if( next_queued == queue_.size() ||
+        (next_seed < seeds_.size() &&
+         (seeds_[next_seed] >> 16) <= field.distance[queue_[next_queued]]) )
+    {
+      u = seeds_[next_seed] & 0xFFFF;
+      if( (seeds_[next_seed++] >> 16) > field.distance[u] )
+      {
+        continue;  // Lowered since it was seeded
+      }
+    }
+    else
+    {
+      u = queue_[next_queued++];
+    }
+
+    RoomId neighbours[4];
+    const size_t n = Neighbours( u, neighbours );
+    for( size_t j = 0; j < n; ++j )
+    {
+      const RoomId v = neighbours[j];
+      if( stamps_.stamps[v] == orphan &&
+          field.distance[u] + 1 < field.distance[v] )
+      {
+        field.distance[v] = static_cast<uint16_t>( field.distance[u] + 1 );
+        field.source[v] = field.source[u];
+        queue_.push_back( v );
+      }
+    }
+  }
+}
@@ -0,0 +1,285 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the LabyrinthPathCache
+ * class, which keeps recently solved paths of a Labyrinth so they are not
+ * recomputed.
+ *
+ */
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_listener.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_solver.hpp"
+#include "../include/next_hop_table.hpp"
+#include "../include/labyrinth_path_cache.hpp"
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+//   capacity is 0 (domain_error)
+LabyrinthPathCache::LabyrinthPathCache( const Labyrinth* const l,
+                                        const size_t capacity ) :
+  l_(l),
+  solver_(l),
+  x_size_(l->GetXSize()),
+  table_misses_(x_size_ * l->GetYSize() <= NextHopTable::kMaxRooms ?
+                x_size_ * l->GetYSize() : SIZE_MAX),
+  entries_(capacity),
+  head_(static_cast<uint32_t>(capacity)),
+  tail_(static_cast<uint32_t>(capacity)),
+  kNone_(static_cast<uint32_t>(capacity))
+{
+  if( capacity == 0 )
+  {
+    throw std::domain_error( "Error: LabyrinthPathCache() was given a "\
+      "capacity of 0.\n" );
+  }
+
+  index_.reserve( capacity );
+  free_.reserve( capacity );
+  for( size_t i = capacity; i > 0; --i )
+  {
+    free_.push_back( static_cast<uint32_t>(i - 1) );
+  }
+
+  l_->AddListener( this );
+}
+
+// Destructor
+// Stops listening to the Labyrinth.
+LabyrinthPathCache::~LabyrinthPathCache()
+{
+  l_->RemoveListener( this );
+}
+
+// This method returns the Rooms on a shortest path from src to dst, as
+// LabyrinthSolver::ShortestPath() does, solving it only if it is not
+// already cached.
+// The returned reference is valid until the cache is next used or
+// changed.
+// An exception is thrown if:
+//   src or dst is outside the Labyrinth (domain_error)
+const std::vector<Coordinate>& LabyrinthPathCache::ShortestPath(
+  const Coordinate src,
+  const Coordinate dst )
+{
+  if( src.x >= x_size_ || src.y >= l_->GetYSize() ||
+      dst.x >= x_size_ || dst.y >= l_->GetYSize() )
+  {
+    throw std::domain_error( "Error: ShortestPath() was given a "\
+      "Coordinate outside of the Labyrinth.\n" );
+  }
+
+  const uint32_t key = Key( src, dst );
+  const auto found = index_.find( key );
+  if( found != index_.end() )
+  {
+    ++hits_;
+    const uint32_t e = found->second;
+    if( e != head_ )
+    {
+      Unlink( e );
+      LinkAtHead( e );
+    }
+    return entries_[e].path;
+  }
+
+  ++misses_;
+  if( free_.empty() )
+  {
+    Drop( tail_ );
+  }
+  const uint32_t e = free_.back();
+  free_.pop_back();
+
+  Entry& entry = entries_[e];
+  entry.key = key;
+  if( !table_current_ && ++misses_since_change_ >= table_misses_ )
+  {
+    if( table_ )
+    {
+      table_->Rebuild();
+    }
+    else
+    {
+      table_ = std::make_unique<NextHopTable>( l_, 1, false );
+    }
+    table_current_ = true;
+  }
+  if( table_current_ )
+  {
+    table_->ShortestPath( src, dst, entry.path, entry.component );
+  }
+  else
+  {
+    entry.path = solver_.ShortestPath( src, dst, entry.component );
+  }
+  index_[key] = e;
+  LinkAtHead( e );
+  return entry.path;
+}
+
+// This method returns the number of paths currently cached.
+size_t LabyrinthPathCache::Size() const
+{
+  return index_.size();
+}
+
+// This method returns the number of calls to ShortestPath() which were
+// answered from the cache.
+size_t LabyrinthPathCache::Hits() const
+{
+  return hits_;
+}
+
+// This method returns the number of calls to ShortestPath() which had
+// to solve the path.
+size_t LabyrinthPathCache::Misses() const
+{
+  return misses_;
+}
+
+// This method returns true if paths which are not cached are read from
+// a NextHopTable, and false if they are solved.
+bool LabyrinthPathCache::UsesNextHopTable() const
+{
+  return table_current_;
+}
+
+// This method drops the paths which may be changed by connecting rm_1
+// and rm_2.
+void LabyrinthPathCache::RoomsConnected( const Coordinate rm_1,
+                                         const Coordinate rm_2 )
+{
+  SetTableAside();
+
+  // rm_1 and rm_2 are always in the same component once connected, so a
+  // path is unaffected if neither was reachable from its source.
+  const size_t i_1 = RoomIndex( rm_1 );
+  const size_t i_2 = RoomIndex( rm_2 );
+  uint32_t e = head_;
+  while( e != kNone_ )
+  {
+    const uint32_t next = entries_[e].next;
+    if( entries_[e].component[i_1] || entries_[e].component[i_2] )
+    {
+      Drop( e );
+    }
+    e = next;
+  }
+}
+
+// This method drops the paths which pass between rm_1 and rm_2.
+void LabyrinthPathCache::RoomsDisconnected( const Coordinate rm_1,
+                                            const Coordinate rm_2 )
+{
+  SetTableAside();
+
+  // Components are left as they are; a Room which is no longer reachable
+  // only makes RoomsConnected() drop a path which it could have kept
+  uint32_t e = head_;
+  while( e != kNone_ )
+  {
+    const uint32_t next = entries_[e].next;
+    const std::vector<Coordinate>& path = entries_[e].path;
+    for( size_t i = 1; i < path.size(); ++i )
+    {
+      if( (path[i - 1] == rm_1 && path[i] == rm_2) ||
+          (path[i - 1] == rm_2 && path[i] == rm_1) )
+      {
+        Drop( e );
+        break;
+      }
+    }
+    e = next;
+  }
+}
+
+// This method drops every path.
+void LabyrinthPathCache::LabyrinthReset()
+{
+  SetTableAside();
+  while( head_ != kNone_ )
+  {
+    Drop( head_ );
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the key of the path from src to dst.
+uint32_t LabyrinthPathCache::Key( const Coordinate src,
+                                  const Coordinate dst ) const
+{
+  return static_cast<uint32_t>( RoomIndex(src) << 16 | RoomIndex(dst) );
+}
+
+// This private method returns the index in the component of Entries
+// of the given Room.
+size_t LabyrinthPathCache::RoomIndex( const Coordinate rm ) const
+{
+  return rm.y * x_size_ + rm.x;
+}
+
+// This private method removes the Entry from the order of use.
+void LabyrinthPathCache::Unlink( const uint32_t e )
+{
+  const uint32_t prev = entries_[e].prev;
+  const uint32_t next = entries_[e].next;
+  if( prev != kNone_ )
+  {
+    entries_[prev].next = next;
+  }
+  else
+  {
+    head_ = next;
+  }
+  if( next != kNone_ )
+  {
+    entries_[next].prev = prev;
+  }
+  else
+  {
+    tail_ = prev;
+  }
+}
+
+// This private method makes the Entry the most recently used.
+void LabyrinthPathCache::LinkAtHead( const uint32_t e )
+{
+  entries_[e].prev = kNone_;
+  entries_[e].next = head_;
+  if( head_ != kNone_ )
+  {
+    entries_[head_].prev = e;
+  }
+  else
+  {
+    tail_ = e;
+  }
+  head_ = e;
+}
+
+// This private method removes the Entry from the cache.
+void LabyrinthPathCache::Drop( const uint32_t e )
+{
+  Unlink( e );
+  index_.erase( entries_[e].key );
+  free_.push_back( e );
+}
+
+// This private method stops reading paths from the table until enough
+// paths have been solved again.
+void LabyrinthPathCache::SetTableAside()
+{
+  table_current_ = false;
+  misses_since_change_ = 0;
+}
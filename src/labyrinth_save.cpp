@@ -0,0 +1,344 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the LabyrinthSaver class, as
+ * well as functions to encode, decode, and load level files.
+ *
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_snapshot.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_save.hpp"
+
+namespace
+{
+
+const char kMagic[] = "LABY";
+const unsigned char kFormatVersion = 1;
+const size_t kHeaderSize = 12;
+
+const Direction kDirections[] =
+{
+  Direction::kNorth,
+  Direction::kEast,
+  Direction::kSouth,
+  Direction::kWest,
+};
+
+// This local function returns the error message for the last failed system
+// call on the given file.
+std::string SystemError( const char* const function,
+                         const std::string& filename );
+
+// This local function encodes a single Room.
+unsigned int EncodeRoom( const Room& rm );
+
+// This local function decodes a single Room.
+// An exception is thrown if:
+//   The value does not describe a valid Room (runtime_error)
+Room DecodeRoom( const unsigned int value );
+
+// This local function returns the error message for the last failed system
+// call on the given file.
+std::string SystemError( const char* const function,
+                         const std::string& filename )
+{
+  return std::string("Error: ") + function + "() failed on " + filename +
+    ": " + std::strerror(errno) + ".\n";
+}
+
+// This local function encodes a single Room.
+unsigned int EncodeRoom( const Room& rm )
+{
+  unsigned int value = 0;
+  for( unsigned int i = 0; i < 4; ++i )
+  {
+    switch( rm.DirectionCheck(kDirections[i]) )
+    {
+      case RoomBorder::kWall:
+        value |= 1u << i;
+        break;
+      case RoomBorder::kExit:
+        value |= static_cast<unsigned int>(kDirections[i]) << 4;
+        break;
+      case RoomBorder::kRoom:
+        break;
+    }
+  }
+  value |= static_cast<unsigned int>(rm.GetInhabitant()) << 7;
+  value |= static_cast<unsigned int>(rm.GetItem()) << 10;
+  return value;
+}
+
+// This local function decodes a single Room.
+// An exception is thrown if:
+//   The value does not describe a valid Room (runtime_error)
+Room DecodeRoom( const unsigned int value )
+{
+  const unsigned int exit = (value >> 4) & 0x7;
+  const unsigned int inh = (value >> 7) & 0x7;
+  if( exit > static_cast<unsigned int>(Direction::kWest) ||
+      inh > static_cast<unsigned int>(Inhabitant::kMirrorCracked) ||
+      (value >> 12) != 0 )
+  {
+    throw std::runtime_error( "Error: DecodeSnapshot() was given a level "\
+      "file with an invalid Room.\n" );
+  }
+
+  return Room( static_cast<Inhabitant>(inh),
+               static_cast<Item>((value >> 10) & 0x3),
+               static_cast<Direction>(exit),
+               (value & 0x1) != 0,
+               (value & 0x2) != 0,
+               (value & 0x4) != 0,
+               (value & 0x8) != 0 );
+}
+
+}  // Local namespace
+
+// This function returns the size in bytes of the level file of a Labyrinth
+// with the given sizes.
+size_t EncodedSnapshotSize( const size_t x_size, const size_t y_size )
+{
+  return kHeaderSize + x_size * y_size * 2;
+}
+
+// This function encodes s in the level file format into out.
+// The buffer of out is reused, so encoding into the same vector
+// repeatedly does not allocate.
+void EncodeSnapshot( const LabyrinthSnapshot& s,
+                     std::vector<unsigned char>& out )
+{
+  out.resize( EncodedSnapshotSize(s.x_size, s.y_size) );
+  unsigned char* p = out.data();
+
+  std::memcpy( p, kMagic, 4 );
+  p[4] = kFormatVersion;
+  p[5] = static_cast<unsigned char>(s.x_size);
+  p[6] = static_cast<unsigned char>(s.y_size);
+  p[7] = static_cast<unsigned char>(s.spawn_1.x);
+  p[8] = static_cast<unsigned char>(s.spawn_1.y);
+  p[9] = static_cast<unsigned char>(s.spawn_2.x);
+  p[10] = static_cast<unsigned char>(s.spawn_2.y);
+  p[11] = static_cast<unsigned char>( (s.exit_set ? 0x1 : 0) |
+                                      (s.treasure_set ? 0x2 : 0) );
+  p += kHeaderSize;
+
+  for( const Room& rm : s.rooms )
+  {
+    const unsigned int value = EncodeRoom(rm);
+    p[0] = static_cast<unsigned char>(value & 0xFF);
+    p[1] = static_cast<unsigned char>(value >> 8);
+    p += 2;
+  }
+}
+
+// This function decodes a level file of the given size into s.
+// An exception is thrown if:
+//   data is not a valid level file (runtime_error)
+void DecodeSnapshot( const unsigned char* const data,
+                     const size_t size,
+                     LabyrinthSnapshot& s )
+{
+  if( size < kHeaderSize ||
+      std::memcmp(data, kMagic, 4) != 0 ||
+      data[4] != kFormatVersion )
+  {
+    throw std::runtime_error( "Error: DecodeSnapshot() was given data "\
+      "which is not a level file.\n" );
+  }
+
+  const size_t x_size = data[5];
+  const size_t y_size = data[6];
+  if( size != EncodedSnapshotSize(x_size, y_size) )
+  {
+    throw std::runtime_error( "Error: DecodeSnapshot() was given a level "\
+      "file of the wrong length.\n" );
+  }
+
+  s.x_size = x_size;
+  s.y_size = y_size;
+  s.spawn_1 = Coordinate( data[7], data[8] );
+  s.spawn_2 = Coordinate( data[9], data[10] );
+  s.exit_set = (data[11] & 0x1) != 0;
+  s.treasure_set = (data[11] & 0x2) != 0;
+
+  s.rooms.resize( x_size * y_size );
+  const unsigned char* p = data + kHeaderSize;
+  for( Room& rm : s.rooms )
+  {
+    rm = DecodeRoom( p[0] | (static_cast<unsigned int>(p[1]) << 8) );
+    p += 2;
+  }
+}
+
+// This function reads the level file with the given name into s.
+// An exception is thrown if:
+//   The file cannot be read (runtime_error)
+//   The file is not a valid level file (runtime_error)
+void LoadSnapshot( const std::string& filename, LabyrinthSnapshot& s )
+{
+  std::ifstream file( filename, std::ios::binary );
+  if( !file )
+  {
+    throw std::runtime_error( "Error: LoadSnapshot() could not open " +
+      filename + ".\n" );
+  }
+
+  std::vector<unsigned char> data( (std::istreambuf_iterator<char>(file)),
+                                   std::istreambuf_iterator<char>() );
+  DecodeSnapshot( data.data(), data.size(), s );
+}
+
+// Default constructor
+// Starts the background thread.
+LabyrinthSaver::LabyrinthSaver() :
+  worker_( &LabyrinthSaver::Run, this )
+{
+}
+
+// Destructor
+// Finishes all queued saves, then stops the background thread.
+LabyrinthSaver::~LabyrinthSaver()
+{
+  {
+    std::lock_guard<std::mutex> lock( mutex_ );
+    stopping_ = true;
+  }
+  job_queued_.notify_one();
+  worker_.join();
+}
+
+// This method copies the state of l and queues it to be saved to the
+// given file.
+// The file is first written under filename + ".tmp" and renamed once it
+// has been synced, so an interrupted save never leaves a partial file.
+// The returned future becomes ready when the save is complete; get()
+// rethrows any error from the background thread (runtime_error).
+std::future<void> LabyrinthSaver::SaveAsync( const Labyrinth& l,
+                                             const std::string& filename )
+{
+  std::unique_lock<std::mutex> lock( mutex_ );
+  SaveJob& job = jobs_[next_job_];
+  job_done_.wait( lock, [&job]{ return !job.claimed; } );
+  job.claimed = true;
+  next_job_ = (next_job_ + 1) % kNumJobs_;
+
+  // The background thread does not touch a job until it is queued, so the
+  // snapshot can be taken without holding the lock.
+  lock.unlock();
+  l.TakeSnapshot( job.snapshot );
+  job.filename = filename;
+  job.done = std::promise<void>();
+  std::future<void> f = job.done.get_future();
+
+  lock.lock();
+  job.queued = true;
+  lock.unlock();
+  job_queued_.notify_one();
+  return f;
+}
+
+// This private method is run by the background thread, and saves the
+// queued jobs in order until the LabyrinthSaver is destroyed.
+void LabyrinthSaver::Run()
+{
+  size_t current = 0;
+  std::unique_lock<std::mutex> lock( mutex_ );
+  for( ;; )
+  {
+    SaveJob& job = jobs_[current];
+    job_queued_.wait( lock, [this, &job]{ return job.queued || stopping_; } );
+    if( !job.queued )
+    {
+      return;
+    }
+
+    lock.unlock();
+    try
+    {
+      WriteJob( job );
+      job.done.set_value();
+    }
+    catch( ... )
+    {
+      job.done.set_exception( std::current_exception() );
+    }
+    lock.lock();
+
+    job.queued = false;
+    job.claimed = false;
+    current = (current + 1) % kNumJobs_;
+    job_done_.notify_all();
+  }
+}
+
+// This private method encodes and writes a single job to its file.
+// An exception is thrown if:
+//   The file cannot be written (runtime_error)
+void LabyrinthSaver::WriteJob( SaveJob& job )
+{
+  EncodeSnapshot( job.snapshot, job.encoded );
+
+  const std::string temp_filename = job.filename + ".tmp";
+  const int fd = open( temp_filename.c_str(),
+                       O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                       0644 );
+  if( fd < 0 )
+  {
+    throw std::runtime_error( SystemError("open", temp_filename) );
+  }
+
+  // The whole file is submitted at once; the loop only handles short writes
+  const unsigned char* p = job.encoded.data();
+  size_t remaining = job.encoded.size();
+  while( remaining > 0 )
+  {
+    const ssize_t written = write( fd, p, remaining );
+    if( written < 0 )
+    {
+      if( errno == EINTR )
+      {
+        continue;
+      }
+      const std::string message = SystemError( "write", temp_filename );
+      close( fd );
+      throw std::runtime_error( message );
+    }
+    p += written;
+    remaining -= static_cast<size_t>(written);
+  }
+
+  if( fsync(fd) != 0 )
+  {
+    const std::string message = SystemError( "fsync", temp_filename );
+    close( fd );
+    throw std::runtime_error( message );
+  }
+  if( close(fd) != 0 )
+  {
+    throw std::runtime_error( SystemError("close", temp_filename) );
+  }
+
+  if( std::rename(temp_filename.c_str(), job.filename.c_str()) != 0 )
+  {
+    throw std::runtime_error( SystemError("rename", job.filename) );
+  }
+}
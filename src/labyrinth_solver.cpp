@@ -0,0 +1,273 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the LabyrinthSolver class,
+ * which finds paths between Rooms of a Labyrinth.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_solver.hpp"
+
+namespace
+{
+
+const Direction kDirections[] =
+{
+  Direction::kNorth,
+  Direction::kEast,
+  Direction::kSouth,
+  Direction::kWest,
+};
+
+// This local function returns the Room next to rm in Direction d.
+// The Room must be connected to rm in that Direction.
+Coordinate Neighbour( const Coordinate rm, const Direction d );
+
+// This local function returns the Room next to rm in Direction d.
+// The Room must be connected to rm in that Direction.
+Coordinate Neighbour( const Coordinate rm, const Direction d )
+{
+  switch( d )
+  {
+    case Direction::kNorth:
+      return Coordinate( rm.x, rm.y - 1 );
+    case Direction::kEast:
+      return Coordinate( rm.x + 1, rm.y );
+    case Direction::kSouth:
+      return Coordinate( rm.x, rm.y + 1 );
+    case Direction::kWest:
+      return Coordinate( rm.x - 1, rm.y );
+    default:
+      return rm;
+  }
+}
+
+}  // Local namespace
+
+const uint32_t LabyrinthSolver::kUnreachable;
+const uint32_t LabyrinthSolver::kNumBuckets_;
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+LabyrinthSolver::LabyrinthSolver( const Labyrinth* const l ) :
+  l_(l)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthSolver() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+}
+
+// This method returns the Rooms on a shortest path from src to dst,
+// including both src and dst.
+// An empty path is returned if dst cannot be reached from src.
+// An exception is thrown if:
+//   src or dst is outside the Labyrinth (domain_error)
+std::vector<Coordinate> LabyrinthSolver::ShortestPath(
+  const Coordinate src,
+  const Coordinate dst ) const
+{
+  std::vector<bool> component;
+  return ShortestPath( src, dst, component );
+}
+
+// This method returns the Rooms on a shortest path from src to dst, as
+// above, and sets component to mark every Room reachable from src.
+// component is indexed as (y * x_size + x).
+// An exception is thrown if:
+//   src or dst is outside the Labyrinth (domain_error)
+std::vector<Coordinate> LabyrinthSolver::ShortestPath(
+  const Coordinate src,
+  const Coordinate dst,
+  std::vector<bool>& component ) const
+{
+  const size_t x_size = l_->GetXSize();
+  const size_t y_size = l_->GetYSize();
+  if( src.x >= x_size || src.y >= y_size ||
+      dst.x >= x_size || dst.y >= y_size )
+  {
+    throw std::domain_error( "Error: ShortestPath() was given a "\
+      "Coordinate outside of the Labyrinth.\n" );
+  }
+
+  const size_t num_rooms = x_size * y_size;
+  const size_t kNoParent = num_rooms;
+  std::vector<size_t> parent( num_rooms, kNoParent );
+  std::vector<size_t> queue;
+  queue.reserve( num_rooms );
+
+  component.assign( num_rooms, false );
+
+  // Breadth-first search over the whole component, so that component is
+  // complete even when dst is found early
+  const size_t src_index = src.y * x_size + src.x;
+  component[src_index] = true;
+  queue.push_back( src_index );
+  for( size_t head = 0; head < queue.size(); ++head )
+  {
+    const Coordinate rm( queue[head] % x_size, queue[head] / x_size );
+    for( const Direction d : kDirections )
+    {
+      if( l_->DirectionCheck(rm, d) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      const Coordinate next = Neighbour( rm, d );
+      const size_t next_index = next.y * x_size + next.x;
+      if( !component[next_index] )
+      {
+        component[next_index] = true;
+        parent[next_index] = queue[head];
+        queue.push_back( next_index );
+      }
+    }
+  }
+
+  std::vector<Coordinate> path;
+  const size_t dst_index = dst.y * x_size + dst.x;
+  if( !component[dst_index] )
+  {
+    return path;
+  }
+  for( size_t i = dst_index; i != kNoParent; i = parent[i] )
+  {
+    path.push_back( Coordinate(i % x_size, i / x_size) );
+  }
+  std::reverse( path.begin(), path.end() );
+  return path;
+}
+
+// This method finds a cheapest path from src to dst, where entering a
+// Room costs its weight (see Labyrinth::SetRoomWeight()).
+// The Rooms on the path, including src and dst, are written to path and
+// the total cost is returned. If dst cannot be reached from src, path is
+// emptied and kUnreachable is returned.
+// Nothing is allocated once ws and path have grown to the size of the
+// Labyrinth, so both should be reused between searches.
+// An exception is thrown if:
+//   src or dst is outside the Labyrinth (domain_error)
+uint32_t LabyrinthSolver::CheapestPath( const Coordinate src,
+                                        const Coordinate dst,
+                                        DijkstraWorkspace& ws,
+                                        std::vector<Coordinate>& path ) const
+{
+  const size_t x_size = l_->GetXSize();
+  const size_t y_size = l_->GetYSize();
+  if( src.x >= x_size || src.y >= y_size ||
+      dst.x >= x_size || dst.y >= y_size )
+  {
+    throw std::domain_error( "Error: CheapestPath() was given a "\
+      "Coordinate outside of the Labyrinth.\n" );
+  }
+
+  const uint32_t kNone = UINT32_MAX;
+  const size_t num_rooms = x_size * y_size;
+  ws.cost.assign( num_rooms, kUnreachable );
+  ws.parent.assign( num_rooms, kNone );
+  ws.prev.assign( num_rooms, kNone );
+  ws.next.assign( num_rooms, kNone );
+  ws.buckets.assign( kNumBuckets_, kNone );
+
+  const uint32_t src_index = static_cast<uint32_t>( src.y * x_size + src.x );
+  const uint32_t dst_index = static_cast<uint32_t>( dst.y * x_size + dst.x );
+
+  ws.cost[src_index] = 0;
+  ws.buckets[0] = src_index;
+  size_t queued = 1;
+  uint32_t current = 0;  // Cost of the bucket being emptied
+
+  while( queued > 0 )
+  {
+    uint32_t& bucket = ws.buckets[current % kNumBuckets_];
+    if( bucket == kNone )
+    {
+      ++current;
+      continue;
+    }
+
+    // Costs only increase, so the first Room taken at each cost is final
+    const uint32_t u = bucket;
+    bucket = ws.next[u];
+    if( bucket != kNone )
+    {
+      ws.prev[bucket] = kNone;
+    }
+    --queued;
+    if( u == dst_index )
+    {
+      break;
+    }
+
+    const Coordinate rm( u % x_size, u / x_size );
+    for( const Direction d : kDirections )
+    {
+      if( l_->DirectionCheck(rm, d) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      const Coordinate next_rm = Neighbour( rm, d );
+      const uint32_t v = static_cast<uint32_t>( next_rm.y * x_size +
+                                                next_rm.x );
+      const uint32_t cost = ws.cost[u] + l_->GetRoomWeight(next_rm);
+      if( cost >= ws.cost[v] )
+      {
+        continue;
+      }
+
+      if( ws.cost[v] == kUnreachable )
+      {
+        ++queued;
+      }
+      else  // Already queued at a higher cost; unlinked from that bucket
+      {
+        if( ws.prev[v] != kNone )
+        {
+          ws.next[ws.prev[v]] = ws.next[v];
+        }
+        else
+        {
+          ws.buckets[ws.cost[v] % kNumBuckets_] = ws.next[v];
+        }
+        if( ws.next[v] != kNone )
+        {
+          ws.prev[ws.next[v]] = ws.prev[v];
+        }
+      }
+
+      ws.cost[v] = cost;
+      ws.parent[v] = u;
+      uint32_t& new_bucket = ws.buckets[cost % kNumBuckets_];
+      ws.prev[v] = kNone;
+      ws.next[v] = new_bucket;
+      if( new_bucket != kNone )
+      {
+        ws.prev[new_bucket] = v;
+      }
+      new_bucket = v;
+    }
+  }
+
+  path.clear();
+  if( ws.cost[dst_index] == kUnreachable )
+  {
+    return kUnreachable;
+  }
+  for( uint32_t i = dst_index; i != kNone; i = ws.parent[i] )
+  {
+    path.push_back( Coordinate(i % x_size, i / x_size) );
+  }
+  std::reverse( path.begin(), path.end() );
+  return ws.cost[dst_index];
+}
@@ -0,0 +1,349 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementations of the SpaceTimeSolver class,
+ * which finds paths through a Labyrinth that avoid moving Minotaurs, and
+ * the RoomTurnTable class.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_space_time.hpp"
+
+const uint64_t RoomTurnTable::kEmpty_;
+
+// Default constructor
+RoomTurnTable::RoomTurnTable() :
+  slots_(64, kEmpty_)
+{
+}
+
+// This method removes every pair.
+void RoomTurnTable::Clear()
+{
+  std::fill( slots_.begin(), slots_.end(), kEmpty_ );
+  size_ = 0;
+}
+
+// This method adds the given pair.
+// Returns true if the pair was added, and false if it was already in
+// the table.
+bool RoomTurnTable::Insert( const RoomId rm, const uint32_t turn )
+{
+  // Kept at most half full, so probe sequences stay short
+  if( (size_ + 1) * 2 > slots_.size() )
+  {
+    Grow();
+  }
+
+  const uint64_t key = static_cast<uint64_t>(turn) << 32 | rm;
+  const size_t mask = slots_.size() - 1;
+  for( size_t i = Home(key); ; i = (i + 1) & mask )
+  {
+    if( slots_[i] == key )
+    {
+      return false;
+    }
+    else if( slots_[i] == kEmpty_ )
+    {
+      slots_[i] = key;
+      ++size_;
+      return true;
+    }
+  }
+}
+
+// This method returns true if the given pair is in the table, and false
+// otherwise.
+bool RoomTurnTable::Contains( const RoomId rm, const uint32_t turn ) const
+{
+  const uint64_t key = static_cast<uint64_t>(turn) << 32 | rm;
+  const size_t mask = slots_.size() - 1;
+  for( size_t i = Home(key); ; i = (i + 1) & mask )
+  {
+    if( slots_[i] == key )
+    {
+      return true;
+    }
+    else if( slots_[i] == kEmpty_ )
+    {
+      return false;
+    }
+  }
+}
+
+// This method returns the number of pairs in the table.
+size_t RoomTurnTable::Size() const
+{
+  return size_;
+}
+
+// This private method returns the slot at which to start looking for
+// the given key.
+size_t RoomTurnTable::Home( const uint64_t key ) const
+{
+  // Fibonacci hashing spreads consecutive Rooms and turns across the table
+  const uint64_t hash = key * 0x9E3779B97F4A7C15ull;
+  return static_cast<size_t>( hash >> 32 ) & (slots_.size() - 1);
+}
+
+// This private method doubles the number of slots.
+void RoomTurnTable::Grow()
+{
+  std::vector<uint64_t> old( slots_.size() * 2, kEmpty_ );
+  old.swap( slots_ );
+
+  const size_t mask = slots_.size() - 1;
+  for( const uint64_t key : old )
+  {
+    if( key == kEmpty_ )
+    {
+      continue;
+    }
+    size_t i = Home( key );
+    while( slots_[i] != kEmpty_ )
+    {
+      i = (i + 1) & mask;
+    }
+    slots_[i] = key;
+  }
+}
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+SpaceTimeSolver::SpaceTimeSolver( const Labyrinth* const l ) :
+  l_(l),
+  x_size_(l != nullptr ? l->GetXSize() : 0),
+  num_rooms_(l != nullptr ? l->GetXSize() * l->GetYSize() : 0)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: SpaceTimeSolver() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+  blocked_.assign( num_rooms_, false );
+}
+
+// This method sets the predicted Rooms of the Minotaurs.
+// trajectories[m][t] is the Room of Minotaur m on turn t; each Minotaur
+// stays in the last Room of its trajectory afterwards.
+// An exception is thrown if:
+//   A trajectory is empty (invalid_argument)
+//   A Room is outside the Labyrinth (domain_error)
+void SpaceTimeSolver::SetTrajectories(
+  const std::vector< std::vector<Coordinate> >& trajectories )
+{
+  uint32_t horizon = 0;
+  for( const auto& trajectory : trajectories )
+  {
+    if( trajectory.empty() )
+    {
+      throw std::invalid_argument( "Error: SetTrajectories() was given an "\
+        "empty trajectory.\n" );
+    }
+    horizon = std::max( horizon,
+                        static_cast<uint32_t>(trajectory.size() - 1) );
+  }
+
+  // Checked before anything is changed; GetRoomId() throws domain_error
+  std::vector<RoomId> ids;
+  for( const auto& trajectory : trajectories )
+  {
+    for( const Coordinate& c : trajectory )
+    {
+      ids.push_back( l_->GetRoomId(c) );
+    }
+  }
+
+  reserved_.Clear();
+  blocked_.assign( num_rooms_, false );
+  horizon_ = horizon;
+
+  size_t next_id = 0;
+  for( const auto& trajectory : trajectories )
+  {
+    const RoomId* const rooms = &ids[next_id];
+    const uint32_t last = static_cast<uint32_t>( trajectory.size() - 1 );
+    for( uint32_t t = 0; t < horizon_; ++t )
+    {
+      reserved_.Insert( rooms[std::min(t, last)], t );
+    }
+    blocked_[rooms[last]] = true;
+    next_id += trajectory.size();
+  }
+}
+
+// This method returns the Room of the player on each turn, beginning
+// with src on turn 0, for a path which reaches dst as soon as possible
+// without entering a Room on a turn that a Minotaur is in it, and
+// without passing a Minotaur in a doorway.
+// An empty path is returned if dst cannot be reached safely within
+// max_turns turns.
+// An exception is thrown if:
+//   src or dst is outside the Labyrinth (domain_error)
+std::vector<Coordinate> SpaceTimeSolver::SafePath( const Coordinate src,
+                                                   const Coordinate dst,
+                                                   const uint32_t max_turns )
+{
+  const RoomId src_id = l_->GetRoomId( src );
+  const RoomId dst_id = l_->GetRoomId( dst );
+  const uint32_t kNone = UINT32_MAX;
+
+  std::vector<Coordinate> path;
+  DistancesTo( dst_id );
+  if( distance_[src_id] == kNone || distance_[src_id] > max_turns )
+  {
+    return path;
+  }
+
+  nodes_.clear();
+  open_.clear();
+  closed_.Clear();
+
+  // Priority is the estimated arrival turn, with later turns first among
+  // equal estimates so that the search dives toward dst
+  const auto push = [this]( const RoomId rm,
+                            const uint32_t turn,
+                            const uint32_t parent )
+  {
+    const uint64_t estimate = turn + distance_[rm];
+    nodes_.push_back( Node{rm, turn, parent} );
+    open_.push_back( std::make_pair( estimate << 32 | (UINT32_MAX - turn),
+      static_cast<uint32_t>(nodes_.size() - 1) ) );
+    std::push_heap( open_.begin(), open_.end(), std::greater<>() );
+  };
+
+  push( src_id, 0, kNone );
+  uint32_t found = kNone;
+  while( !open_.empty() )
+  {
+    std::pop_heap( open_.begin(), open_.end(), std::greater<>() );
+    const uint32_t n = open_.back().second;
+    open_.pop_back();
+
+    const Node node = nodes_[n];
+    if( !closed_.Insert(node.rm, std::min(node.turn, horizon_)) )
+    {
+      continue;
+    }
+    if( node.rm == dst_id )
+    {
+      found = n;
+      break;
+    }
+
+    const uint32_t turn = node.turn + 1;
+    RoomId options[5];
+    size_t num_options = ConnectedRooms( node.rm, options );
+    if( node.turn < horizon_ )  // Waiting is pointless once nothing moves
+    {
+      options[num_options++] = node.rm;
+    }
+
+    for( size_t i = 0; i < num_options; ++i )
+    {
+      const RoomId next = options[i];
+      if( distance_[next] == UINT32_MAX ||
+          turn + distance_[next] > max_turns ||
+          IsReserved(next, turn) ||
+          closed_.Contains(next, std::min(turn, horizon_)) )
+      {
+        continue;
+      }
+      // Swapping Rooms with a Minotaur means meeting it in the doorway
+      if( next != node.rm &&
+          IsReserved(next, node.turn) &&
+          IsReserved(node.rm, turn) )
+      {
+        continue;
+      }
+      push( next, turn, n );
+    }
+  }
+
+  if( found == kNone )
+  {
+    return path;
+  }
+  for( uint32_t n = found; n != kNone; n = nodes_[n].parent )
+  {
+    path.push_back( Coordinate(nodes_[n].rm % x_size_,
+                               nodes_[n].rm / x_size_) );
+  }
+  std::reverse( path.begin(), path.end() );
+  return path;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns true if a Minotaur will be in the Room on
+// the given turn, and false otherwise.
+bool SpaceTimeSolver::IsReserved( const RoomId rm, const uint32_t turn ) const
+{
+  if( turn >= horizon_ )
+  {
+    return blocked_[rm];
+  }
+  return reserved_.Contains( rm, turn );
+}
+
+// This private method writes the Rooms connected to rm into out, and
+// returns how many there are.
+size_t SpaceTimeSolver::ConnectedRooms( const RoomId rm, RoomId out[4] ) const
+{
+  const Coordinate c( rm % x_size_, rm / x_size_ );
+  size_t n = 0;
+  if( l_->DirectionCheck(c, Direction::kNorth) == RoomBorder::kRoom )
+  {
+    out[n++] = rm - static_cast<RoomId>(x_size_);
+  }
+  if( l_->DirectionCheck(c, Direction::kEast) == RoomBorder::kRoom )
+  {
+    out[n++] = rm + 1;
+  }
+  if( l_->DirectionCheck(c, Direction::kSouth) == RoomBorder::kRoom )
+  {
+    out[n++] = rm + static_cast<RoomId>(x_size_);
+  }
+  if( l_->DirectionCheck(c, Direction::kWest) == RoomBorder::kRoom )
+  {
+    out[n++] = rm - 1;
+  }
+  return n;
+}
+
+// This private method fills distance_ with the number of moves from each
+// Room to dst, ignoring Minotaurs.
+void SpaceTimeSolver::DistancesTo( const RoomId dst )
+{
+  distance_.assign( num_rooms_, UINT32_MAX );
+  queue_.clear();
+
+  distance_[dst] = 0;
+  queue_.push_back( dst );
+  for( size_t head = 0; head < queue_.size(); ++head )
+  {
+    RoomId next[4];
+    const size_t num_next = ConnectedRooms( queue_[head], next );
+    for( size_t i = 0; i < num_next; ++i )
+    {
+      if( distance_[next[i]] == UINT32_MAX )
+      {
+        distance_[next[i]] = distance_[queue_[head]] + 1;
+        queue_.push_back( next[i] );
+      }
+    }
+  }
+}
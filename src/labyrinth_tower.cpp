@@ -0,0 +1,592 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementations of the LabyrinthTower class,
+ * which stacks Labyrinth floors connected by stairs and pages them to and
+ * from a tower file, and the TowerSolver class.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/diagnostic_log.hpp"
+#include "../include/labyrinth_snapshot.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/labyrinth_save.hpp"
+#include "../include/labyrinth_tower.hpp"
+
+namespace
+{
+
+const char kTowerMagic[] = "TOWR";
+const unsigned char kTowerFormatVersion = 1;
+const size_t kTowerHeaderSize = 10;
+
+// This local function returns the size in bytes of the stairs of a floor
+// with the given sizes.
+size_t StairsSize( const size_t x_size, const size_t y_size );
+
+// This local function returns the size in bytes of the stairs of a floor
+// with the given sizes.
+size_t StairsSize( const size_t x_size, const size_t y_size )
+{
+  return (x_size * y_size + 7) / 8;
+}
+
+}  // Local namespace
+
+// This function creates a tower file with the given number of floors, each
+// of which is a Labyrinth of the given sizes with every Wall intact and no
+// stairs.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+//   An x or y size greater than the maximum is given (domain_error)
+//   The number of floors is 0 or greater than 65535 (invalid_argument)
+//   The file cannot be written (runtime_error)
+void CreateTowerFile( const std::string& filename,
+                      const size_t x_size,
+                      const size_t y_size,
+                      const size_t num_floors )
+{
+  if( num_floors == 0 || num_floors > 0xFFFF )
+  {
+    throw std::invalid_argument( "Error: CreateTowerFile() was given an "\
+      "invalid number of floors.\n" );
+  }
+
+  // The Labyrinth checks the sizes
+  const Labyrinth empty( x_size, y_size );
+  LabyrinthSnapshot s;
+  empty.TakeSnapshot( s );
+  std::vector<unsigned char> record;
+  EncodeSnapshot( s, record );
+  record.resize( record.size() + StairsSize(x_size, y_size), 0 );
+
+  unsigned char header[kTowerHeaderSize] = {};
+  std::memcpy( header, kTowerMagic, 4 );
+  header[4] = kTowerFormatVersion;
+  header[5] = static_cast<unsigned char>( x_size );
+  header[6] = static_cast<unsigned char>( y_size );
+  header[8] = static_cast<unsigned char>( num_floors & 0xFF );
+  header[9] = static_cast<unsigned char>( num_floors >> 8 );
+
+  std::ofstream file( filename, std::ios::binary | std::ios::trunc );
+  file.write( reinterpret_cast<const char*>(header), kTowerHeaderSize );
+  for( size_t f = 0; f < num_floors; ++f )
+  {
+    file.write( reinterpret_cast<const char*>(record.data()),
+                static_cast<std::streamsize>(record.size()) );
+  }
+  if( !file )
+  {
+    throw std::runtime_error( "Error: CreateTowerFile() could not write " +
+      filename + ".\n" );
+  }
+}
+
+// Parameterized constructor
+// Opens an existing tower file.
+// An exception is thrown if:
+//   max_active_floors is 0 (invalid_argument)
+//   The file cannot be opened (runtime_error)
+//   The file is not a valid tower file (runtime_error)
+LabyrinthTower::LabyrinthTower( const std::string& filename,
+                                const size_t max_active_floors ) :
+  filename_(filename),
+  max_active_floors_(max_active_floors)
+{
+  if( max_active_floors == 0 )
+  {
+    throw std::invalid_argument( "Error: LabyrinthTower() was given a "\
+      "limit of 0 active floors.\n" );
+  }
+
+  file_.open( filename, std::ios::binary | std::ios::in | std::ios::out );
+  if( !file_ )
+  {
+    throw std::runtime_error( "Error: LabyrinthTower() could not open " +
+      filename + ".\n" );
+  }
+
+  unsigned char header[kTowerHeaderSize];
+  file_.read( reinterpret_cast<char*>(header), kTowerHeaderSize );
+  if( !file_ ||
+      std::memcmp(header, kTowerMagic, 4) != 0 ||
+      header[4] != kTowerFormatVersion ||
+      header[5] == 0 || header[6] == 0 ||
+      (header[8] | header[9]) == 0 )
+  {
+    throw std::runtime_error( "Error: LabyrinthTower() was given a file "\
+      "which is not a tower file.\n" );
+  }
+  x_size_ = header[5];
+  y_size_ = header[6];
+  num_floors_ = header[8] | (static_cast<size_t>(header[9]) << 8);
+  level_size_ = EncodedSnapshotSize( x_size_, y_size_ );
+  record_size_ = level_size_ + StairsSize( x_size_, y_size_ );
+
+  file_.seekg( 0, std::ios::end );
+  if( static_cast<size_t>(file_.tellg()) !=
+      kTowerHeaderSize + num_floors_ * record_size_ )
+  {
+    throw std::runtime_error( "Error: LabyrinthTower() was given a tower "\
+      "file of the wrong length.\n" );
+  }
+
+  active_.reserve( max_active_floors_ );
+  record_.reserve( record_size_ + StairsSize(x_size_, y_size_) );
+}
+
+// Destructor
+// Writes back every floor which may have been changed.
+LabyrinthTower::~LabyrinthTower()
+{
+  try
+  {
+    Flush();
+  }
+  catch( const std::exception& e )
+  {
+    // A destructor cannot throw; the message names the file, so it is
+    // copied into the log
+    Log( Severity::kError, std::string(e.what()) );
+  }
+}
+
+// This method returns the number of floors.
+size_t LabyrinthTower::NumFloors() const
+{
+  return num_floors_;
+}
+
+// This method returns the number of Rooms along the x-axis of a floor.
+size_t LabyrinthTower::GetXSize() const
+{
+  return x_size_;
+}
+
+// This method returns the number of Rooms along the y-axis of a floor.
+size_t LabyrinthTower::GetYSize() const
+{
+  return y_size_;
+}
+
+// This method returns the number of floors currently in memory.
+size_t LabyrinthTower::ActiveFloors() const
+{
+  return active_.size();
+}
+
+// This method returns the number of times a floor has been read from
+// the file.
+size_t LabyrinthTower::FloorReads() const
+{
+  return floor_reads_;
+}
+
+// This method returns the given floor for changing, reading it from the
+// file if it is not in memory.
+// The reference is valid until another floor is read.
+// An exception is thrown if:
+//   The floor does not exist (domain_error)
+//   The floor cannot be read or written back (runtime_error)
+Labyrinth& LabyrinthTower::Floor( const size_t floor )
+{
+  ActiveFloor& a = Activate( floor );
+  a.dirty = true;
+  return *a.l;
+}
+
+// This method returns the given floor for reading, as Floor() does,
+// without it being written back when it leaves memory.
+const Labyrinth& LabyrinthTower::ReadFloor( const size_t floor )
+{
+  return *Activate( floor ).l;
+}
+
+// This method creates stairs from the given Room up to the same Room on
+// the floor above.
+// An exception is thrown if:
+//   The Room is outside the tower, or on the top floor (domain_error)
+//   The floor cannot be read or written back (runtime_error)
+void LabyrinthTower::SetStairs( const TowerCoordinate rm )
+{
+  if( rm.floor + 1 >= num_floors_ )
+  {
+    throw std::domain_error( "Error: SetStairs() was given a Room with no "\
+      "floor above it.\n" );
+  }
+
+  const RoomId id = Id( rm );
+  ActiveFloor& a = Activate( rm.floor );
+  a.stairs[id] = true;
+  a.dirty = true;
+
+  // The floor above keeps its own copy of these stairs
+  for( ActiveFloor& above : active_ )
+  {
+    if( above.floor == rm.floor + 1 )
+    {
+      above.stairs_down[id] = true;
+    }
+  }
+}
+
+// This method returns true if the Room has stairs up, and false
+// otherwise.
+// An exception is thrown if:
+//   The Room is outside the tower (domain_error)
+//   The floor cannot be read or written back (runtime_error)
+bool LabyrinthTower::HasStairsUp( const TowerCoordinate rm )
+{
+  const RoomId id = Id( rm );
+  return Activate( rm.floor ).stairs[id];
+}
+
+// This method returns true if the Room has stairs down, and false
+// otherwise.
+// An exception is thrown if:
+//   The Room is outside the tower (domain_error)
+//   The floor cannot be read or written back (runtime_error)
+bool LabyrinthTower::HasStairsDown( const TowerCoordinate rm )
+{
+  const RoomId id = Id( rm );
+  return Activate( rm.floor ).stairs_down[id];
+}
+
+// This method writes back every floor which may have been changed.
+// An exception is thrown if:
+//   The file cannot be written (runtime_error)
+void LabyrinthTower::Flush()
+{
+  for( ActiveFloor& a : active_ )
+  {
+    if( a.dirty )
+    {
+      WriteBack( a );
+    }
+  }
+  file_.flush();
+  if( !file_ )
+  {
+    throw std::runtime_error( "Error: Flush() could not write " +
+      filename_ + ".\n" );
+  }
+}
+
+// This method displays a map of the given floor, followed by the Rooms
+// with stairs up and down.
+// An exception is thrown if:
+//   The floor does not exist (domain_error)
+//   The floor cannot be read or written back (runtime_error)
+void LabyrinthTower::DisplayFloor( const size_t floor )
+{
+  std::vector<Coordinate> up;
+  std::vector<Coordinate> down;
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      const TowerCoordinate rm( floor, Coordinate(x, y) );
+      if( HasStairsUp(rm) )
+      {
+        up.push_back( rm.rm );
+      }
+      if( HasStairsDown(rm) )
+      {
+        down.push_back( rm.rm );
+      }
+    }
+  }
+
+  std::cout << "Floor " << floor << ":" << std::endl;
+  LabyrinthMap map( &ReadFloor(floor), x_size_, y_size_, GlyphSet::kUnicode,
+                    MapStorage::kView );
+  map.Display();
+
+  std::cout << "Stairs up:";
+  for( const Coordinate& c : up )
+  {
+    std::cout << " (" << c.x << ", " << c.y << ")";
+  }
+  std::cout << std::endl << "Stairs down:";
+  for( const Coordinate& c : down )
+  {
+    std::cout << " (" << c.x << ", " << c.y << ")";
+  }
+  std::cout << std::endl;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the given floor in memory, reading it
+// and evicting another floor if necessary.
+// An exception is thrown if:
+//   The floor does not exist (domain_error)
+//   The floor cannot be read or written back (runtime_error)
+LabyrinthTower::ActiveFloor& LabyrinthTower::Activate( const size_t floor )
+{
+  if( floor >= num_floors_ )
+  {
+    throw std::domain_error( "Error: LabyrinthTower was given a floor "\
+      "which does not exist.\n" );
+  }
+
+  ++clock_;
+  for( ActiveFloor& a : active_ )
+  {
+    if( a.floor == floor )
+    {
+      a.last_used = clock_;
+      return a;
+    }
+  }
+
+  // The least recently used floor is written back and its Labyrinth reused
+  ActiveFloor* slot = nullptr;
+  if( active_.size() < max_active_floors_ )
+  {
+    active_.emplace_back();
+    slot = &active_.back();
+    slot->l.reset( new Labyrinth(x_size_, y_size_) );
+    slot->floor = num_floors_;  // Matches no floor until it is read
+  }
+  else
+  {
+    slot = &*std::min_element( active_.begin(), active_.end(),
+      []( const ActiveFloor& a, const ActiveFloor& b )
+      {
+        return a.last_used < b.last_used;
+      } );
+    if( slot->dirty )
+    {
+      WriteBack( *slot );
+    }
+  }
+
+  // The stairs up of the floor below follow the record; they are copied
+  // from memory if the floor below is there, since the file may be older
+  const size_t stairs_size = record_size_ - level_size_;
+  const ActiveFloor* below = nullptr;
+  for( const ActiveFloor& a : active_ )
+  {
+    if( floor > 0 && a.floor == floor - 1 && &a != slot )
+    {
+      below = &a;
+    }
+  }
+  record_.assign( record_size_ + stairs_size, 0 );
+  file_.seekg( static_cast<std::streamoff>(
+    kTowerHeaderSize + floor * record_size_) );
+  file_.read( reinterpret_cast<char*>(record_.data()),
+              static_cast<std::streamsize>(record_size_) );
+  if( file_ && floor > 0 && below == nullptr )
+  {
+    file_.seekg( static_cast<std::streamoff>(
+      kTowerHeaderSize + (floor - 1) * record_size_ + level_size_) );
+    file_.read( reinterpret_cast<char*>(record_.data() + record_size_),
+                static_cast<std::streamsize>(stairs_size) );
+  }
+  if( !file_ )
+  {
+    file_.clear();
+    throw std::runtime_error( "Error: LabyrinthTower could not read " +
+      filename_ + ".\n" );
+  }
+
+  // Checked before the slot is changed, so a bad record leaves it as it was
+  DecodeSnapshot( record_.data(), level_size_, snapshot_ );
+  if( snapshot_.x_size != x_size_ || snapshot_.y_size != y_size_ )
+  {
+    throw std::runtime_error( "Error: LabyrinthTower was given a tower "\
+      "file with a floor of the wrong size.\n" );
+  }
+
+  slot->l->RestoreSnapshot( snapshot_ );
+  slot->stairs.resize( x_size_ * y_size_ );
+  const unsigned char* const stairs = record_.data() + level_size_;
+  for( size_t i = 0; i < slot->stairs.size(); ++i )
+  {
+    slot->stairs[i] = (stairs[i / 8] >> (i % 8)) & 1;
+  }
+  if( below != nullptr )
+  {
+    slot->stairs_down = below->stairs;
+  }
+  else
+  {
+    // All 0 for the bottom floor
+    const unsigned char* const stairs_down = stairs + stairs_size;
+    slot->stairs_down.resize( x_size_ * y_size_ );
+    for( size_t i = 0; i < slot->stairs_down.size(); ++i )
+    {
+      slot->stairs_down[i] = (stairs_down[i / 8] >> (i % 8)) & 1;
+    }
+  }
+  slot->floor = floor;
+  slot->dirty = false;
+  ++floor_reads_;
+  slot->last_used = clock_;
+  return *slot;
+}
+
+// This private method writes the floor to its record in the file.
+// An exception is thrown if:
+//   The file cannot be written (runtime_error)
+void LabyrinthTower::WriteBack( ActiveFloor& a )
+{
+  a.l->TakeSnapshot( snapshot_ );
+  EncodeSnapshot( snapshot_, record_ );
+  record_.resize( record_size_, 0 );
+  unsigned char* const stairs = record_.data() + level_size_;
+  std::fill( stairs, stairs + (record_size_ - level_size_), 0 );
+  for( size_t i = 0; i < a.stairs.size(); ++i )
+  {
+    stairs[i / 8] |= static_cast<unsigned char>( a.stairs[i] << (i % 8) );
+  }
+
+  file_.seekp( static_cast<std::streamoff>(
+    kTowerHeaderSize + a.floor * record_size_) );
+  file_.write( reinterpret_cast<const char*>(record_.data()),
+               static_cast<std::streamsize>(record_size_) );
+  if( !file_ )
+  {
+    file_.clear();
+    throw std::runtime_error( "Error: LabyrinthTower could not write " +
+      filename_ + ".\n" );
+  }
+  a.dirty = false;
+}
+
+// This private method returns the RoomId of the given Room.
+// An exception is thrown if:
+//   The Room is outside the tower (domain_error)
+RoomId LabyrinthTower::Id( const TowerCoordinate rm ) const
+{
+  if( rm.floor >= num_floors_ || rm.rm.x >= x_size_ || rm.rm.y >= y_size_ )
+  {
+    throw std::domain_error( "Error: LabyrinthTower was given a Room "\
+      "outside of the tower.\n" );
+  }
+  return static_cast<RoomId>( rm.rm.y * x_size_ + rm.rm.x );
+}
+
+// Parameterized constructor
+// An exception is thrown if:
+//   t is null (invalid_argument)
+TowerSolver::TowerSolver( LabyrinthTower* const t ) :
+  t_(t)
+{
+  if( t == nullptr )
+  {
+    throw std::invalid_argument( "Error: TowerSolver() was given an "\
+      "invalid (null) pointer for the LabyrinthTower.\n" );
+  }
+}
+
+// This method returns the Rooms on a shortest path from src to dst,
+// including both, where taking the stairs is one move.
+// An empty path is returned if dst cannot be reached.
+// An exception is thrown if:
+//   src or dst is outside the tower (domain_error)
+//   A floor cannot be read or written back (runtime_error)
+std::vector<TowerCoordinate> TowerSolver::ShortestPath(
+  const TowerCoordinate src,
+  const TowerCoordinate dst )
+{
+  const uint64_t x_size = t_->GetXSize();
+  const uint64_t rooms_per_floor = x_size * t_->GetYSize();
+  const auto key = [x_size, rooms_per_floor]( const TowerCoordinate& c )
+  {
+    return c.floor * rooms_per_floor + c.rm.y * x_size + c.rm.x;
+  };
+  const auto coordinate = [x_size, rooms_per_floor]( const uint64_t k )
+  {
+    const uint64_t id = k % rooms_per_floor;
+    return TowerCoordinate( k / rooms_per_floor,
+                            Coordinate(id % x_size, id / x_size) );
+  };
+
+  // Checks both Rooms; HasStairsUp() throws domain_error outside the tower
+  t_->HasStairsUp( src );
+  t_->HasStairsUp( dst );
+
+  std::vector<TowerCoordinate> path;
+  parent_.clear();
+  queue_.clear();
+  const uint64_t src_key = key( src );
+  const uint64_t dst_key = key( dst );
+  parent_[src_key] = src_key;
+  queue_.push_back( src_key );
+
+  for( size_t head = 0; head < queue_.size(); ++head )
+  {
+    const uint64_t k = queue_[head];
+    if( k == dst_key )
+    {
+      break;
+    }
+    const TowerCoordinate c = coordinate( k );
+
+    // Up to 6 moves: 4 on the floor, and the stairs up and down
+    TowerCoordinate next[6];
+    size_t num_next = 0;
+    const unsigned char open = t_->ReadFloor( c.floor ).OpenMask( c.rm );
+    for( size_t i = 0; i < 4; ++i )  // North, east, south, west
+    {
+      if( !(open & (1 << i)) )
+      {
+        continue;
+      }
+      const Coordinate n( c.rm.x + (i == 1) - (i == 3),
+                          c.rm.y + (i == 2) - (i == 0) );
+      next[num_next++] = TowerCoordinate( c.floor, n );
+    }
+    if( t_->HasStairsUp(c) )
+    {
+      next[num_next++] = TowerCoordinate( c.floor + 1, c.rm );
+    }
+    if( t_->HasStairsDown(c) )
+    {
+      next[num_next++] = TowerCoordinate( c.floor - 1, c.rm );
+    }
+
+    for( size_t i = 0; i < num_next; ++i )
+    {
+      const uint64_t n = key( next[i] );
+      if( parent_.emplace(n, k).second )
+      {
+        queue_.push_back( n );
+      }
+    }
+  }
+
+  if( parent_.find(dst_key) == parent_.end() )
+  {
+    return path;
+  }
+  for( uint64_t k = dst_key; ; k = parent_[k] )
+  {
+    path.push_back( coordinate(k) );
+    if( k == src_key )
+    {
+      break;
+    }
+  }
+  std::reverse( path.begin(), path.end() );
+  return path;
+}
@@ -0,0 +1,448 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the MazeEvolver class, which
+ * uses a genetic algorithm to search for the most difficult Labyrinth
+ * layouts.
+ *
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_evolver.hpp"
+
+// Parameterized constructor
+// Creates a population of random mazes and evaluates it.
+// num_threads includes the calling thread.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+//   An x or y size greater than the maximum (20) is given
+//     (domain_error)
+//   population_size is less than 2 (invalid_argument)
+//   num_threads is 0 (invalid_argument)
+MazeEvolver::MazeEvolver( const size_t x_size,
+                          const size_t y_size,
+                          const size_t population_size,
+                          const size_t num_threads,
+                          const uint32_t seed ) :
+  x_size_(x_size),
+  y_size_(y_size),
+  num_rooms_(x_size * y_size),
+  num_edges_(x_size > 0 && y_size > 0 ?
+             (x_size - 1) * y_size + x_size * (y_size - 1) : 0),
+  population_size_(population_size),
+  rng_(seed)
+{
+  if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: MazeEvolver() was given a size of "\
+      "0.\n" );
+  }
+  else if( x_size > 20 || y_size > 20 )
+  {
+    throw std::domain_error( "Error: MazeEvolver() was given a size "\
+      "greater than the maximum Labyrinth size.\n" );
+  }
+  else if( population_size < 2 )
+  {
+    throw std::invalid_argument( "Error: MazeEvolver() was given a "\
+      "population of fewer than 2 mazes.\n" );
+  }
+  else if( num_threads == 0 )
+  {
+    throw std::invalid_argument( "Error: MazeEvolver() was given 0 "\
+      "threads.\n" );
+  }
+
+  // Edges to the east come first, then edges to the south
+  edge_a_.resize( num_edges_ );
+  edge_b_.resize( num_edges_ );
+  room_edges_.assign( num_rooms_ * 4, 0 );
+  room_degree_.assign( num_rooms_, 0 );
+  size_t e = 0;
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( size_t x = 0; x + 1 < x_size_; ++x, ++e )
+    {
+      edge_a_[e] = static_cast<uint32_t>( y * x_size_ + x );
+      edge_b_[e] = edge_a_[e] + 1;
+    }
+  }
+  for( size_t y = 0; y + 1 < y_size_; ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x, ++e )
+    {
+      edge_a_[e] = static_cast<uint32_t>( y * x_size_ + x );
+      edge_b_[e] = edge_a_[e] + static_cast<uint32_t>( x_size_ );
+    }
+  }
+  for( e = 0; e < num_edges_; ++e )
+  {
+    const uint32_t a = edge_a_[e];
+    const uint32_t b = edge_b_[e];
+    room_edges_[a * 4 + room_degree_[a]++] = static_cast<uint32_t>( e );
+    room_edges_[b * 4 + room_degree_[b]++] = static_cast<uint32_t>( e );
+  }
+
+  arena_.assign( 2 * population_size_ * num_edges_, 0 );
+  fitness_.assign( population_size_, 0 );
+  edge_order_.resize( num_edges_ );
+  union_find_.resize( num_rooms_ );
+  scratch_.resize( num_threads );
+  for( Scratch& s : scratch_ )
+  {
+    s.distance.resize( num_rooms_ );
+    s.parent.resize( num_rooms_ );
+    s.queue.resize( num_rooms_ );
+  }
+
+  // Random spanning trees; with no parents, Stitch() uses random edges only
+  for( size_t i = 0; i < population_size_; ++i )
+  {
+    Stitch( nullptr, nullptr, true, 0, Genome(current_, i) );
+  }
+
+  for( size_t w = 1; w < num_threads; ++w )
+  {
+    workers_.emplace_back( &MazeEvolver::RunWorker, this, w );
+  }
+  EvaluateAll();
+}
+
+// Destructor
+// Stops the worker threads.
+MazeEvolver::~MazeEvolver()
+{
+  {
+    std::lock_guard<std::mutex> lock( mutex_ );
+    stopping_ = true;
+  }
+  start_.notify_all();
+  for( std::thread& worker : workers_ )
+  {
+    worker.join();
+  }
+}
+
+// This method replaces the population with the next generation.
+// The best maze is always carried over unchanged.
+void MazeEvolver::Step()
+{
+  const size_t next = 1 - current_;
+  std::copy( Genome(current_, best_), Genome(current_, best_) + num_edges_,
+             Genome(next, 0) );
+
+  std::bernoulli_distribution cut_x( 0.5 );
+  std::bernoulli_distribution mutate( 0.5 );
+  for( size_t i = 1; i < population_size_; ++i )
+  {
+    const uint8_t* const parent_a = Genome( current_, Tournament() );
+    const uint8_t* const parent_b = Genome( current_, Tournament() );
+    const bool by_x = cut_x( rng_ );
+    const size_t size = by_x ? x_size_ : y_size_;
+    const size_t cut =
+      std::uniform_int_distribution<size_t>( 0, size )( rng_ );
+
+    uint8_t* const child = Genome( next, i );
+    Stitch( parent_a, parent_b, by_x, cut, child );
+    if( mutate(rng_) )
+    {
+      Mutate( child );
+    }
+  }
+
+  current_ = next;
+  ++generation_;
+  EvaluateAll();
+}
+
+// This method returns the number of generations so far.
+size_t MazeEvolver::Generation() const
+{
+  return generation_;
+}
+
+// This method returns the difficulty of the best maze.
+uint32_t MazeEvolver::BestFitness() const
+{
+  return fitness_[best_];
+}
+
+// This method returns a new Labyrinth with the layout of the best maze.
+std::unique_ptr<Labyrinth> MazeEvolver::BestLabyrinth() const
+{
+  std::unique_ptr<Labyrinth> l( new Labyrinth(x_size_, y_size_) );
+  const uint8_t* const genome = Genome( current_, best_ );
+  for( size_t e = 0; e < num_edges_; ++e )
+  {
+    if( genome[e] )
+    {
+      const Coordinate a( edge_a_[e] % x_size_, edge_a_[e] / x_size_ );
+      const Coordinate b( edge_b_[e] % x_size_, edge_b_[e] / x_size_ );
+      l->ConnectRooms( a, b );
+    }
+  }
+  return l;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the genome with the given index in the
+// given generation.
+uint8_t* MazeEvolver::Genome( const size_t generation, const size_t i )
+{
+  return arena_.data() + (generation * population_size_ + i) * num_edges_;
+}
+
+// This private method returns the genome with the given index in the
+// given generation.
+const uint8_t* MazeEvolver::Genome( const size_t generation,
+                                    const size_t i ) const
+{
+  return arena_.data() + (generation * population_size_ + i) * num_edges_;
+}
+
+// This private method returns the difficulty of the genome.
+uint32_t MazeEvolver::Evaluate( const uint8_t* const genome,
+                                Scratch& s ) const
+{
+  const uint32_t kNone = UINT32_MAX;
+  std::fill( s.distance.begin(), s.distance.end(), kNone );
+
+  // Every Room is reachable, so the breadth-first search also counts the
+  // dead ends
+  uint32_t dead_ends = 0;
+  size_t tail = 0;
+  s.distance[0] = 0;
+  s.queue[tail++] = 0;
+  for( size_t head = 0; head < tail; ++head )
+  {
+    const uint32_t rm = s.queue[head];
+    uint32_t open = 0;
+    for( size_t k = 0; k < room_degree_[rm]; ++k )
+    {
+      const uint32_t e = room_edges_[rm * 4 + k];
+      if( !genome[e] )
+      {
+        continue;
+      }
+      ++open;
+      const uint32_t other = edge_a_[e] == rm ? edge_b_[e] : edge_a_[e];
+      if( s.distance[other] == kNone )
+      {
+        s.distance[other] = s.distance[rm] + 1;
+        s.queue[tail++] = other;
+      }
+    }
+    dead_ends += open == 1;
+  }
+
+  return s.distance[num_rooms_ - 1] + dead_ends;
+}
+
+// This private method evaluates the current generation on all threads.
+void MazeEvolver::EvaluateAll()
+{
+  {
+    std::lock_guard<std::mutex> lock( mutex_ );
+    remaining_ = workers_.size();
+    ++round_;
+  }
+  start_.notify_all();
+
+  EvaluateShare( 0 );
+
+  std::unique_lock<std::mutex> lock( mutex_ );
+  done_.wait( lock, [this]{ return remaining_ == 0; } );
+
+  best_ = static_cast<size_t>(
+    std::max_element(fitness_.begin(), fitness_.end()) - fitness_.begin() );
+}
+
+// This private method evaluates this thread's share of the current
+// generation.
+void MazeEvolver::EvaluateShare( const size_t worker )
+{
+  const size_t num_threads = scratch_.size();
+  for( size_t i = worker; i < population_size_; i += num_threads )
+  {
+    fitness_[i] = Evaluate( Genome(current_, i), scratch_[worker] );
+  }
+}
+
+// This private method is run by each worker thread.
+void MazeEvolver::RunWorker( const size_t worker )
+{
+  size_t round = 0;
+  std::unique_lock<std::mutex> lock( mutex_ );
+  while( true )
+  {
+    start_.wait( lock, [this, round]{ return stopping_ || round_ != round; } );
+    if( stopping_ )
+    {
+      return;
+    }
+    round = round_;
+
+    lock.unlock();
+    EvaluateShare( worker );
+    lock.lock();
+
+    if( --remaining_ == 0 )
+    {
+      done_.notify_one();
+    }
+  }
+}
+
+// This private method returns the index of the fitter of two random
+// genomes in the current generation.
+size_t MazeEvolver::Tournament()
+{
+  std::uniform_int_distribution<size_t> pick( 0, population_size_ - 1 );
+  const size_t a = pick( rng_ );
+  const size_t b = pick( rng_ );
+  return fitness_[a] >= fitness_[b] ? a : b;
+}
+
+// This private method fills child with a random spanning tree, using
+// the edges chosen by the given parents first.
+// Edges in the region before the cut are taken from parent_a, and edges
+// in the region after it from parent_b.
+void MazeEvolver::Stitch( const uint8_t* const parent_a,
+                          const uint8_t* const parent_b,
+                          const bool cut_x,
+                          const size_t cut,
+                          uint8_t* const child )
+{
+  for( size_t rm = 0; rm < num_rooms_; ++rm )
+  {
+    union_find_[rm] = static_cast<uint32_t>( rm );
+  }
+  std::fill( child, child + num_edges_, 0 );
+
+  // Each parent's edges within its region form a forest, so they can all
+  // be taken; the regions are then joined by random edges as in Kruskal's
+  // algorithm, which never closes a loop
+  size_t num_open = 0;
+  const auto join = [this, child, &num_open]( const size_t e )
+  {
+    const uint32_t a = Find( edge_a_[e] );
+    const uint32_t b = Find( edge_b_[e] );
+    if( a != b )
+    {
+      union_find_[a] = b;
+      child[e] = 1;
+      ++num_open;
+    }
+  };
+
+  if( parent_a != nullptr )
+  {
+    for( size_t e = 0; e < num_edges_; ++e )
+    {
+      const size_t a = cut_x ? edge_a_[e] % x_size_ : edge_a_[e] / x_size_;
+      const size_t b = cut_x ? edge_b_[e] % x_size_ : edge_b_[e] / x_size_;
+      if( a < cut && b < cut && parent_a[e] )
+      {
+        join( e );
+      }
+      else if( a >= cut && b >= cut && parent_b[e] )
+      {
+        join( e );
+      }
+    }
+  }
+
+  for( size_t e = 0; e < num_edges_; ++e )
+  {
+    edge_order_[e] = static_cast<uint32_t>( e );
+  }
+  std::shuffle( edge_order_.begin(), edge_order_.end(), rng_ );
+  for( size_t i = 0; i < num_edges_ && num_open + 1 < num_rooms_; ++i )
+  {
+    join( edge_order_[i] );
+  }
+}
+
+// This private method opens a random closed wall of the genome, and
+// closes a random wall on the loop which that creates.
+void MazeEvolver::Mutate( uint8_t* const genome )
+{
+  if( num_rooms_ - 1 == num_edges_ )  // Nothing to flip in a single line
+  {
+    return;
+  }
+
+  // Picks the k-th closed wall
+  size_t k = std::uniform_int_distribution<size_t>(
+    0, num_edges_ - num_rooms_ )( rng_ );
+  size_t added = 0;
+  while( genome[added] || k > 0 )
+  {
+    k -= !genome[added];
+    ++added;
+  }
+
+  // Searches the tree from one side of the wall to the other, recording
+  // the edge by which each Room was reached
+  Scratch& s = scratch_[0];
+  const uint32_t kNone = UINT32_MAX;
+  const uint32_t src = edge_a_[added];
+  const uint32_t dst = edge_b_[added];
+  std::fill( s.parent.begin(), s.parent.end(), kNone );
+  size_t tail = 0;
+  s.queue[tail++] = src;
+  s.parent[src] = static_cast<uint32_t>( added );
+  for( size_t head = 0; head < tail && s.parent[dst] == kNone; ++head )
+  {
+    const uint32_t rm = s.queue[head];
+    for( size_t j = 0; j < room_degree_[rm]; ++j )
+    {
+      const uint32_t e = room_edges_[rm * 4 + j];
+      const uint32_t other = edge_a_[e] == rm ? edge_b_[e] : edge_a_[e];
+      if( genome[e] && s.parent[other] == kNone )
+      {
+        s.parent[other] = e;
+        s.queue[tail++] = other;
+      }
+    }
+  }
+
+  // Walks back along the loop, then closes one of its walls at random
+  size_t loop_length = 0;
+  for( uint32_t rm = dst; rm != src; ++loop_length )
+  {
+    const uint32_t e = s.parent[rm];
+    s.queue[loop_length] = e;
+    rm = edge_a_[e] == rm ? edge_b_[e] : edge_a_[e];
+  }
+  const size_t removed =
+    std::uniform_int_distribution<size_t>( 0, loop_length - 1 )( rng_ );
+  genome[s.queue[removed]] = 0;
+  genome[added] = 1;
+}
+
+// This private method returns the representative Room of the set which
+// contains the given Room, in union_find_.
+uint32_t MazeEvolver::Find( uint32_t rm )
+{
+  while( union_find_[rm] != rm )
+  {
+    union_find_[rm] = union_find_[union_find_[rm]];  // Path halving
+    rm = union_find_[rm];
+  }
+  return rm;
+}
@@ -0,0 +1,511 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the NextHopTable class,
+ * which keeps the first step of a shortest path between every pair of
+ * Rooms in a small Labyrinth.
+ *
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_listener.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/next_hop_table.hpp"
+
+// Definitions of the constants which are passed by reference
+const size_t NextHopTable::kMaxRooms;
+const uint16_t NextHopTable::kUnreachable;
+
+namespace
+{
+
+// The Directions of the hops, in the order of the bits of OpenMask()
+const Direction kDirections[4] = { Direction::kNorth, Direction::kEast,
+                                   Direction::kSouth, Direction::kWest };
+
+// This local function returns the hop from rm_1 to the adjacent rm_2.
+unsigned char HopBetween( const Coordinate rm_1, const Coordinate rm_2 );
+
+// This local function returns the hop from rm_1 to the adjacent rm_2.
+unsigned char HopBetween( const Coordinate rm_1, const Coordinate rm_2 )
+{
+  if( rm_2.y < rm_1.y )
+  {
+    return 0;
+  }
+  else if( rm_2.x > rm_1.x )
+  {
+    return 1;
+  }
+  else if( rm_2.y > rm_1.y )
+  {
+    return 2;
+  }
+  return 3;
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// Builds the table, splitting the destinations between num_threads
+// threads, including the calling thread.
+// If repair is false, the table does not listen to the Labyrinth and
+// is only correct until the Labyrinth next changes; its owner calls
+// Rebuild() before using it again.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+//   num_threads is 0 (invalid_argument)
+//   The Labyrinth has more than kMaxRooms Rooms (domain_error)
+NextHopTable::NextHopTable( const Labyrinth* const l,
+                            const size_t num_threads,
+                            const bool repair ) :
+  l_(l),
+  x_size_(l == nullptr ? 0 : l->GetXSize()),
+  num_rooms_(l == nullptr ? 0 : l->GetXSize() * l->GetYSize()),
+  repair_(repair),
+  row_bytes_((num_rooms_ + 3) / 4),
+  rows_per_band_(num_threads != 0 ?
+                 (num_rooms_ + num_threads - 1) / num_threads : 0)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: NextHopTable() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+  else if( num_threads == 0 )
+  {
+    throw std::invalid_argument( "Error: NextHopTable() was given 0 "\
+      "threads.\n" );
+  }
+  else if( num_rooms_ > kMaxRooms )
+  {
+    throw std::domain_error( "Error: NextHopTable() was given a Labyrinth "\
+      "with too many Rooms.\n" );
+  }
+
+  masks_.resize( num_rooms_ );
+  distances_.resize( num_rooms_ * num_rooms_ );
+  hops_.resize( num_rooms_ * row_bytes_ );
+  distance_1_.resize( num_rooms_ );
+  distance_2_.resize( num_rooms_ );
+  hop_1_.resize( num_rooms_ );
+  hop_2_.resize( num_rooms_ );
+  queue_.reserve( num_rooms_ );
+  stale_.reserve( num_rooms_ );
+
+  // Threads with no destinations to search are not started
+  for( size_t w = 1; w < num_threads && w * rows_per_band_ < num_rooms_;
+       ++w )
+  {
+    workers_.emplace_back( &NextHopTable::RunWorker, this, w );
+  }
+
+  Build();
+  if( repair_ )
+  {
+    l_->AddListener( this );
+  }
+}
+
+// Destructor
+// Stops the worker threads and stops listening to the Labyrinth.
+NextHopTable::~NextHopTable()
+{
+  {
+    std::lock_guard<std::mutex> lock( mutex_ );
+    stopping_ = true;
+  }
+  start_.notify_all();
+  for( std::thread& worker : workers_ )
+  {
+    worker.join();
+  }
+  if( repair_ )
+  {
+    l_->RemoveListener( this );
+  }
+}
+
+// This method returns the Direction of the first step of a shortest
+// path from src to dst, or Direction::kNone if src is dst or dst
+// cannot be reached.
+// An exception is thrown if:
+//   src or dst is outside the Labyrinth (domain_error)
+Direction NextHopTable::NextHop( const Coordinate src,
+                                 const Coordinate dst ) const
+{
+  const char* const message = "Error: NextHop() was given a Coordinate "\
+    "outside of the Labyrinth.\n";
+  const RoomId s = Id( src, message );
+  const RoomId d = Id( dst, message );
+  const uint16_t distance = distances_[d * num_rooms_ + s];
+  if( distance == 0 || distance == kUnreachable )
+  {
+    return Direction::kNone;
+  }
+  return kDirections[Hop( d, s )];
+}
+
+// This method returns the number of steps from src to dst, or
+// kUnreachable.
+// An exception is thrown if:
+//   src or dst is outside the Labyrinth (domain_error)
+uint16_t NextHopTable::Distance( const Coordinate src,
+                                 const Coordinate dst ) const
+{
+  const char* const message = "Error: Distance() was given a Coordinate "\
+    "outside of the Labyrinth.\n";
+  const RoomId s = Id( src, message );
+  return distances_[Id( dst, message ) * num_rooms_ + s];
+}
+
+// This method writes the Rooms on a shortest path from src to dst,
+// including both, into path by following the table; path is emptied
+// if dst cannot be reached.
+// An exception is thrown if:
+//   src or dst is outside the Labyrinth (domain_error)
+void NextHopTable::ShortestPath( const Coordinate src,
+                                 const Coordinate dst,
+                                 std::vector<Coordinate>& path ) const
+{
+  const char* const message = "Error: ShortestPath() was given a "\
+    "Coordinate outside of the Labyrinth.\n";
+  RoomId id = Id( src, message );
+  const RoomId d = Id( dst, message );
+
+  path.clear();
+  if( distances_[d * num_rooms_ + id] == kUnreachable )
+  {
+    return;
+  }
+  path.reserve( distances_[d * num_rooms_ + id] + 1 );
+  path.push_back( src );
+  while( id != d )
+  {
+    id = Step( id, Hop(d, id) );
+    path.push_back( Coordinate(id % x_size_, id / x_size_) );
+  }
+}
+
+// This method writes the Rooms on a shortest path from src to dst into
+// path, as above, and sets component to mark every Room reachable from
+// src, as LabyrinthSolver::ShortestPath() does.
+// An exception is thrown if:
+//   src or dst is outside the Labyrinth (domain_error)
+void NextHopTable::ShortestPath( const Coordinate src,
+                                 const Coordinate dst,
+                                 std::vector<Coordinate>& path,
+                                 std::vector<bool>& component ) const
+{
+  ShortestPath( src, dst, path );
+
+  // Distances are symmetric, so the row of src holds the distances from it
+  const uint16_t* const row = &distances_[(src.y * x_size_ + src.x) *
+                                          num_rooms_];
+  component.resize( num_rooms_ );
+  for( size_t id = 0; id < num_rooms_; ++id )
+  {
+    component[id] = row[id] != kUnreachable;
+  }
+}
+
+// This method returns the number of destinations searched since the
+// table was created, including the initial build.
+size_t NextHopTable::Searches() const
+{
+  return searches_;
+}
+
+// This method reads the walls of the Labyrinth again and searches from
+// every destination.
+void NextHopTable::Rebuild()
+{
+  Build();
+}
+
+// This method adds the paths which can use the new connection.
+void NextHopTable::RoomsConnected( const Coordinate rm_1,
+                                   const Coordinate rm_2 )
+{
+  const RoomId a = static_cast<RoomId>( rm_1.y * x_size_ + rm_1.x );
+  const RoomId b = static_cast<RoomId>( rm_2.y * x_size_ + rm_2.x );
+  masks_[a] = l_->OpenMask( rm_1 );
+  masks_[b] = l_->OpenMask( rm_2 );
+
+  // The distances and hops towards a and b before the connection; the
+  // rows of a and b are changed below while they are still needed
+  for( RoomId s = 0; s < num_rooms_; ++s )
+  {
+    distance_1_[s] = distances_[a * num_rooms_ + s];
+    distance_2_[s] = distances_[b * num_rooms_ + s];
+    hop_1_[s] = Hop( a, s );
+    hop_2_[s] = Hop( b, s );
+  }
+  const unsigned char a_to_b = HopBetween( rm_1, rm_2 );
+  const unsigned char b_to_a = HopBetween( rm_2, rm_1 );
+
+  for( RoomId t = 0; t < num_rooms_; ++t )
+  {
+    // A path to t can only be shortened by crossing from a to b (or b to
+    // a) if t is more than one step closer to b than to a (or to a than
+    // to b)
+    const uint32_t t_a = distance_1_[t];
+    const uint32_t t_b = distance_2_[t];
+    if( t_b + 1 >= t_a && t_a + 1 >= t_b )
+    {
+      continue;
+    }
+
+    uint16_t* const row = &distances_[t * num_rooms_];
+    const bool through_a = t_b + 1 < t_a;
+    const uint32_t far_side = through_a ? t_b + 1 : t_a + 1;
+    const std::vector<uint16_t>& near = through_a ? distance_1_ : distance_2_;
+    const std::vector<unsigned char>& near_hop = through_a ? hop_1_ : hop_2_;
+    const RoomId entry = through_a ? a : b;
+    const unsigned char crossing = through_a ? a_to_b : b_to_a;
+    for( RoomId s = 0; s < num_rooms_; ++s )
+    {
+      if( near[s] == kUnreachable )
+      {
+        continue;
+      }
+      const uint32_t distance = near[s] + far_side;
+      if( distance < row[s] )
+      {
+        row[s] = static_cast<uint16_t>( distance );
+        SetHop( t, s, s == entry ? crossing : near_hop[s] );
+      }
+    }
+  }
+}
+
+// This method repairs the paths which used the removed connection.
+void NextHopTable::RoomsDisconnected( const Coordinate rm_1,
+                                      const Coordinate rm_2 )
+{
+  const RoomId a = static_cast<RoomId>( rm_1.y * x_size_ + rm_1.x );
+  const RoomId b = static_cast<RoomId>( rm_2.y * x_size_ + rm_2.x );
+  masks_[a] = l_->OpenMask( rm_1 );
+  masks_[b] = l_->OpenMask( rm_2 );
+
+  // No distance to t changes if the Room further from t still has another
+  // neighbour as close to t as the nearer Room
+  stale_.clear();
+  for( RoomId t = 0; t < num_rooms_; ++t )
+  {
+    const uint16_t* const row = &distances_[t * num_rooms_];
+    if( row[a] == row[b] )
+    {
+      continue;
+    }
+    const RoomId far = row[a] < row[b] ? b : a;
+    const uint16_t near_distance = std::min( row[a], row[b] );
+    bool kept = false;
+    for( unsigned char h = 0; h < 4 && !kept; ++h )
+    {
+      kept = (masks_[far] >> h & 1) && row[Step(far, h)] == near_distance;
+    }
+    if( !kept )
+    {
+      stale_.push_back( t );
+    }
+  }
+
+  for( const RoomId t : stale_ )
+  {
+    Search( t, queue_ );
+  }
+  searches_ += stale_.size();
+
+  Redirect( a, b );
+  Redirect( b, a );
+}
+
+// This method rebuilds the table.
+void NextHopTable::LabyrinthReset()
+{
+  Build();
+}
+
+// PRIVATE METHODS:
+
+// This private method reads the walls of every Room and searches from
+// every destination.
+void NextHopTable::Build()
+{
+  for( RoomId id = 0; id < num_rooms_; ++id )
+  {
+    masks_[id] = l_->OpenMask( Coordinate(id % x_size_, id / x_size_) );
+  }
+
+  // Every thread writes only the rows of its own destinations
+  if( workers_.empty() )
+  {
+    SearchBand( 0, queue_ );
+  }
+  else
+  {
+    {
+      std::lock_guard<std::mutex> lock( mutex_ );
+      remaining_ = workers_.size();
+      ++round_;
+    }
+    start_.notify_all();
+
+    SearchBand( 0, queue_ );
+
+    std::unique_lock<std::mutex> lock( mutex_ );
+    done_.wait( lock, [this]{ return remaining_ == 0; } );
+  }
+  searches_ += num_rooms_;
+}
+
+// This private method searches from the band of destinations of the
+// given worker, using queue as scratch space.
+void NextHopTable::SearchBand( const size_t worker,
+                               std::vector<RoomId>& queue )
+{
+  const size_t begin = std::min( worker * rows_per_band_, num_rooms_ );
+  const size_t end = std::min( begin + rows_per_band_, num_rooms_ );
+  for( size_t dst = begin; dst < end; ++dst )
+  {
+    Search( static_cast<RoomId>(dst), queue );
+  }
+}
+
+// This private method is run by each worker thread.
+void NextHopTable::RunWorker( const size_t worker )
+{
+  std::vector<RoomId> queue;
+  queue.reserve( num_rooms_ );
+
+  size_t round = 0;
+  std::unique_lock<std::mutex> lock( mutex_ );
+  while( true )
+  {
+    start_.wait( lock, [this, round]{ return stopping_ || round_ != round; } );
+    if( stopping_ )
+    {
+      return;
+    }
+    round = round_;
+
+    lock.unlock();
+    SearchBand( worker, queue );
+    lock.lock();
+
+    if( --remaining_ == 0 )
+    {
+      done_.notify_one();
+    }
+  }
+}
+
+// This private method fills the distances and hops to dst.
+void NextHopTable::Search( const RoomId dst, std::vector<RoomId>& queue )
+{
+  uint16_t* const row = &distances_[dst * num_rooms_];
+  std::fill( row, row + num_rooms_, kUnreachable );
+  row[dst] = 0;
+  queue.clear();
+  queue.push_back( dst );
+  for( size_t i = 0; i < queue.size(); ++i )
+  {
+    const RoomId id = queue[i];
+    const unsigned char mask = masks_[id];
+    for( unsigned char h = 0; h < 4; ++h )
+    {
+      const RoomId next = Step( id, h );
+      if( (mask >> h & 1) && row[next] == kUnreachable )
+      {
+        row[next] = static_cast<uint16_t>( row[id] + 1 );
+        SetHop( dst, next, (h + 2) & 3 );  // Back the way it was reached
+        queue.push_back( next );
+      }
+    }
+  }
+}
+
+// This private method returns the hop from src towards dst.
+unsigned char NextHopTable::Hop( const RoomId dst, const RoomId src ) const
+{
+  return hops_[dst * row_bytes_ + src / 4] >> (src % 4 * 2) & 3;
+}
+
+// This private method sets the hop from src towards dst.
+void NextHopTable::SetHop( const RoomId dst,
+                           const RoomId src,
+                           const unsigned char h )
+{
+  unsigned char& packed = hops_[dst * row_bytes_ + src / 4];
+  const unsigned int shift = src % 4 * 2;
+  packed = static_cast<unsigned char>( (packed & ~(3u << shift)) |
+                                       h << shift );
+}
+
+// This private method returns the neighbour of the Room in the
+// direction of the hop.
+RoomId NextHopTable::Step( const RoomId id, const unsigned char h ) const
+{
+  const RoomId x_size = static_cast<RoomId>( x_size_ );
+  switch( h )
+  {
+    case 0:
+      return id - x_size;
+    case 1:
+      return id + 1;
+    case 2:
+      return id + x_size;
+    default:
+      return id - 1;
+  }
+}
+
+// This private method points the hops of rm towards dst, for every
+// destination whose hop crossed to gone, at another neighbour one step
+// closer.
+void NextHopTable::Redirect( const RoomId rm, const RoomId gone )
+{
+  for( RoomId t = 0; t < num_rooms_; ++t )
+  {
+    const uint16_t* const row = &distances_[t * num_rooms_];
+    if( row[rm] == 0 || row[rm] == kUnreachable ||
+        Step(rm, Hop(t, rm)) != gone )
+    {
+      continue;
+    }
+    for( unsigned char h = 0; h < 4; ++h )
+    {
+      if( (masks_[rm] >> h & 1) && row[Step(rm, h)] + 1 == row[rm] )
+      {
+        SetHop( t, rm, h );
+        break;
+      }
+    }
+  }
+}
+
+// This private method returns the RoomId of the Room, or throws if it
+// is outside the Labyrinth.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+RoomId NextHopTable::Id( const Coordinate rm,
+                         const char* const message ) const
+{
+  if( rm.x >= x_size_ || rm.y >= l_->GetYSize() )
+  {
+    throw std::domain_error( message );
+  }
+  return static_cast<RoomId>( rm.y * x_size_ + rm.x );
+}
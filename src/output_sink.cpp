@@ -0,0 +1,214 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the OutputSink interface and
+ * its implementations.
+ *
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "../include/status.hpp"
+#include "../include/output_sink.hpp"
+
+// This method writes the given segments in order, as Write() would for
+// each of them.
+// An exception is thrown if:
+//   The bytes cannot be written (runtime_error)
+void OutputSink::WriteSegments( const OutputSegment* const segments,
+                                const size_t count )
+{
+  for( size_t i = 0; i < count; ++i )
+  {
+    Write( segments[i].data, segments[i].size );
+  }
+}
+
+// This method appends the given bytes to the buffer.
+void BufferSink::Write( const char* const data, const size_t size )
+{
+  buffer_.append( data, size );
+}
+
+// This method returns everything written since the last Clear().
+const std::string& BufferSink::Contents() const
+{
+  return buffer_;
+}
+
+// This method empties the buffer, keeping its memory for reuse.
+void BufferSink::Clear()
+{
+  buffer_.clear();
+}
+
+// Parameterized constructor
+// An exception is thrown if:
+//   f is null (invalid_argument)
+FileSink::FileSink( FILE* const f ) :
+  f_(f)
+{
+  if( f == nullptr )
+  {
+    RaiseError( Status(ErrorCode::kInvalidArgument, "Error: FileSink() was "\
+      "given an invalid (null) pointer for the stream.\n") );
+  }
+}
+
+// This method writes the given bytes to the stream.
+// An exception is thrown if:
+//   The bytes cannot be written (runtime_error)
+void FileSink::Write( const char* const data, const size_t size )
+{
+  if( std::fwrite(data, 1, size, f_) != size )
+  {
+    RaiseError( Status(ErrorCode::kRuntimeError, "Error: FileSink could not "\
+      "write to the stream.\n") );
+  }
+}
+
+// Parameterized constructor
+// An exception is thrown if:
+//   fd is negative (invalid_argument)
+FdSink::FdSink( const int fd ) :
+  fd_(fd)
+{
+  if( fd < 0 )
+  {
+    RaiseError( Status(ErrorCode::kInvalidArgument, "Error: FdSink() was "\
+      "given an invalid (negative) file descriptor.\n") );
+  }
+}
+
+// This method writes the given bytes to the file descriptor.
+// An exception is thrown if:
+//   The bytes cannot be written (runtime_error)
+void FdSink::Write( const char* const data, const size_t size )
+{
+  const OutputSegment segment = { data, size };
+  WriteSegments( &segment, 1 );
+}
+
+// This method writes the given segments in order with writev(),
+// continuing after partial writes and interruptions.
+// An exception is thrown if:
+//   The bytes cannot be written (runtime_error)
+void FdSink::WriteSegments( const OutputSegment* const segments,
+                            const size_t count )
+{
+  iov_.clear();
+  for( size_t i = 0; i < count; ++i )
+  {
+    if( segments[i].size > 0 )
+    {
+      iovec v;
+      v.iov_base = const_cast<char*>( segments[i].data );
+      v.iov_len = segments[i].size;
+      iov_.push_back( v );
+    }
+  }
+
+  size_t first = 0;
+  while( first < iov_.size() )
+  {
+    const size_t batch = std::min<size_t>( iov_.size() - first, IOV_MAX );
+    const ssize_t written = writev( fd_, &iov_[first],
+                                    static_cast<int>(batch) );
+    if( written < 0 )
+    {
+      if( errno == EINTR )
+      {
+        continue;
+      }
+      RaiseError( ErrorCode::kRuntimeError, std::string("Error: FdSink "\
+        "could not write to the file descriptor: ") + std::strerror(errno) +
+        ".\n" );
+    }
+
+    // Skips the segments written in full, and the written part of the
+    // next one
+    size_t remaining = static_cast<size_t>( written );
+    while( first < iov_.size() && remaining >= iov_[first].iov_len )
+    {
+      remaining -= iov_[first].iov_len;
+      ++first;
+    }
+    if( remaining > 0 )
+    {
+      iov_[first].iov_base = static_cast<char*>( iov_[first].iov_base ) +
+                             remaining;
+      iov_[first].iov_len -= remaining;
+    }
+  }
+}
+
+// This method discards the given bytes.
+void NullSink::Write( const char* const data, const size_t size )
+{
+  // Avoiding unused parameter warning
+  (void)(data);
+
+  bytes_ += size;
+}
+
+// This method discards the given segments without visiting the bytes.
+void NullSink::WriteSegments( const OutputSegment* const segments,
+                              const size_t count )
+{
+  for( size_t i = 0; i < count; ++i )
+  {
+    bytes_ += segments[i].size;
+  }
+}
+
+// This method returns the number of bytes discarded.
+size_t NullSink::Bytes() const
+{
+  return bytes_;
+}
+
+// Parameterized constructor
+StreamSink::StreamSink( std::ostream& os ) :
+  os_(os)
+{
+}
+
+// This method writes the given bytes to the stream.
+// An exception is thrown if:
+//   The bytes cannot be written (runtime_error)
+void StreamSink::Write( const char* const data, const size_t size )
+{
+  if( !os_.write(data, static_cast<std::streamsize>(size)) )
+  {
+    RaiseError( Status(ErrorCode::kRuntimeError, "Error: StreamSink could not "\
+      "write to the stream.\n") );
+  }
+}
+
+// This method writes the given segments to the stream, then flushes
+// it.
+// An exception is thrown if:
+//   The bytes cannot be written (runtime_error)
+void StreamSink::WriteSegments( const OutputSegment* const segments,
+                                const size_t count )
+{
+  OutputSink::WriteSegments( segments, count );
+  if( !os_.flush() )
+  {
+    RaiseError( Status(ErrorCode::kRuntimeError, "Error: StreamSink could not "\
+      "write to the stream.\n") );
+  }
+}
@@ -8,10 +8,8 @@
  *
  */
 
-#include <iostream>
-#include <stdexcept>
-
 #include "../include/room_properties.hpp"
+#include "../include/status.hpp"
 #include "../include/room.hpp"
 
 // Default constructor
@@ -71,18 +69,55 @@ void Room::SetItem( const Item itm )
 //   Direction d is null (i.e. Direction::kNone) (invalid_argument)
 //   The Wall has already been removed (logic_error)
 void Room::BreakWall( const Direction d )
+{
+  RaiseIfError( TryBreakWall(d) );
+}
+
+// This method restores the Wall in the given direction, so that the
+// Room is no longer connected to another.
+// An exception is thrown if:
+//   Direction d is null (i.e. Direction::kNone) (invalid_argument)
+//   Direction d has the exit (logic_error)
+//   The Wall is already intact (logic_error)
+void Room::BuildWall( const Direction d )
+{
+  RaiseIfError( TryBuildWall(d) );
+}
+
+// This method creates an exit in the given direction. The Wall
+// should be intact (BreakWall() not called on it beforehand).
+// An exception is thrown if:
+//   Direction d is null (i.e. Direction::kNone) (invalid_argument)
+//   The Wall has already been removed (logic_error)
+//   The Exit has already been created (logic_error)
+void Room::CreateExit( const Direction d )
+{
+  RaiseIfError( TryCreateExit(d) );
+}
+
+// This method returns the type of RoomBorder in the given direction.
+// An exception is thrown if:
+//   Direction d is kNone (invalid_argument)
+RoomBorder Room::DirectionCheck( const Direction d ) const
+{
+  return ValueOrRaise( TryDirectionCheck(d) );
+}
+
+// This method removes the Wall in the given direction as BreakWall()
+// does, returning the error instead of throwing it.
+Status Room::TryBreakWall( const Direction d )
 {
   switch( d )
   {
     case( Direction::kNone ):
-      throw std::invalid_argument( "Error: BreakWall() was given an "\
-        "invalid Direction (kNone).\n");
+      return Status( ErrorCode::kInvalidArgument, "Error: BreakWall() was "\
+        "given an invalid Direction (kNone).\n" );
 
     case( Direction::kNorth ):
       if( !wall_north_ )  // Wall already removed
       {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
+        return Status( ErrorCode::kLogicError, "Error: BreakWall() was "\
+          "given an already-removed Wall.\n" );
       }
       wall_north_ = false;
       break;
@@ -90,8 +125,8 @@ void Room::BreakWall( const Direction d )
     case( Direction::kEast ):
       if( !wall_east_ )
       {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
+        return Status( ErrorCode::kLogicError, "Error: BreakWall() was "\
+          "given an already-removed Wall.\n" );
       }
       wall_east_ = false;
       break;
@@ -99,8 +134,8 @@ void Room::BreakWall( const Direction d )
     case( Direction::kSouth ):
       if( !wall_south_ )
       {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
+        return Status( ErrorCode::kLogicError, "Error: BreakWall() was "\
+          "given an already-removed Wall.\n" );
       }
       wall_south_ = false;
       break;
@@ -108,63 +143,83 @@ void Room::BreakWall( const Direction d )
     case( Direction::kWest ):
       if( !wall_west_ )
       {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
+        return Status( ErrorCode::kLogicError, "Error: BreakWall() was "\
+          "given an already-removed Wall.\n" );
       }
       wall_west_ = false;
       break;
   }
-  return;
+  return Status();
 }
 
-// This method creates an exit in the given direction. The Wall
-// should be intact (BreakWall() not called on it beforehand).
-// An exception is thrown if:
-//   Direction d is null (i.e. Direction::kNone) (invalid_argument)
-//   The Wall has already been removed (logic_error)
-//   The Exit has already been created (logic_error)
-void Room::CreateExit( const Direction d )
+// This method restores the Wall in the given direction as BuildWall()
+// does, returning the error instead of throwing it.
+Status Room::TryBuildWall( const Direction d )
 {
   if( d == Direction::kNone )
   {
-    throw std::invalid_argument( "Error: CreateExit() was given the "\
-      "direction kNone.\n" );
+    return Status( ErrorCode::kInvalidArgument, "Error: BuildWall() was "\
+      "given an invalid Direction (kNone).\n" );
   }
-  else if (DirectionCheck(d) != RoomBorder::kWall)
+  else if( d == exit_ )
   {
-    throw std::logic_error( "Error: CreateExit() was given a Wall "\
-      "which has already been broken." );
+    return Status( ErrorCode::kLogicError, "Error: BuildWall() was given "\
+      "the Direction of the exit.\n" );
   }
-  else if( exit_ != Direction::kNone )
+
+  bool& wall = d == Direction::kNorth ? wall_north_ :
+               d == Direction::kEast  ? wall_east_  :
+               d == Direction::kSouth ? wall_south_ :
+                                        wall_west_;
+  if( wall )
   {
-    throw std::logic_error( "Error: CreateExit() was given a Room "\
-      "which already has an exit.\n" );
+    return Status( ErrorCode::kLogicError, "Error: BuildWall() was given "\
+      "an intact Wall.\n" );
   }
+  wall = true;
+  return Status();
+}
 
-  try
+// This method creates an exit in the given direction as CreateExit()
+// does, returning the error instead of throwing it.
+Status Room::TryCreateExit( const Direction d )
+{
+  if( d == Direction::kNone )
+  {
+    return Status( ErrorCode::kInvalidArgument, "Error: CreateExit() was "\
+      "given the direction kNone.\n" );
+  }
+  else if( TryDirectionCheck(d).Value() != RoomBorder::kWall )
   {
-    BreakWall(d);
+    return Status( ErrorCode::kLogicError, "Error: CreateExit() was given "\
+      "a Wall which has already been broken." );
   }
-  catch( const std::exception& e )
+  else if( exit_ != Direction::kNone )
   {
-    std::cout << e.what();
-    return;
+    return Status( ErrorCode::kLogicError, "Error: CreateExit() was given "\
+      "a Room which already has an exit.\n" );
+  }
+
+  const Status broken = TryBreakWall(d);
+  if( !broken.IsOk() )
+  {
+    return broken;
   }
   exit_ = d;
+  return Status();
 }
 
-// This method returns:
+// This method returns the type of RoomBorder in the given direction as
+// DirectionCheck() does, returning the error instead of throwing it:
 //   RoomBorder::kExit if the direction has the exit,
 //   RoomBorder::kRoom if the direction has another room, or
 //   RoomBorder::kWall if the direction has a wall.
-// An exception is thrown if:
-//   Direction d is kNone (invalid_argument)
-RoomBorder Room::DirectionCheck( const Direction d ) const
+Expected<RoomBorder> Room::TryDirectionCheck( const Direction d ) const
 {
   if( d == Direction::kNone )
   {
-    throw std::invalid_argument( "Error: DirectionCheck() was given the "\
-      "direction kNone.\n" ) ;
+    return Status( ErrorCode::kInvalidArgument, "Error: DirectionCheck() "\
+      "was given the direction kNone.\n" );
   }
 
   if( d == exit_ )
@@ -185,3 +240,21 @@ RoomBorder Room::DirectionCheck( const Direction d ) const
     return RoomBorder::kWall;
   }
 }
+
+// This method returns the Directions which lead to another Room, as a
+// mask with bit 0 set for north, bit 1 for east, bit 2 for south, and
+// bit 3 for west.
+// The exit does not lead to another Room.
+unsigned char Room::OpenMask() const
+{
+  // The exit is a broken wall, so it is masked out afterwards
+  unsigned char mask = static_cast<unsigned char>( (!wall_north_) |
+                                                   (!wall_east_  << 1) |
+                                                   (!wall_south_ << 2) |
+                                                   (!wall_west_  << 3) );
+  if( exit_ != Direction::kNone )
+  {
+    mask &= ~( 1 << (static_cast<int>(exit_) - 1) );
+  }
+  return mask;
+}
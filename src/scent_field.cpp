@@ -0,0 +1,263 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the ScentField class, which
+ * spreads the scent of a player through the open walls of a Labyrinth.
+ *
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_listener.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/scent_field.hpp"
+
+// Parameterized constructor
+// Every Room starts with no scent. The rows are split into num_threads
+// bands, each updated on its own thread; num_threads includes the
+// calling thread.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+//   num_threads is 0 (invalid_argument)
+ScentField::ScentField( const Labyrinth* const l,
+                        const size_t num_threads ) :
+  l_(l),
+  x_size_(l != nullptr ? l->GetXSize() : 0),
+  y_size_(l != nullptr ? l->GetYSize() : 0),
+  stride_(x_size_ + 2),
+  rows_per_band_(num_threads != 0 ?
+                 (y_size_ + num_threads - 1) / num_threads : 0)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: ScentField() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+  else if( num_threads == 0 )
+  {
+    throw std::invalid_argument( "Error: ScentField() was given 0 "\
+      "threads.\n" );
+  }
+
+  const size_t padded_size = stride_ * (y_size_ + 2);
+  scent_.assign( padded_size, 0 );
+  next_.assign( padded_size, 0 );
+  open_north_.assign( padded_size, 0 );
+  open_east_.assign( padded_size, 0 );
+  open_south_.assign( padded_size, 0 );
+  open_west_.assign( padded_size, 0 );
+
+  LabyrinthReset();
+  l_->AddListener( this );
+
+  // Threads with no rows to update are not started
+  for( size_t w = 1; w < num_threads && w * rows_per_band_ < y_size_; ++w )
+  {
+    workers_.emplace_back( &ScentField::RunWorker, this, w );
+  }
+}
+
+// Destructor
+// Stops the worker threads and stops listening to the Labyrinth.
+ScentField::~ScentField()
+{
+  {
+    std::lock_guard<std::mutex> lock( mutex_ );
+    stopping_ = true;
+  }
+  start_.notify_all();
+  for( std::thread& worker : workers_ )
+  {
+    worker.join();
+  }
+  l_->RemoveListener( this );
+}
+
+// This method sets the fraction of the scent, out of 256, which decays
+// away on every Update(). The default is 16.
+void ScentField::SetDecay( const uint8_t decay )
+{
+  decay_ = decay;
+}
+
+// This method raises the scent of the given Room to at least the given
+// strength.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+void ScentField::Emit( const Coordinate rm, const uint16_t strength )
+{
+  uint16_t& scent = scent_[Index(rm)];
+  scent = std::max( scent, strength );
+}
+
+// This method returns the scent of the given Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+uint16_t ScentField::ScentAt( const Coordinate rm ) const
+{
+  return scent_[Index(rm)];
+}
+
+// This method advances the field by one tick.
+void ScentField::Update()
+{
+  // Every band reads scent_ and writes its own rows of next_, so the bands
+  // do not need to be synchronized until the buffers are swapped
+  if( workers_.empty() )
+  {
+    UpdateRows( 0, y_size_ );
+  }
+  else
+  {
+    {
+      std::lock_guard<std::mutex> lock( mutex_ );
+      remaining_ = workers_.size();
+      ++round_;
+    }
+    start_.notify_all();
+
+    UpdateBand( 0 );
+
+    std::unique_lock<std::mutex> lock( mutex_ );
+    done_.wait( lock, [this]{ return remaining_ == 0; } );
+  }
+
+  scent_.swap( next_ );
+}
+
+// This method re-reads the walls on either side of the two Rooms.
+void ScentField::RoomsConnected( const Coordinate rm_1, const Coordinate rm_2 )
+{
+  ReadWalls( rm_1 );
+  ReadWalls( rm_2 );
+}
+
+// This method re-reads the walls on either side of the two Rooms.
+void ScentField::RoomsDisconnected( const Coordinate rm_1,
+                                    const Coordinate rm_2 )
+{
+  ReadWalls( rm_1 );
+  ReadWalls( rm_2 );
+}
+
+// This method re-reads every wall of the Labyrinth.
+void ScentField::LabyrinthReset()
+{
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      ReadWalls( Coordinate(x, y) );
+    }
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the index of the given Room in the
+// padded arrays.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+size_t ScentField::Index( const Coordinate rm ) const
+{
+  if( rm.x >= x_size_ || rm.y >= y_size_ )
+  {
+    throw std::domain_error( "Error: ScentField was given a Coordinate "\
+      "outside of the Labyrinth.\n" );
+  }
+  return (rm.y + 1) * stride_ + (rm.x + 1);
+}
+
+// This private method re-reads the walls of the given Room.
+void ScentField::ReadWalls( const Coordinate rm )
+{
+  const size_t i = Index( rm );
+  const auto mask = [this, rm]( const Direction d ) -> uint16_t
+  {
+    return l_->DirectionCheck(rm, d) == RoomBorder::kRoom ? 0xFFFF : 0;
+  };
+  open_north_[i] = mask( Direction::kNorth );
+  open_east_[i]  = mask( Direction::kEast );
+  open_south_[i] = mask( Direction::kSouth );
+  open_west_[i]  = mask( Direction::kWest );
+}
+
+// This private method updates the Labyrinth rows [y_begin, y_end) from
+// scent_ into next_.
+void ScentField::UpdateRows( const size_t y_begin, const size_t y_end )
+{
+  const uint32_t keep = 256 - decay_;
+  const size_t stride = stride_;
+  const uint16_t* const __restrict scent = scent_.data();
+  uint16_t* const __restrict next = next_.data();
+  const uint16_t* const __restrict open_n = open_north_.data();
+  const uint16_t* const __restrict open_e = open_east_.data();
+  const uint16_t* const __restrict open_s = open_south_.data();
+  const uint16_t* const __restrict open_w = open_west_.data();
+
+  for( size_t y = y_begin; y < y_end; ++y )
+  {
+    const size_t row = (y + 1) * stride + 1;
+    for( size_t i = row; i < row + x_size_; ++i )
+    {
+      // Branch-free, so that the loop is vectorized:
+      //   inflow is the scent of the connected Rooms,
+      //   outflow is this Room's scent once per connected Room.
+      const uint32_t c = scent[i];
+      const uint32_t inflow = (scent[i - stride] & open_n[i]) +
+                              (scent[i + 1]      & open_e[i]) +
+                              (scent[i + stride] & open_s[i]) +
+                              (scent[i - 1]      & open_w[i]);
+      const uint32_t outflow = (c & open_n[i]) + (c & open_e[i]) +
+                               (c & open_s[i]) + (c & open_w[i]);
+
+      // At most 4 connected Rooms each take an eighth, so this never
+      // goes below 0; it may go above the largest scent, so it is clamped
+      const uint32_t diffused = (c * 8 + inflow - outflow) >> 3;
+      next[i] = static_cast<uint16_t>(
+        std::min<uint32_t>( (diffused * keep) >> 8, 0xFFFF ) );
+    }
+  }
+}
+
+// This private method updates the band of rows of the given worker.
+void ScentField::UpdateBand( const size_t worker )
+{
+  const size_t y_begin = std::min( worker * rows_per_band_, y_size_ );
+  UpdateRows( y_begin, std::min(y_begin + rows_per_band_, y_size_) );
+}
+
+// This private method is run by each worker thread.
+void ScentField::RunWorker( const size_t worker )
+{
+  size_t round = 0;
+  std::unique_lock<std::mutex> lock( mutex_ );
+  while( true )
+  {
+    start_.wait( lock, [this, round]{ return stopping_ || round_ != round; } );
+    if( stopping_ )
+    {
+      return;
+    }
+    round = round_;
+
+    lock.unlock();
+    UpdateBand( worker );
+    lock.lock();
+
+    if( --remaining_ == 0 )
+    {
+      done_.notify_one();
+    }
+  }
+}
@@ -0,0 +1,482 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the SessionScheduler class,
+ * which runs many game sessions on one thread, waking each when its
+ * player's input arrives or its timer expires.
+ *
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include "../include/session_scheduler.hpp"
+
+namespace
+{
+
+// This local function returns true if timer a expires after timer b, to
+// order the timer heap by the earliest deadline.
+template <typename T>
+bool ExpiresAfter( const T& a, const T& b );
+
+// This local function returns true if timer a expires after timer b, to
+// order the timer heap by the earliest deadline.
+template <typename T>
+bool ExpiresAfter( const T& a, const T& b )
+{
+  return a.deadline > b.deadline;
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// Allocates frames for the given number of sessions.
+// An exception is thrown if:
+//   capacity is 0 (invalid_argument)
+//   The epoll instance cannot be created (runtime_error)
+SessionScheduler::SessionScheduler( const size_t capacity ) :
+  start_(std::chrono::steady_clock::now()),
+  frames_(capacity),
+  slots_(capacity),
+  free_(0),
+  epoll_fd_(-1)
+{
+  if( capacity == 0 )
+  {
+    throw std::invalid_argument( "Error: SessionScheduler() was given a "\
+      "capacity of 0.\n" );
+  }
+  else if( capacity >= kNoSlot )
+  {
+    throw std::invalid_argument( "Error: SessionScheduler() was given a "\
+      "capacity which is too large.\n" );
+  }
+
+  timers_.reserve( capacity );
+  for( size_t i = 0; i < capacity; ++i )
+  {
+    slots_[i].next_free = i + 1 < capacity ? static_cast<uint32_t>( i + 1 )
+                                           : kNoSlot;
+  }
+
+  epoll_fd_ = epoll_create1( EPOLL_CLOEXEC );
+  if( epoll_fd_ < 0 )
+  {
+    throw std::runtime_error( "Error: SessionScheduler() could not create "\
+      "an epoll instance.\n" );
+  }
+}
+
+// Destructor
+// Destroys the remaining sessions, without resuming them.
+SessionScheduler::~SessionScheduler()
+{
+  for( uint32_t slot = 0; slot < slots_.size(); ++slot )
+  {
+    if( slots_[slot].session != nullptr )
+    {
+      Finish( slot );
+    }
+  }
+  close( epoll_fd_ );
+}
+
+// This method waits up to max_wait for inputs and timers, resumes the
+// sessions they wake, and returns how many were resumed. If a session
+// throws, the sessions whose input arrived with its input are woken by
+// the next call instead.
+// An exception is thrown if:
+//   epoll_wait() fails (runtime_error)
+//   A session's Resume() throws (the same exception)
+//   A session's file descriptor cannot be watched again (runtime_error)
+size_t SessionScheduler::RunOnce( const std::chrono::milliseconds max_wait )
+{
+  int64_t timeout = max_wait.count();
+  if( !timers_.empty() )
+  {
+    // Rounded up, so the timer has expired when the wait ends
+    const int64_t until = timers_.front().deadline - Now();
+    timeout = std::min( timeout,
+                        until <= 0 ? 0 : (until + 999999) / 1000000 );
+  }
+
+  const int ready = epoll_wait( epoll_fd_, events_, kMaxEvents,
+                                static_cast<int>(timeout) );
+  if( ready < 0 && errno != EINTR )
+  {
+    throw std::runtime_error( "Error: RunOnce() could not wait for "\
+      "input.\n" );
+  }
+
+  const size_t resumes = resumes_;
+  for( int i = 0; i < ready; ++i )
+  {
+    if( Stale(events_[i]) )
+    {
+      continue;
+    }
+    const uint32_t slot = static_cast<uint32_t>( events_[i].data.u64 );
+    const Slot& s = slots_[slot];
+
+    try
+    {
+      // Only read once epoll has reported the input, so this does not
+      // block
+      const ssize_t size = read( s.fd, input_, sizeof(input_) );
+      if( size > 0 )
+      {
+        Step( slot, Wake::kInput, input_, static_cast<size_t>(size) );
+      }
+      else if( size < 0 && (errno == EINTR || errno == EAGAIN) )
+      {
+        // Nothing was read, so the session keeps waiting as it was
+        Arm( slot );
+      }
+      else
+      {
+        Step( slot, Wake::kClosed, nullptr, 0 );
+      }
+    }
+    catch( ... )
+    {
+      // EPOLLONESHOT disarmed the rest of the batch when it was reported
+      RearmEvents( i + 1, ready );
+      throw;
+    }
+  }
+
+  const int64_t now = Now();
+  while( !timers_.empty() && timers_.front().deadline <= now )
+  {
+    const uint32_t slot = timers_.front().slot;
+    CancelTimer( slot );
+    Step( slot, Wake::kTimer, nullptr, 0 );
+  }
+  return resumes_ - resumes;
+}
+
+// This method resumes sessions until every session has ended.
+// An exception is thrown if:
+//   epoll_wait() fails (runtime_error)
+//   A session's Resume() throws (the same exception)
+//   A session's file descriptor cannot be watched again (runtime_error)
+void SessionScheduler::Run()
+{
+  while( sessions_ > 0 )
+  {
+    RunOnce( std::chrono::seconds(1) );
+  }
+}
+
+// This method returns the number of running sessions.
+size_t SessionScheduler::Sessions() const
+{
+  return sessions_;
+}
+
+// This method returns the number of times a session was resumed.
+size_t SessionScheduler::Resumes() const
+{
+  return resumes_;
+}
+
+// This method returns the number of pending timers, which is at most
+// the number of running sessions.
+size_t SessionScheduler::Timers() const
+{
+  return timers_.size();
+}
+
+// This method returns the bytes used by the scheduler for each idle
+// session, including its frame.
+size_t SessionScheduler::BytesPerSession()
+{
+  // An idle session has at most one Timer, and timers_ is reserved for
+  // one per session
+  return sizeof(Frame) + sizeof(Slot) + sizeof(Timer);
+}
+
+// PRIVATE METHODS:
+
+// This private method returns a free Slot, or kNoSlot.
+uint32_t SessionScheduler::Allocate()
+{
+  const uint32_t slot = free_;
+  if( slot != kNoSlot )
+  {
+    free_ = slots_[slot].next_free;
+  }
+  return slot;
+}
+
+// This private method registers the constructed session of the Slot,
+// and starts it.
+// An exception is thrown if:
+//   fd cannot be watched (runtime_error)
+void SessionScheduler::Start( const uint32_t slot,
+                              GameSession* const session,
+                              const int fd )
+{
+  Slot& s = slots_[slot];
+  s.session = session;
+  s.fd = fd;
+  s.waiting = Await::Kind::kDone;
+  ++sessions_;
+
+  if( fd >= 0 )
+  {
+    // One-shot, so a session is only woken for input while it waits for it
+    epoll_event e;
+    e.events = EPOLLONESHOT;
+    e.data.u64 = slot;
+    if( epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &e) != 0 )
+    {
+      s.fd = -1;
+      Finish( slot );
+      throw std::runtime_error( "Error: Spawn() could not watch the file "\
+        "descriptor.\n" );
+    }
+  }
+  Step( slot, Wake::kStart, nullptr, 0 );
+}
+
+// This private method returns true if the event was armed before its
+// session was last resumed (or its Slot reused), or its session no
+// longer waits for input.
+bool SessionScheduler::Stale( const epoll_event& e ) const
+{
+  const Slot& s = slots_[static_cast<uint32_t>( e.data.u64 )];
+  return s.session == nullptr ||
+         static_cast<uint32_t>(e.data.u64 >> 32) != s.generation ||
+         (s.waiting != Await::Kind::kInput &&
+          s.waiting != Await::Kind::kInputOrTimer);
+}
+
+// This private method watches the file descriptors of events first to
+// ready - 1 of events_ again, for the sessions which still wait for
+// them, so that they are reported by the next wait.
+void SessionScheduler::RearmEvents( const int first, const int ready )
+{
+  for( int i = first; i < ready; ++i )
+  {
+    if( Stale(events_[i]) )
+    {
+      continue;
+    }
+    try
+    {
+      Arm( static_cast<uint32_t>(events_[i].data.u64) );
+    }
+    catch( const std::runtime_error& )
+    {
+      // The session has been ended; the exception already being passed
+      // on takes precedence
+    }
+  }
+}
+
+// This private method returns the Slot to the free list.
+void SessionScheduler::Release( const uint32_t slot )
+{
+  slots_[slot].next_free = free_;
+  free_ = slot;
+}
+
+// This private method resumes the session of the Slot, and waits for
+// what it returns.
+// An exception is thrown if:
+//   The file descriptor cannot be watched again (runtime_error)
+void SessionScheduler::Step( const uint32_t slot,
+                             const Wake why,
+                             const char* const input,
+                             const size_t size )
+{
+  Slot& s = slots_[slot];
+  ++s.generation;
+  ++resumes_;
+  Await next = Await::Done();
+  try
+  {
+    next = s.session->Resume( why, input, size );
+  }
+  catch( ... )
+  {
+    Finish( slot );
+    throw;
+  }
+  s.waiting = next.kind;
+
+  if( next.kind == Await::Kind::kDone )
+  {
+    Finish( slot );
+    return;
+  }
+
+  const bool input_wanted = next.kind != Await::Kind::kTimer;
+  if( input_wanted && s.fd < 0 )
+  {
+    // Without input, only the timer can wake the session
+    if( next.kind == Await::Kind::kInput )
+    {
+      Finish( slot );
+      return;
+    }
+  }
+  else if( input_wanted )
+  {
+    Arm( slot );
+  }
+
+  // The Timer of the previous wait, if any, is moved or removed in place
+  if( next.kind != Await::Kind::kInput )
+  {
+    SetTimer( slot, Now() + std::chrono::duration_cast<
+                std::chrono::nanoseconds>(next.timeout).count() );
+  }
+  else
+  {
+    CancelTimer( slot );
+  }
+}
+
+// This private method watches the file descriptor of the Slot for the
+// next input, which wakes the session once.
+// An exception is thrown if:
+//   The file descriptor cannot be watched (runtime_error), after the
+//     session is ended
+void SessionScheduler::Arm( const uint32_t slot )
+{
+  epoll_event e;
+  e.events = EPOLLIN | EPOLLONESHOT;
+  e.data.u64 = static_cast<uint64_t>( slots_[slot].generation ) << 32 | slot;
+  if( epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, slots_[slot].fd, &e) != 0 )
+  {
+    // Otherwise the session would never be woken for input
+    Finish( slot );
+    throw std::runtime_error( "Error: SessionScheduler could not watch "\
+      "the file descriptor of a session.\n" );
+  }
+}
+
+// This private method destroys the session of the Slot.
+void SessionScheduler::Finish( const uint32_t slot )
+{
+  Slot& s = slots_[slot];
+  if( s.fd >= 0 )
+  {
+    epoll_ctl( epoll_fd_, EPOLL_CTL_DEL, s.fd, nullptr );
+  }
+  s.session->~GameSession();
+  s.session = nullptr;
+  s.fd = -1;
+  s.waiting = Await::Kind::kDone;
+  ++s.generation;
+  CancelTimer( slot );
+  --sessions_;
+  Release( slot );
+}
+
+// This private method sets the deadline of the Timer of the Slot,
+// adding the Timer if the Slot has none.
+void SessionScheduler::SetTimer( const uint32_t slot, const int64_t deadline )
+{
+  const uint32_t i = slots_[slot].timer;
+  if( i == kNoSlot )
+  {
+    timers_.push_back( Timer{ deadline, slot } );
+    slots_[slot].timer = static_cast<uint32_t>( timers_.size() - 1 );
+    SiftUp( timers_.size() - 1 );
+  }
+  else if( deadline < timers_[i].deadline )
+  {
+    timers_[i].deadline = deadline;
+    SiftUp( i );
+  }
+  else
+  {
+    timers_[i].deadline = deadline;
+    SiftDown( i );
+  }
+}
+
+// This private method removes the Timer of the Slot, if it has one.
+void SessionScheduler::CancelTimer( const uint32_t slot )
+{
+  const uint32_t i = slots_[slot].timer;
+  if( i == kNoSlot )
+  {
+    return;
+  }
+  slots_[slot].timer = kNoSlot;
+
+  // The last Timer fills the gap, and moves whichever way it belongs
+  const Timer last = timers_.back();
+  timers_.pop_back();
+  if( i < timers_.size() )
+  {
+    PlaceTimer( i, last );
+    SiftUp( i );
+    SiftDown( slots_[last.slot].timer );
+  }
+}
+
+// This private method moves the Timer at index i of timers_ towards
+// the front until its parent expires no later than it does.
+void SessionScheduler::SiftUp( size_t i )
+{
+  const Timer t = timers_[i];
+  while( i > 0 && ExpiresAfter(timers_[(i - 1) / 2], t) )
+  {
+    PlaceTimer( i, timers_[(i - 1) / 2] );
+    i = (i - 1) / 2;
+  }
+  PlaceTimer( i, t );
+}
+
+// This private method moves the Timer at index i of timers_ towards
+// the back until neither of its children expires before it does.
+void SessionScheduler::SiftDown( size_t i )
+{
+  const Timer t = timers_[i];
+  while( 2 * i + 1 < timers_.size() )
+  {
+    size_t child = 2 * i + 1;
+    if( child + 1 < timers_.size() &&
+        ExpiresAfter(timers_[child], timers_[child + 1]) )
+    {
+      ++child;
+    }
+    if( !ExpiresAfter(t, timers_[child]) )
+    {
+      break;
+    }
+    PlaceTimer( i, timers_[child] );
+    i = child;
+  }
+  PlaceTimer( i, t );
+}
+
+// This private method stores the Timer at index i of timers_, and
+// records the index in its Slot.
+void SessionScheduler::PlaceTimer( const size_t i, const Timer& t )
+{
+  timers_[i] = t;
+  slots_[t.slot].timer = static_cast<uint32_t>( i );
+}
+
+// This private method returns the nanoseconds since start_.
+int64_t SessionScheduler::Now() const
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - start_).count();
+}
@@ -0,0 +1,363 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the SpawnFairness class,
+ * which measures whether the two spawns of a Labyrinth give both players
+ * an equal start, and finds the most balanced pair of spawns.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/spawn_fairness.hpp"
+
+// Definitions of the constants which are passed by reference
+const uint32_t SpawnReport::kUnreachable;
+const uint16_t SpawnFairness::kUnreached;
+const RoomId SpawnFairness::kNoRoom;
+
+namespace
+{
+
+// This local function returns the difference between two distances, 0 if
+// both are unreachable, or kUnreachable if only one is.
+uint32_t Difference( const uint32_t a, const uint32_t b );
+
+// This local function returns the sum of two imbalances, which stays
+// kUnreachable once either is.
+uint32_t AddImbalance( const uint32_t a, const uint32_t b );
+
+// This local function returns the difference between two distances, 0 if
+// both are unreachable, or kUnreachable if only one is.
+uint32_t Difference( const uint32_t a, const uint32_t b )
+{
+  if( a == SpawnReport::kUnreachable || b == SpawnReport::kUnreachable )
+  {
+    return a == b ? 0 : SpawnReport::kUnreachable;
+  }
+  return a > b ? a - b : b - a;
+}
+
+// This local function returns the sum of two imbalances, which stays
+// kUnreachable once either is.
+uint32_t AddImbalance( const uint32_t a, const uint32_t b )
+{
+  if( a == SpawnReport::kUnreachable || b == SpawnReport::kUnreachable )
+  {
+    return SpawnReport::kUnreachable;
+  }
+  return a + b;
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+SpawnFairness::SpawnFairness( const Labyrinth* const l ) :
+  l_(l),
+  x_size_(l == nullptr ? 0 : l->GetXSize()),
+  num_rooms_(l == nullptr ? 0 : l->GetXSize() * l->GetYSize())
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: SpawnFairness() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+
+  masks_.resize( num_rooms_ );
+  distance_[0].resize( num_rooms_ );
+  distance_[1].resize( num_rooms_ );
+  minotaur_distance_.resize( num_rooms_ );
+  queue_.reserve( 2 * num_rooms_ );
+  candidates_.reserve( num_rooms_ );
+}
+
+// This method measures the current spawns of the Labyrinth.
+SpawnReport SpawnFairness::Evaluate()
+{
+  return Evaluate( l_->GetSpawn1(), l_->GetSpawn2() );
+}
+
+// This method measures the given pair of spawns.
+// An exception is thrown if:
+//   One or both Rooms are outside the Labyrinth (domain_error)
+SpawnReport SpawnFairness::Evaluate( const Coordinate spawn_1,
+                                     const Coordinate spawn_2 )
+{
+  const size_t y_size = l_->GetYSize();
+  if( spawn_1.x >= x_size_ || spawn_1.y >= y_size ||
+      spawn_2.x >= x_size_ || spawn_2.y >= y_size )
+  {
+    throw std::domain_error( "Error: Evaluate() was given a Coordinate "\
+      "outside of the Labyrinth.\n" );
+  }
+
+  Scan();
+  const RoomId s_1 = static_cast<RoomId>( spawn_1.y * x_size_ + spawn_1.x );
+  const RoomId s_2 = static_cast<RoomId>( spawn_2.y * x_size_ + spawn_2.x );
+  PairedSearch( s_1, s_2 );
+
+  SpawnReport report;
+  for( size_t s = 0; s < 2; ++s )
+  {
+    const std::vector<uint16_t>& distance = distance_[s];
+    if( treasure_ != kNoRoom && distance[treasure_] != kUnreached )
+    {
+      report.treasure[s] = distance[treasure_];
+    }
+    if( exit_ != kNoRoom && distance[exit_] != kUnreached )
+    {
+      report.exit[s] = distance[exit_];
+    }
+    for( const RoomId m : minotaurs_ )
+    {
+      if( distance[m] != kUnreached && distance[m] < report.minotaur[s] )
+      {
+        report.minotaur[s] = distance[m];
+      }
+    }
+  }
+  if( distance_[0][s_2] != kUnreached )
+  {
+    report.between = distance_[0][s_2];
+  }
+
+  report.imbalance =
+    AddImbalance( AddImbalance(Difference(report.treasure[0],
+                                          report.treasure[1]),
+                               Difference(report.exit[0], report.exit[1])),
+                  Difference(report.minotaur[0], report.minotaur[1]) );
+  return report;
+}
+
+// This method finds the pair of Rooms, at least min_separation steps
+// apart in both x and y combined (so at least as far through the
+// Labyrinth), with the least imbalance, and returns false if no pair
+// can reach the Treasure and the exit. Ties go to the pair furthest
+// apart. Rooms holding a live Minotaur are not considered.
+bool SpawnFairness::FindBalancedSpawns( const size_t min_separation,
+                                        Coordinate& spawn_1,
+                                        Coordinate& spawn_2 )
+{
+  Scan();
+  PairedSearch( treasure_, exit_ );
+  MinotaurSearch();
+
+  // A candidate must reach every target which exists
+  candidates_.clear();
+  for( RoomId id = 0; id < num_rooms_; ++id )
+  {
+    if( (treasure_ == kNoRoom || distance_[0][id] != kUnreached) &&
+        (exit_ == kNoRoom || distance_[1][id] != kUnreached) &&
+        minotaur_distance_[id] != 0 )
+    {
+      candidates_.push_back( id );
+    }
+  }
+
+  // Sorted by distance to the Treasure, the pairs after a candidate only
+  // grow further apart in that distance, so the scan stops once that alone
+  // is worse than the best pair
+  std::sort( candidates_.begin(), candidates_.end(),
+             [this]( const RoomId a, const RoomId b )
+             {
+               return distance_[0][a] < distance_[0][b];
+             } );
+
+  bool found = false;
+  uint32_t best = SpawnReport::kUnreachable;
+  size_t best_separation = 0;
+  for( size_t i = 0; i < candidates_.size(); ++i )
+  {
+    const RoomId a = candidates_[i];
+    const size_t a_x = a % x_size_;
+    const size_t a_y = a / x_size_;
+    for( size_t j = i + 1; j < candidates_.size(); ++j )
+    {
+      const RoomId b = candidates_[j];
+      if( found &&
+          static_cast<uint32_t>(distance_[0][b] - distance_[0][a]) > best )
+      {
+        break;
+      }
+
+      const size_t b_x = b % x_size_;
+      const size_t b_y = b / x_size_;
+      const size_t separation = (a_x > b_x ? a_x - b_x : b_x - a_x) +
+                                (a_y > b_y ? a_y - b_y : b_y - a_y);
+      if( separation < min_separation )
+      {
+        continue;
+      }
+
+      const uint32_t imbalance = Imbalance( a, b );
+      if( imbalance == SpawnReport::kUnreachable )
+      {
+        continue;
+      }
+      if( !found || imbalance < best ||
+          (imbalance == best && separation > best_separation) )
+      {
+        found = true;
+        best = imbalance;
+        best_separation = separation;
+        spawn_1 = Coordinate( a_x, a_y );
+        spawn_2 = Coordinate( b_x, b_y );
+      }
+    }
+  }
+  return found;
+}
+
+// PRIVATE METHODS:
+
+// This private method reads the walls of every Room, and finds the
+// Treasure, the exit and the live Minotaurs.
+void SpawnFairness::Scan()
+{
+  treasure_ = kNoRoom;
+  exit_ = kNoRoom;
+  minotaurs_.clear();
+
+  const size_t y_size = l_->GetYSize();
+  RoomId id = 0;
+  for( size_t y = 0; y < y_size; ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x, ++id )
+    {
+      const Coordinate rm( x, y );
+      masks_[id] = l_->OpenMask( rm );
+      if( l_->ItemAt(rm) == Item::kTreasure )
+      {
+        treasure_ = id;
+      }
+      if( l_->GetInhabitant(rm) == Inhabitant::kMinotaur )
+      {
+        minotaurs_.push_back( id );
+      }
+
+      // Only a Room on the border can hold the exit
+      if( exit_ == kNoRoom && (x == 0 || y == 0 ||
+                               x + 1 == x_size_ || y + 1 == y_size) )
+      {
+        const Direction directions[] = { Direction::kNorth, Direction::kEast,
+                                         Direction::kSouth, Direction::kWest };
+        for( const Direction d : directions )
+        {
+          if( l_->DirectionCheck(rm, d) == RoomBorder::kExit )
+          {
+            exit_ = id;
+          }
+        }
+      }
+    }
+  }
+}
+
+// This private method fills distance_[0] from a and distance_[1] from b
+// with one search which alternates between them. A source of kNoRoom
+// leaves its field unreached.
+void SpawnFairness::PairedSearch( const RoomId a, const RoomId b )
+{
+  std::fill( distance_[0].begin(), distance_[0].end(), kUnreached );
+  std::fill( distance_[1].begin(), distance_[1].end(), kUnreached );
+
+  // Each entry is (RoomId << 1 | side); both sources start at distance 0,
+  // so the queue holds the two searches level by level, side by side
+  queue_.clear();
+  if( a != kNoRoom )
+  {
+    distance_[0][a] = 0;
+    queue_.push_back( a << 1 );
+  }
+  if( b != kNoRoom )
+  {
+    distance_[1][b] = 0;
+    queue_.push_back( b << 1 | 1 );
+  }
+
+  const RoomId x_size = static_cast<RoomId>( x_size_ );
+  for( size_t i = 0; i < queue_.size(); ++i )
+  {
+    const RoomId id = queue_[i] >> 1;
+    const uint32_t side = queue_[i] & 1;
+    std::vector<uint16_t>& distance = distance_[side];
+    const unsigned char mask = masks_[id];
+
+    // North, east, south and west, as in OpenMask()
+    const RoomId neighbours[4] = { id - x_size, id + 1, id + x_size, id - 1 };
+    for( unsigned char bit = 0; bit < 4; ++bit )
+    {
+      if( (mask >> bit & 1) && distance[neighbours[bit]] == kUnreached )
+      {
+        distance[neighbours[bit]] = static_cast<uint16_t>( distance[id] + 1 );
+        queue_.push_back( neighbours[bit] << 1 | side );
+      }
+    }
+  }
+}
+
+// This private method fills minotaur_distance_ from every live
+// Minotaur.
+void SpawnFairness::MinotaurSearch()
+{
+  std::fill( minotaur_distance_.begin(), minotaur_distance_.end(),
+             kUnreached );
+  queue_.clear();
+  for( const RoomId m : minotaurs_ )
+  {
+    minotaur_distance_[m] = 0;
+    queue_.push_back( m );
+  }
+
+  const RoomId x_size = static_cast<RoomId>( x_size_ );
+  for( size_t i = 0; i < queue_.size(); ++i )
+  {
+    const RoomId id = queue_[i];
+    const unsigned char mask = masks_[id];
+    const RoomId neighbours[4] = { id - x_size, id + 1, id + x_size, id - 1 };
+    for( unsigned char bit = 0; bit < 4; ++bit )
+    {
+      if( (mask >> bit & 1) &&
+          minotaur_distance_[neighbours[bit]] == kUnreached )
+      {
+        minotaur_distance_[neighbours[bit]] =
+          static_cast<uint16_t>( minotaur_distance_[id] + 1 );
+        queue_.push_back( neighbours[bit] );
+      }
+    }
+  }
+}
+
+// This private method returns the imbalance of two Rooms by the
+// distances of the Treasure, exit and Minotaur fields.
+uint32_t SpawnFairness::Imbalance( const RoomId a, const RoomId b ) const
+{
+  const std::vector<uint16_t>* const fields[] =
+  {
+    &distance_[0],
+    &distance_[1],
+    &minotaur_distance_,
+  };
+
+  uint32_t imbalance = 0;
+  for( const std::vector<uint16_t>* const field : fields )
+  {
+    const uint16_t d_a = (*field)[a];
+    const uint16_t d_b = (*field)[b];
+    imbalance = AddImbalance(
+      imbalance,
+      Difference(d_a == kUnreached ? SpawnReport::kUnreachable : d_a,
+                 d_b == kUnreached ? SpawnReport::kUnreachable : d_b) );
+  }
+  return imbalance;
+}
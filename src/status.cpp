@@ -0,0 +1,56 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the functions which raise the errors of Status
+ * and Expected, as exceptions or, without exceptions, by aborting.
+ *
+ * This is the only file of the core library which throws.
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#include "../include/status.hpp"
+
+// This function raises the error as the exception matching its ErrorCode,
+// or prints it and aborts if LABYRINTH_NO_EXCEPTIONS is defined.
+// A successful Status is raised as a logic_error.
+void RaiseError( const Status& s )
+{
+  if( s.IsOk() )
+  {
+    RaiseError( ErrorCode::kLogicError, "Error: RaiseError() was given a "\
+      "successful Status.\n" );
+  }
+  RaiseError( s.Code(), s.Message() );
+}
+
+// This function raises the error with the given message, for messages
+// which are built at run time.
+void RaiseError( const ErrorCode code, const std::string& message )
+{
+#ifdef LABYRINTH_NO_EXCEPTIONS
+  // Avoiding unused parameter warning
+  (void)(code);
+
+  std::fputs( message.c_str(), stderr );
+  std::abort();
+#else
+  switch( code )
+  {
+    case ErrorCode::kInvalidArgument:
+      throw std::invalid_argument( message );
+    case ErrorCode::kDomainError:
+      throw std::domain_error( message );
+    case ErrorCode::kRuntimeError:
+      throw std::runtime_error( message );
+    default:
+      throw std::logic_error( message );
+  }
+#endif
+}
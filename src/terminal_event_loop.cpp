@@ -0,0 +1,258 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the TerminalEventLoop class,
+ * which reads keys from a terminal without blocking the rendering of
+ * frames.
+ *
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../include/terminal_event_loop.hpp"
+
+// Parameterized constructor
+// Reads keys from input_fd, which is owned by the caller.
+// An exception is thrown if:
+//   input_fd is negative (invalid_argument)
+//   frame_budget is not positive (invalid_argument)
+//   The terminal cannot be put in raw mode (runtime_error)
+TerminalEventLoop::TerminalEventLoop(
+  const int input_fd,
+  const std::chrono::milliseconds frame_budget ) :
+  fd_(input_fd),
+  frame_budget_(frame_budget)
+{
+  if( input_fd < 0 )
+  {
+    throw std::invalid_argument( "Error: TerminalEventLoop() was given an "\
+      "invalid (negative) file descriptor.\n" );
+  }
+  else if( frame_budget.count() <= 0 )
+  {
+    throw std::invalid_argument( "Error: TerminalEventLoop() was given a "\
+      "frame budget which is not positive.\n" );
+  }
+
+  // Pipes and files are read as they are
+  if( !isatty(fd_) )
+  {
+    return;
+  }
+
+  if( tcgetattr(fd_, &original_) != 0 )
+  {
+    throw std::runtime_error( "Error: TerminalEventLoop() could not read "\
+      "the terminal mode.\n" );
+  }
+  termios raw = original_;
+  raw.c_lflag &= ~(ICANON | ECHO | ISIG);
+  raw.c_cc[VMIN] = 1;
+  raw.c_cc[VTIME] = 0;
+  if( tcsetattr(fd_, TCSANOW, &raw) != 0 )
+  {
+    throw std::runtime_error( "Error: TerminalEventLoop() could not put "\
+      "the terminal in raw mode.\n" );
+  }
+  raw_ = true;
+}
+
+// Destructor
+// Restores the terminal mode.
+TerminalEventLoop::~TerminalEventLoop()
+{
+  if( raw_ )
+  {
+    tcsetattr( fd_, TCSANOW, &original_ );
+  }
+}
+
+// This method draws a first frame, then handles keys and draws frames
+// until the handler returns false, Ctrl-C is pressed or the input
+// ends.
+// An exception is thrown if:
+//   The input cannot be read (runtime_error)
+void TerminalEventLoop::Run( TerminalHandler& handler )
+{
+  using Clock = std::chrono::steady_clock;
+
+  handler.DrawFrame();
+  ++frames_;
+  Clock::time_point last_frame = Clock::now();
+
+  bool open = true;
+  while( open )
+  {
+    // Sleeps until a key arrives
+    if( !Wait(-1) )
+    {
+      continue;
+    }
+    open = ReadKeys();
+
+    // Collects the keys which arrive until a frame may be drawn; once it
+    // may, only what is already waiting is read, so that a steady stream
+    // of keys cannot put the frame off
+    for( ;; )
+    {
+      const auto remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+          last_frame + frame_budget_ - Clock::now() ).count();
+      if( !open || !Wait(remaining > 0 ? static_cast<int>(remaining) : 0) )
+      {
+        break;
+      }
+      open = ReadKeys();
+      if( remaining <= 0 )
+      {
+        break;
+      }
+    }
+
+    // A lone escape byte is the escape key, not the start of a sequence
+    DecodeKeys( true );
+    if( keys_.empty() )
+    {
+      continue;
+    }
+
+    // Ctrl-C does not raise SIGINT in raw mode, so the loop stops for it
+    const bool interrupted = std::any_of( keys_.begin(), keys_.end(),
+      []( const KeyEvent& k ) { return k.key == Key::kInterrupt; } );
+    const bool keep_running = handler.HandleInput( keys_ );
+    keys_.clear();
+    if( !keep_running || interrupted )
+    {
+      return;
+    }
+    handler.DrawFrame();
+    ++frames_;
+    last_frame = Clock::now();
+  }
+}
+
+// This method returns the number of frames drawn.
+size_t TerminalEventLoop::Frames() const
+{
+  return frames_;
+}
+
+// This method returns the number of keys read.
+size_t TerminalEventLoop::Keys() const
+{
+  return num_keys_;
+}
+
+// PRIVATE METHODS:
+
+// This private method waits until input arrives or the timeout (in
+// milliseconds, or -1 for none) passes, and returns true if input
+// arrived.
+// An exception is thrown if:
+//   The input cannot be polled (runtime_error)
+bool TerminalEventLoop::Wait( const int timeout ) const
+{
+  pollfd p;
+  p.fd = fd_;
+  p.events = POLLIN;
+  p.revents = 0;
+  const int ready = poll( &p, 1, timeout );
+  if( ready < 0 )
+  {
+    if( errno == EINTR )
+    {
+      return false;
+    }
+    throw std::runtime_error( std::string("Error: TerminalEventLoop could "\
+      "not poll the input: ") + std::strerror(errno) + ".\n" );
+  }
+
+  // A closed input is reported as ready, so that ReadKeys() sees the end
+  return ready > 0 && (p.revents & (POLLIN | POLLHUP | POLLERR)) != 0;
+}
+
+// This private method reads the available input into keys_, and
+// returns false if the input has ended.
+// An exception is thrown if:
+//   The input cannot be read (runtime_error)
+bool TerminalEventLoop::ReadKeys()
+{
+  // Only called once poll() has reported input, so this does not block
+  char buffer[256];
+  const ssize_t size = read( fd_, buffer, sizeof(buffer) );
+  if( size < 0 )
+  {
+    if( errno == EINTR || errno == EAGAIN )
+    {
+      return true;
+    }
+    throw std::runtime_error( std::string("Error: TerminalEventLoop could "\
+      "not read the input: ") + std::strerror(errno) + ".\n" );
+  }
+
+  pending_.append( buffer, static_cast<size_t>(size) );
+  DecodeKeys( size == 0 );
+  return size > 0;
+}
+
+// This private method converts the bytes in pending_ into keys_,
+// leaving an incomplete escape sequence unless the input has ended.
+void TerminalEventLoop::DecodeKeys( const bool ended )
+{
+  const size_t decoded = keys_.size();
+  size_t i = 0;
+  while( i < pending_.size() )
+  {
+    const char c = pending_[i];
+    if( c == '\x1b' )
+    {
+      // Arrow keys are sent as ESC [ A to ESC [ D
+      if( i + 1 == pending_.size() ||
+          (pending_[i + 1] == '[' && i + 2 == pending_.size()) )
+      {
+        if( !ended )
+        {
+          break;
+        }
+      }
+      else if( pending_[i + 1] == '[' &&
+               pending_[i + 2] >= 'A' && pending_[i + 2] <= 'D' )
+      {
+        const Key kArrows[] = { Key::kUp, Key::kDown, Key::kRight,
+                                Key::kLeft };
+        keys_.push_back( KeyEvent{ kArrows[pending_[i + 2] - 'A'], c } );
+        i += 3;
+        continue;
+      }
+      keys_.push_back( KeyEvent{ Key::kEscape, c } );
+    }
+    else if( c == '\r' || c == '\n' )
+    {
+      keys_.push_back( KeyEvent{ Key::kEnter, c } );
+    }
+    else if( c == '\x03' )
+    {
+      keys_.push_back( KeyEvent{ Key::kInterrupt, c } );
+    }
+    else
+    {
+      keys_.push_back( KeyEvent{ Key::kCharacter, c } );
+    }
+    ++i;
+  }
+
+  num_keys_ += keys_.size() - decoded;
+  pending_.erase( 0, i );
+}
@@ -0,0 +1,231 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks LabyrinthSolver::CheapestPath() against a
+ * Dijkstra search built on a binary heap.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_solver.hpp"
+
+namespace
+{
+
+const size_t kSize = 20;
+const size_t kQueries = 20000;
+
+const Direction kDirections[] =
+{
+  Direction::kNorth,
+  Direction::kEast,
+  Direction::kSouth,
+  Direction::kWest,
+};
+
+// This local function connects the Rooms of l into a random maze with
+// some loops, and gives every Room a random weight from 1 to 9.
+void GenerateMaze( Labyrinth& l, std::mt19937& rng );
+
+// This local function returns the cost of a cheapest path from src to dst,
+// found with a binary heap.
+uint32_t BinaryHeapCost( const Labyrinth& l,
+                         const Coordinate src,
+                         const Coordinate dst );
+
+// This local function connects the Rooms of l into a random maze with
+// some loops, and gives every Room a random weight from 1 to 9.
+void GenerateMaze( Labyrinth& l, std::mt19937& rng )
+{
+  // Randomized depth-first search
+  std::vector<bool> visited( kSize * kSize, false );
+  std::vector<Coordinate> stack;
+  stack.push_back( Coordinate(0, 0) );
+  visited[0] = true;
+  while( !stack.empty() )
+  {
+    const Coordinate c = stack.back();
+    std::vector<Coordinate> options;
+    if( c.y > 0 && !visited[(c.y - 1) * kSize + c.x] )
+      options.push_back( Coordinate(c.x, c.y - 1) );
+    if( c.x + 1 < kSize && !visited[c.y * kSize + c.x + 1] )
+      options.push_back( Coordinate(c.x + 1, c.y) );
+    if( c.y + 1 < kSize && !visited[(c.y + 1) * kSize + c.x] )
+      options.push_back( Coordinate(c.x, c.y + 1) );
+    if( c.x > 0 && !visited[c.y * kSize + c.x - 1] )
+      options.push_back( Coordinate(c.x - 1, c.y) );
+
+    if( options.empty() )
+    {
+      stack.pop_back();
+      continue;
+    }
+    const Coordinate next = options[rng() % options.size()];
+    l.ConnectRooms( c, next );
+    visited[next.y * kSize + next.x] = true;
+    stack.push_back( next );
+  }
+
+  // Loops, so that cheapest and shortest paths differ
+  for( size_t i = 0; i < kSize * kSize / 10; ++i )
+  {
+    const Coordinate c( rng() % (kSize - 1), rng() % kSize );
+    if( l.DirectionCheck(c, Direction::kEast) == RoomBorder::kWall )
+    {
+      l.ConnectRooms( c, Coordinate(c.x + 1, c.y) );
+    }
+  }
+
+  for( size_t y = 0; y < kSize; ++y )
+  {
+    for( size_t x = 0; x < kSize; ++x )
+    {
+      l.SetRoomWeight( Coordinate(x, y),
+                       static_cast<unsigned char>(1 + rng() % 9) );
+    }
+  }
+}
+
+// This local function returns the cost of a cheapest path from src to dst,
+// found with a binary heap.
+uint32_t BinaryHeapCost( const Labyrinth& l,
+                         const Coordinate src,
+                         const Coordinate dst )
+{
+  typedef std::pair<uint32_t, uint32_t> CostRoom;
+  std::priority_queue< CostRoom,
+                       std::vector<CostRoom>,
+                       std::greater<CostRoom> > heap;
+  std::vector<uint32_t> cost( kSize * kSize, UINT32_MAX );
+
+  const uint32_t dst_index = static_cast<uint32_t>( dst.y * kSize + dst.x );
+  cost[src.y * kSize + src.x] = 0;
+  heap.push( CostRoom(0, static_cast<uint32_t>(src.y * kSize + src.x)) );
+  while( !heap.empty() )
+  {
+    const CostRoom top = heap.top();
+    heap.pop();
+    if( top.first > cost[top.second] )
+    {
+      continue;
+    }
+    if( top.second == dst_index )
+    {
+      return top.first;
+    }
+
+    const Coordinate c( top.second % kSize, top.second / kSize );
+    for( const Direction d : kDirections )
+    {
+      if( l.DirectionCheck(c, d) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      Coordinate n = c;
+      switch( d )
+      {
+        case Direction::kNorth: --n.y; break;
+        case Direction::kEast:  ++n.x; break;
+        case Direction::kSouth: ++n.y; break;
+        default:                --n.x; break;
+      }
+      const uint32_t n_index = static_cast<uint32_t>( n.y * kSize + n.x );
+      const uint32_t n_cost = top.first + l.GetRoomWeight(n);
+      if( n_cost < cost[n_index] )
+      {
+        cost[n_index] = n_cost;
+        heap.push( CostRoom(n_cost, n_index) );
+      }
+    }
+  }
+  return UINT32_MAX;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "BENCHMARKING LABYRINTHSOLVER::CHEAPESTPATH()" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::mt19937 rng( 76 );
+  Labyrinth l( kSize, kSize );
+  try
+  {
+    GenerateMaze( l, rng );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+
+  std::vector< std::pair<Coordinate, Coordinate> > queries;
+  for( size_t i = 0; i < kQueries; ++i )
+  {
+    queries.push_back( std::make_pair(
+      Coordinate(rng() % kSize, rng() % kSize),
+      Coordinate(rng() % kSize, rng() % kSize)) );
+  }
+
+  std::cout << "Running " << kQueries << " queries on a " << kSize << "x"
+            << kSize << " Labyrinth with weights from 1 to 9:" << std::endl;
+
+  LabyrinthSolver solver( &l );
+  DijkstraWorkspace ws;
+  std::vector<Coordinate> path;
+  std::vector<uint32_t> bucket_costs;
+  bucket_costs.reserve( kQueries );
+
+  auto start = std::chrono::steady_clock::now();
+  for( const auto& q : queries )
+  {
+    bucket_costs.push_back( solver.CheapestPath(q.first, q.second, ws, path) );
+  }
+  auto end = std::chrono::steady_clock::now();
+  const auto bucket_us =
+    std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+  size_t mismatches = 0;
+  start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < kQueries; ++i )
+  {
+    if( BinaryHeapCost(l, queries[i].first, queries[i].second) !=
+        bucket_costs[i] )
+    {
+      ++mismatches;
+    }
+  }
+  end = std::chrono::steady_clock::now();
+  const auto heap_us =
+    std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+  std::cout << "  Bucket queue: " << bucket_us << " microseconds" << std::endl
+            << "  Binary heap:  " << heap_us << " microseconds" << std::endl
+            << "  Queries with different costs (should be 0): " << mismatches
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "Benchmark completed." << std::endl;
+  std::cout << std::endl;
+
+  return 0;
+}
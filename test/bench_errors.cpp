@@ -0,0 +1,154 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks the cost of errors reported by the Labyrinth as
+ * exceptions against the same errors returned by its Try methods.
+ *
+ * It is built both with exceptions (make bench-errors) and with
+ * -fno-exceptions (make bench-errors-noexcept), where only the Try methods
+ * are timed.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/status.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/output_sink.hpp"
+#include "../include/labyrinth_map.hpp"
+
+#ifndef LABYRINTH_NO_EXCEPTIONS
+#include <exception>
+#endif
+
+namespace
+{
+
+const size_t kSize = 20;
+const size_t kCalls = 200000;
+
+// This local function returns the nanoseconds per call between start and
+// end.
+double NanosecondsPerCall( const std::chrono::steady_clock::time_point start,
+                           const std::chrono::steady_clock::time_point end );
+
+double NanosecondsPerCall( const std::chrono::steady_clock::time_point start,
+                           const std::chrono::steady_clock::time_point end )
+{
+  return static_cast<double>( std::chrono::duration_cast<
+    std::chrono::nanoseconds>(end - start).count() ) / kCalls;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "BENCHMARKING LABYRINTH ERROR PATHS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+#ifdef LABYRINTH_NO_EXCEPTIONS
+  std::cout << "Built without exceptions." << std::endl << std::endl;
+#else
+  std::cout << "Built with exceptions." << std::endl << std::endl;
+#endif
+
+  const Status sizes = Labyrinth::CheckSizes( 0, kSize );
+  std::cout << "Checking the sizes (0, " << kSize << ") before creating a "
+            << "Labyrinth:" << std::endl
+            << "  " << sizes.Message();
+
+  Labyrinth l( kSize, kSize );
+  for( size_t y = 0; y < kSize; ++y )
+  {
+    for( size_t x = 0; x + 1 < kSize; ++x )
+    {
+      l.TryConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+  }
+  const Coordinate outside( kSize, kSize );
+  const Coordinate inside( 3, 3 );
+
+  std::cout << "Timing " << kCalls << " calls of each kind:" << std::endl;
+  uint32_t errors = 0;
+  uint32_t inhabitants = 0;
+
+  // Success path, through the Try methods
+  auto start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < kCalls; ++i )
+  {
+    const Expected<Inhabitant> inh = l.TryGetInhabitant( inside );
+    inhabitants += inh.HasValue() &&
+                   inh.Value() == Inhabitant::kNone ? 1 : 0;
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "  TryGetInhabitant() succeeding:   "
+            << NanosecondsPerCall( start, end ) << " ns" << std::endl;
+
+  // Error path, through the Try methods
+  start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < kCalls; ++i )
+  {
+    errors += l.TryConnectRooms( inside, outside ).IsOk() ? 0 : 1;
+  }
+  end = std::chrono::steady_clock::now();
+  std::cout << "  TryConnectRooms() failing:       "
+            << NanosecondsPerCall( start, end ) << " ns" << std::endl;
+
+#ifndef LABYRINTH_NO_EXCEPTIONS
+  // Success path, through the methods which throw
+  start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < kCalls; ++i )
+  {
+    inhabitants += l.GetInhabitant( inside ) == Inhabitant::kNone ? 1 : 0;
+  }
+  end = std::chrono::steady_clock::now();
+  std::cout << "  GetInhabitant() succeeding:      "
+            << NanosecondsPerCall( start, end ) << " ns" << std::endl;
+
+  // Error path, through the methods which throw
+  start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < kCalls; ++i )
+  {
+    try
+    {
+      l.ConnectRooms( inside, outside );
+    }
+    catch( const std::exception& )
+    {
+      ++errors;
+    }
+  }
+  end = std::chrono::steady_clock::now();
+  std::cout << "  ConnectRooms() throwing:         "
+            << NanosecondsPerCall( start, end ) << " ns" << std::endl;
+#endif
+
+  std::cout << "  (" << errors << " errors and " << inhabitants
+            << " empty Rooms were counted.)" << std::endl << std::endl;
+
+  std::cout << "Rendering the Labyrinth into a NullSink:" << std::endl;
+  NullSink null;
+  LabyrinthMap map( &l, kSize, kSize );
+  map.Display( null );
+  std::cout << "  " << null.Bytes() << " bytes (should be more than 0)."
+            << std::endl;
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
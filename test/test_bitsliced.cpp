@@ -0,0 +1,242 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the BitslicedLabyrinths class implementation.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_solver.hpp"
+#include "../include/bitsliced_labyrinths.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING BITSLICED_LABYRINTHS.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Creating BitslicedLabyrinths of size 0x16 (An error should "
+            << "be thrown):" << std::endl;
+  try
+  {
+    BitslicedLabyrinths empty( 0, 16 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  // Each lane gets a random 16x16 Labyrinth, more open in higher lanes
+  std::cout << "Loading 64 random 16x16 Labyrinths:" << std::endl;
+  const size_t kSize = 16;
+  std::mt19937 random( 100 );
+  std::vector<std::unique_ptr<Labyrinth>> mazes;
+  BitslicedLabyrinths sliced( kSize, kSize );
+  for( size_t lane = 0; lane < BitslicedLabyrinths::kLanes; ++lane )
+  {
+    mazes.push_back( std::make_unique<Labyrinth>(kSize, kSize) );
+    Labyrinth& l = *mazes.back();
+    const size_t open_in_64 = 16 + lane / 2;
+    for( size_t y = 0; y < kSize; ++y )
+    {
+      for( size_t x = 0; x < kSize; ++x )
+      {
+        if( x + 1 < kSize && random() % 64 < open_in_64 )
+        {
+          l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+        }
+        if( y + 1 < kSize && random() % 64 < open_in_64 )
+        {
+          l.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+        }
+      }
+    }
+    sliced.Load( lane, l );
+  }
+  std::cout << "  Completed." << std::endl << std::endl;
+
+  const Coordinate src( 0, 0 );
+  const Coordinate dst( kSize - 1, kSize - 1 );
+  uint32_t reachable[BitslicedLabyrinths::kLanes];
+  uint32_t dead_ends[BitslicedLabyrinths::kLanes];
+  uint16_t distances[BitslicedLabyrinths::kLanes];
+  sliced.CountReachable( src, reachable );
+  sliced.CountDeadEnds( dead_ends );
+  sliced.Distances( src, dst, distances );
+
+  std::cout << "Comparing the reachable Rooms, dead ends and distances from "
+            << "(0, 0) to (15, 15) with each Labyrinth:" << std::endl;
+  size_t mismatches = 0;
+  size_t connected = 0;
+  uint16_t farthest = 0;
+  for( size_t lane = 0; lane < BitslicedLabyrinths::kLanes; ++lane )
+  {
+    const Labyrinth& l = *mazes[lane];
+    LabyrinthSolver solver( &l );
+    std::vector<bool> component;
+    const std::vector<Coordinate> path =
+      solver.ShortestPath( src, dst, component );
+
+    uint32_t component_size = 0;
+    uint32_t lane_dead_ends = 0;
+    for( size_t id = 0; id < kSize * kSize; ++id )
+    {
+      component_size += component[id] ? 1 : 0;
+      const unsigned char mask =
+        l.OpenMask( Coordinate(id % kSize, id / kSize) );
+      lane_dead_ends += (mask == 1 || mask == 2 || mask == 4 || mask == 8)
+                        ? 1 : 0;
+    }
+    const uint16_t distance = path.empty() ?
+      BitslicedLabyrinths::kUnreachable :
+      static_cast<uint16_t>( path.size() - 1 );
+
+    mismatches += reachable[lane] != component_size ? 1 : 0;
+    mismatches += dead_ends[lane] != lane_dead_ends ? 1 : 0;
+    mismatches += distances[lane] != distance ? 1 : 0;
+    connected += path.empty() ? 0 : 1;
+    if( !path.empty() )
+    {
+      farthest = std::max( farthest, distance );
+    }
+  }
+  std::cout << "  " << mismatches << " mismatches (should be 0); (15, 15) "
+            << "can be reached in " << connected << " of 64 Labyrinths, at "
+            << "most " << farthest << " steps away." << std::endl
+            << std::endl;
+
+  std::cout << "Searching in layers from (0, 0):" << std::endl;
+  std::vector<uint64_t> layers;
+  const size_t num_layers = sliced.Layers( src, layers );
+  std::vector<uint64_t> reached;
+  sliced.Reachable( src, reached );
+  std::vector<uint64_t> united( kSize * kSize, 0 );
+  size_t overlaps = 0;
+  for( size_t d = 0; d < num_layers; ++d )
+  {
+    for( size_t id = 0; id < kSize * kSize; ++id )
+    {
+      const uint64_t layer = layers[d * kSize * kSize + id];
+      overlaps += (united[id] & layer) != 0 ? 1 : 0;
+      united[id] |= layer;
+    }
+  }
+  std::cout << "  " << num_layers << " layers, the distance to (15, 15) is "
+            << "its layer in every Labyrinth: ";
+  bool layered = true;
+  for( size_t lane = 0; lane < BitslicedLabyrinths::kLanes; ++lane )
+  {
+    if( distances[lane] != BitslicedLabyrinths::kUnreachable )
+    {
+      layered &= (layers[distances[lane] * kSize * kSize + kSize * kSize - 1]
+                  >> lane & 1) != 0;
+    }
+  }
+  std::cout << (layered ? "yes" : "no") << " (should be yes), the layers "
+            << "cover the reachable Rooms exactly once: "
+            << (united == reached && overlaps == 0 ? "yes" : "no")
+            << " (should be yes)." << std::endl << std::endl;
+
+  std::cout << "Storing lane 40 into a Labyrinth and loading it into lane "
+            << "0 of another set:" << std::endl;
+  Labyrinth stored( kSize, kSize );
+  stored.ConnectRooms( Coordinate(3, 3), Coordinate(4, 3) );
+  sliced.Store( 40, stored );
+  BitslicedLabyrinths copy( kSize, kSize );
+  copy.Load( 0, stored );
+  size_t different = 0;
+  for( size_t id = 0; id < kSize * kSize; ++id )
+  {
+    const Coordinate rm( id % kSize, id / kSize );
+    different += stored.OpenMask(rm) != mazes[40]->OpenMask(rm) ? 1 : 0;
+  }
+  uint32_t copy_dead_ends[BitslicedLabyrinths::kLanes];
+  copy.CountDeadEnds( copy_dead_ends );
+  std::cout << "  " << different << " Rooms differ from the original "
+            << "(should be 0), " << copy_dead_ends[0] << " dead ends "
+            << "(should be " << dead_ends[40] << ")." << std::endl
+            << std::endl;
+
+  std::cout << "Loading a 15x16 Labyrinth (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    sliced.Load( 0, Labyrinth(15, 16) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Loading into lane 64 (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    sliced.Load( 64, stored );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Timing the distance from (0, 0) to (15, 15) and the dead "
+            << "ends, 1000 times:" << std::endl;
+  const auto sliced_start = std::chrono::steady_clock::now();
+  size_t total = 0;
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    sliced.Distances( src, dst, distances );
+    sliced.CountDeadEnds( dead_ends );
+    total += distances[i % 64] + dead_ends[i % 64];
+  }
+  const auto sliced_end = std::chrono::steady_clock::now();
+  const auto one_start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    const Labyrinth& l = *mazes[i % 64];
+    LabyrinthSolver solver( &l );
+    total += solver.ShortestPath( src, dst ).size();
+    for( size_t id = 0; id < kSize * kSize; ++id )
+    {
+      const unsigned char mask =
+        l.OpenMask( Coordinate(id % kSize, id / kSize) );
+      total += (mask == 1 || mask == 2 || mask == 4 || mask == 8) ? 1 : 0;
+    }
+  }
+  const auto one_end = std::chrono::steady_clock::now();
+  std::cout << "  Bit-sliced: "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 sliced_end - sliced_start).count() / (1000 * 64)
+            << " nanoseconds per Labyrinth." << std::endl
+            << "  One at a time: "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 one_end - one_start).count() / 1000
+            << " nanoseconds per Labyrinth (total " << total << ")."
+            << std::endl;
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
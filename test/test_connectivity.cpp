@@ -0,0 +1,166 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the LabyrinthConnectivity class implementation, and
+ * Labyrinth::DisconnectRooms().
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_solver.hpp"
+#include "../include/labyrinth_connectivity.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_CONNECTIVITY.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Creating a 2x2 Labyrinth which is a loop:" << std::endl;
+  Labyrinth l1( 2, 2 );
+  LabyrinthConnectivity c1( &l1 );
+  l1.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l1.ConnectRooms( Coordinate(1, 0), Coordinate(1, 1) );
+  l1.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+  l1.ConnectRooms( Coordinate(0, 1), Coordinate(0, 0) );
+  std::cout << "  (0, 0) and (1, 1) are "
+            << (c1.Connected(Coordinate(0, 0), Coordinate(1, 1)) ?
+                "connected" : "not connected")
+            << " (should be connected)." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Disconnecting (0, 0) and (1, 0), and then (1, 1) and (0, 1):"
+            << std::endl;
+  l1.DisconnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  std::cout << "  (0, 0) and (1, 0) are "
+            << (c1.Connected(Coordinate(0, 0), Coordinate(1, 0)) ?
+                "connected" : "not connected")
+            << " (should be connected, the long way around)." << std::endl;
+  l1.DisconnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+  std::cout << "  (0, 0) and (1, 0) are "
+            << (c1.Connected(Coordinate(0, 0), Coordinate(1, 0)) ?
+                "connected" : "not connected")
+            << " (should be not connected)." << std::endl;
+  std::cout << "  The component of (0, 0) has "
+            << c1.ComponentSize( Coordinate(0, 0) )
+            << " Rooms (should be 2)." << std::endl;
+  std::cout << "  To the east of (0, 0) is a "
+            << (l1.DirectionCheck(Coordinate(0, 0), Direction::kEast) ==
+                RoomBorder::kWall ? "wall" : "room")
+            << " (should be wall)." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Disconnecting Rooms which are not connected (error):"
+            << std::endl;
+  try
+  {
+    l1.DisconnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Disconnecting Rooms which are not adjacent (error):"
+            << std::endl;
+  try
+  {
+    l1.DisconnectRooms( Coordinate(0, 0), Coordinate(1, 1) );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Disconnecting a Room outside the Labyrinth (error):"
+            << std::endl;
+  try
+  {
+    l1.DisconnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Breaking and rebuilding 20000 random walls of a 20x20 "
+            << "Labyrinth, checking against a breadth-first search:"
+            << std::endl;
+  Labyrinth l2( 20, 20 );
+  LabyrinthConnectivity c2( &l2 );
+  LabyrinthSolver solver( &l2 );
+  std::mt19937 rng( 2026 );
+  std::uniform_int_distribution<size_t> pick( 0, 19 );
+  size_t mismatches = 0;
+  size_t checks = 0;
+  for( size_t i = 0; i < 20000; ++i )
+  {
+    const Coordinate a( pick(rng), pick(rng) );
+    const bool east = rng() & 1;
+    if( (east && a.x == 19) || (!east && a.y == 19) )
+    {
+      continue;
+    }
+    const Coordinate b( a.x + east, a.y + !east );
+
+    // About half of the walls are broken at any time, which is where a
+    // grid falls apart into components
+    const Direction d = east ? Direction::kEast : Direction::kSouth;
+    if( l2.DirectionCheck(a, d) == RoomBorder::kRoom )
+    {
+      l2.DisconnectRooms( a, b );
+    }
+    else
+    {
+      l2.ConnectRooms( a, b );
+    }
+
+    const Coordinate src( pick(rng), pick(rng) );
+    const Coordinate dst( pick(rng), pick(rng) );
+    const bool expected = src == dst ||
+                          !solver.ShortestPath( src, dst ).empty();
+    mismatches += c2.Connected( src, dst ) != expected;
+    ++checks;
+  }
+  std::cout << "  " << mismatches << " of " << checks
+            << " queries differ (should be 0)." << std::endl;
+
+  const auto start = std::chrono::steady_clock::now();
+  size_t connected = 0;
+  for( size_t i = 0; i < 100000; ++i )
+  {
+    connected += c2.Connected( Coordinate(pick(rng), pick(rng)),
+                               Coordinate(pick(rng), pick(rng)) );
+  }
+  const auto end = std::chrono::steady_clock::now();
+  std::cout << "  " << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         end - start).count() / 100000
+            << " nanoseconds per query (" << connected
+            << " of 100000 connected)." << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,301 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the TerminalEventLoop class with keys written to a
+ * pipe, driving a player around a Labyrinth drawn with a LabyrinthMap.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/output_sink.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/terminal_event_loop.hpp"
+
+namespace
+{
+  // This class moves a player through a Labyrinth with the arrow keys, and
+  // stops at 'q'.
+  class MapHandler : public TerminalHandler
+  {
+    public:
+
+      MapHandler( Labyrinth* const l ) :
+        l_(l),
+        map_(l, l->GetXSize(), l->GetYSize())
+      {
+      }
+
+      bool HandleInput( const std::vector<KeyEvent>& keys )
+      {
+        ++batches_;
+        for( const KeyEvent& k : keys )
+        {
+          Direction d = Direction::kNone;
+          switch( k.key )
+          {
+            case Key::kUp:    d = Direction::kNorth; break;
+            case Key::kDown:  d = Direction::kSouth; break;
+            case Key::kLeft:  d = Direction::kWest;  break;
+            case Key::kRight: d = Direction::kEast;  break;
+            case Key::kCharacter:
+              if( k.c == 'q' )
+              {
+                return false;
+              }
+              break;
+            default:
+              break;
+          }
+          if( d != Direction::kNone &&
+              l_->DirectionCheck(position_, d) == RoomBorder::kRoom )
+          {
+            position_ = Step( position_, d );
+          }
+        }
+        return true;
+      }
+
+      void DrawFrame()
+      {
+        sink_.Clear();
+        map_.Display( sink_ );
+      }
+
+      Coordinate Position() const
+      {
+        return position_;
+      }
+
+      size_t Batches() const
+      {
+        return batches_;
+      }
+
+    private:
+
+      Labyrinth* const l_;
+      LabyrinthMap map_;
+      BufferSink sink_;
+      Coordinate position_ = Coordinate(0, 0);
+      size_t batches_ = 0;
+
+      static Coordinate Step( const Coordinate c, const Direction d )
+      {
+        switch( d )
+        {
+          case Direction::kNorth: return Coordinate( c.x, c.y - 1 );
+          case Direction::kSouth: return Coordinate( c.x, c.y + 1 );
+          case Direction::kWest:  return Coordinate( c.x - 1, c.y );
+          default:                return Coordinate( c.x + 1, c.y );
+        }
+      }
+  };
+
+  // This local function returns the CPU time used by the process, in
+  // microseconds.
+  long CpuMicroseconds();
+
+  long CpuMicroseconds()
+  {
+    rusage usage;
+    getrusage( RUSAGE_SELF, &usage );
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000L +
+           usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+  }
+
+  // This local function writes the given bytes to fd, ignoring errors.
+  void WriteKeys( const int fd, const std::string& keys );
+
+  void WriteKeys( const int fd, const std::string& keys )
+  {
+    if( write(fd, keys.data(), keys.size()) < 0 )
+    {
+      std::cout << "  Could not write keys." << std::endl;
+    }
+  }
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING TERMINAL_EVENT_LOOP.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  Labyrinth l( 5, 5 );
+  for( size_t y = 0; y < 5; ++y )
+  {
+    for( size_t x = 0; x + 1 < 5; ++x )
+    {
+      l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+    if( y + 1 < 5 )
+    {
+      l.ConnectRooms( Coordinate(2, y), Coordinate(2, y + 1) );
+    }
+  }
+
+  std::cout << "Creating a loop with invalid arguments (errors):" << std::endl;
+  try
+  {
+    TerminalEventLoop bad_fd( -1, std::chrono::milliseconds(16) );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  try
+  {
+    TerminalEventLoop bad_budget( 0, std::chrono::milliseconds(0) );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  int fds[2];
+  if( pipe(fds) != 0 )
+  {
+    std::cout << "Could not create a pipe." << std::endl;
+    return 1;
+  }
+
+  std::cout << "Handling keys which were written at once:" << std::endl;
+  {
+    WriteKeys( fds[1], "\x1b[C\x1b[C\x1b[Bq" );
+    MapHandler handler( &l );
+    TerminalEventLoop loop( fds[0], std::chrono::milliseconds(16) );
+    loop.Run( handler );
+    std::cout << "  " << loop.Keys() << " keys (should be 4) in "
+              << handler.Batches() << " batch (should be 1), "
+              << loop.Frames() << " frame drawn (should be 1)." << std::endl
+              << "  The player is at (" << handler.Position().x << ", "
+              << handler.Position().y << ") (should be (2, 1))." << std::endl;
+  }
+  std::cout << std::endl;
+
+  std::cout << "Handling 40 keys written 3 milliseconds apart with a 50 "
+            << "millisecond frame budget:" << std::endl;
+  {
+    std::thread writer( [&fds]()
+    {
+      for( size_t i = 0; i < 40; ++i )
+      {
+        WriteKeys( fds[1], i % 2 == 0 ? "\x1b[C" : "\x1b[D" );
+        std::this_thread::sleep_for( std::chrono::milliseconds(3) );
+      }
+      WriteKeys( fds[1], "q" );
+    } );
+    MapHandler handler( &l );
+    TerminalEventLoop loop( fds[0], std::chrono::milliseconds(50) );
+    const auto start = std::chrono::steady_clock::now();
+    loop.Run( handler );
+    const auto end = std::chrono::steady_clock::now();
+    writer.join();
+    std::cout << "  " << loop.Keys() << " keys (should be 41) in "
+              << handler.Batches() << " batches, " << loop.Frames()
+              << " frames drawn (should be far fewer than keys) in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   end - start).count()
+              << " milliseconds." << std::endl;
+  }
+  std::cout << std::endl;
+
+  std::cout << "Handling a stream of keys which never pauses, for 200 "
+            << "milliseconds with a 16 millisecond frame budget:" << std::endl;
+  {
+    std::thread writer( [&fds]()
+    {
+      const auto start = std::chrono::steady_clock::now();
+      while( std::chrono::steady_clock::now() - start <
+             std::chrono::milliseconds(200) )
+      {
+        WriteKeys( fds[1], std::string(64, 'x') );
+      }
+      WriteKeys( fds[1], "q" );
+    } );
+    MapHandler handler( &l );
+    TerminalEventLoop loop( fds[0], std::chrono::milliseconds(16) );
+    loop.Run( handler );
+    writer.join();
+    std::cout << "  " << loop.Frames() << " frames drawn (should be at "
+              << "least 5)." << std::endl;
+  }
+  std::cout << std::endl;
+
+  std::cout << "Pressing Ctrl-C after a key:" << std::endl;
+  {
+    WriteKeys( fds[1], "\x1b[C\x03" );
+    MapHandler handler( &l );
+    TerminalEventLoop loop( fds[0], std::chrono::milliseconds(16) );
+    loop.Run( handler );
+    std::cout << "  " << loop.Keys() << " keys (should be 2), "
+              << loop.Frames() << " frame drawn (should be 1); the player "
+              << "is at (" << handler.Position().x << ", "
+              << handler.Position().y << ") (should be (1, 0))." << std::endl;
+  }
+  std::cout << std::endl;
+
+  std::cout << "Measuring the CPU time used while waiting 200 milliseconds "
+            << "for a key:" << std::endl;
+  {
+    MapHandler handler( &l );
+    TerminalEventLoop loop( fds[0], std::chrono::milliseconds(16) );
+    std::thread writer( [&fds]()
+    {
+      std::this_thread::sleep_for( std::chrono::milliseconds(200) );
+      WriteKeys( fds[1], "q" );
+    } );
+    const long cpu_start = CpuMicroseconds();
+    loop.Run( handler );
+    const long cpu_end = CpuMicroseconds();
+    writer.join();
+    std::cout << "  " << cpu_end - cpu_start << " microseconds "
+              << "(should be close to 0)." << std::endl;
+  }
+  std::cout << std::endl;
+
+  std::cout << "Ending the input part-way through an escape sequence:"
+            << std::endl;
+  {
+    WriteKeys( fds[1], "\x1b[Ca\x1b" );
+    close( fds[1] );
+    MapHandler handler( &l );
+    TerminalEventLoop loop( fds[0], std::chrono::milliseconds(16) );
+    loop.Run( handler );
+    std::cout << "  " << loop.Keys() << " keys (should be 3: right, 'a' and "
+              << "escape), " << loop.Frames() << " frames (should be 2)."
+              << std::endl;
+    close( fds[0] );
+  }
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
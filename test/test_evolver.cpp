@@ -0,0 +1,141 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the MazeEvolver class implementation.
+ *
+ */
+
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_solver.hpp"
+#include "../include/maze_evolver.hpp"
+
+namespace
+{
+
+// This local function returns the number of Rooms of the Labyrinth which
+// cannot be reached from the top left Room.
+size_t CountUnreachable( const Labyrinth& l );
+
+// This local function returns the number of Rooms of the Labyrinth which
+// cannot be reached from the top left Room.
+size_t CountUnreachable( const Labyrinth& l )
+{
+  LabyrinthSolver solver( &l );
+  size_t unreachable = 0;
+  for( size_t y = 0; y < l.GetYSize(); ++y )
+  {
+    for( size_t x = 0; x < l.GetXSize(); ++x )
+    {
+      if( solver.ShortestPath(Coordinate(0, 0), Coordinate(x, y)).empty() )
+      {
+        ++unreachable;
+      }
+    }
+  }
+  return unreachable;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING MAZE_EVOLVER.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Creating a MazeEvolver with a population of 1 (error):"
+            << std::endl;
+  try
+  {
+    MazeEvolver e( 5, 5, 1, 1, 0 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Creating a MazeEvolver with 0 threads (error):" << std::endl;
+  try
+  {
+    MazeEvolver e( 5, 5, 10, 0, 0 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Creating a 21x5 MazeEvolver (error):" << std::endl;
+  try
+  {
+    MazeEvolver e( 21, 5, 10, 1, 0 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Evolving a population of 64 12x12 mazes on 4 threads for "
+            << "200 generations:" << std::endl;
+  MazeEvolver e( 12, 12, 64, 4, 12345 );
+  const uint32_t first = e.BestFitness();
+  std::cout << "  Generation 0: best difficulty " << first << std::endl;
+  uint32_t last = first;
+  bool decreased = false;
+  for( size_t i = 0; i < 200; ++i )
+  {
+    e.Step();
+    decreased |= e.BestFitness() < last;
+    last = e.BestFitness();
+    if( e.Generation() % 50 == 0 )
+    {
+      std::cout << "  Generation " << e.Generation()
+                << ": best difficulty " << last << std::endl;
+    }
+  }
+  std::cout << "  The best difficulty " << (decreased ? "decreased" :
+    "never decreased") << " (should never decrease) and "
+            << (last > first ? "increased" : "did not increase")
+            << " (should increase)." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Building a Labyrinth from the best maze:" << std::endl;
+  try
+  {
+    std::unique_ptr<Labyrinth> l = e.BestLabyrinth();
+    std::cout << "  " << CountUnreachable( *l )
+              << " Rooms are unreachable (should be 0)." << std::endl;
+    LabyrinthSolver solver( l.get() );
+    std::cout << "  The path from corner to corner is "
+              << solver.ShortestPath( Coordinate(0, 0),
+                                      Coordinate(11, 11) ).size() - 1
+              << " moves long." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  Error: " << e.what();
+  }
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the LabyrinthCsrGraph and LabyrinthEdgeView class
+ * implementations.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_graph.hpp"
+
+namespace
+{
+
+// This local function prints the neighbours of every node of the graph.
+void PrintGraph( const LabyrinthGraph& g );
+
+// This local function returns the number of nodes whose neighbours differ
+// between the two graphs.
+uint32_t CountDifferences( const LabyrinthGraph& g_1,
+                           const LabyrinthGraph& g_2 );
+
+// This local function prints the neighbours of every node of the graph.
+void PrintGraph( const LabyrinthGraph& g )
+{
+  for( uint32_t u = 0; u < g.NumNodes(); ++u )
+  {
+    uint32_t out[4];
+    const uint32_t n = g.Neighbours( u, out );
+    std::cout << "  " << u << ":";
+    for( uint32_t i = 0; i < n; ++i )
+    {
+      std::cout << " " << out[i];
+    }
+    std::cout << std::endl;
+  }
+}
+
+// This local function returns the number of nodes whose neighbours differ
+// between the two graphs.
+uint32_t CountDifferences( const LabyrinthGraph& g_1,
+                           const LabyrinthGraph& g_2 )
+{
+  uint32_t differences = 0;
+  for( uint32_t u = 0; u < g_1.NumNodes(); ++u )
+  {
+    uint32_t out_1[4];
+    uint32_t out_2[4];
+    const uint32_t n_1 = g_1.Neighbours( u, out_1 );
+    const uint32_t n_2 = g_2.Neighbours( u, out_2 );
+    bool same = n_1 == n_2;
+    for( uint32_t i = 0; same && i < n_1; ++i )
+    {
+      same = out_1[i] == out_2[i];
+    }
+    differences += !same;
+  }
+  return differences;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_GRAPH.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Creating a 3x2 Labyrinth shaped like a U, with the exit "
+            << "north of (0, 0):" << std::endl;
+  Labyrinth l1( 3, 2 );
+  try
+  {
+    l1.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+    l1.ConnectRooms( Coordinate(0, 1), Coordinate(1, 1) );
+    l1.ConnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+    l1.ConnectRooms( Coordinate(2, 1), Coordinate(2, 0) );
+    l1.SetExit( Coordinate(0, 0), Direction::kNorth );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  Error: " << e.what();
+  }
+  std::cout << "  The open mask of (0, 1) is "
+            << static_cast<int>( l1.OpenMask(Coordinate(0, 1)) )
+            << " (should be 3, north and east)." << std::endl;
+  std::cout << "  The open mask of (0, 0) is "
+            << static_cast<int>( l1.OpenMask(Coordinate(0, 0)) )
+            << " (should be 4, south only; the exit is not a Room)."
+            << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Building the compressed sparse row graph:" << std::endl;
+  LabyrinthCsrGraph csr( &l1 );
+  PrintGraph( csr );
+  std::cout << "  " << csr.NumEdges() << " edges (should be 8). "
+            << "Node 1 has no neighbours (should have none)." << std::endl;
+  std::cout << "  Offsets:";
+  for( uint32_t u = 0; u <= csr.NumNodes(); ++u )
+  {
+    std::cout << " " << csr.Offsets()[u];
+  }
+  std::cout << " (should be 0 1 1 2 4 6 8)." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Building the edge view:" << std::endl;
+  LabyrinthEdgeView view( &l1 );
+  PrintGraph( view );
+  std::cout << "  " << CountDifferences( csr, view )
+            << " nodes differ from the compressed sparse row graph "
+            << "(should be 0)." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Connecting (0, 0) and (1, 0):" << std::endl;
+  l1.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  std::cout << "  " << CountDifferences( csr, view )
+            << " nodes differ before rebuilding (should be 2), ";
+  csr.Rebuild();
+  std::cout << CountDifferences( csr, view )
+            << " after (should be 0)." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Getting the neighbours of node 6 (error):" << std::endl;
+  uint32_t out[4];
+  try
+  {
+    csr.Neighbours( 6, out );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  try
+  {
+    view.Neighbours( 6, out );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Timing the building of a fully connected 20x20 graph:"
+            << std::endl;
+  Labyrinth l2( 20, 20 );
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x < 20; ++x )
+    {
+      if( x + 1 < 20 )
+      {
+        l2.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 20 )
+      {
+        l2.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  LabyrinthCsrGraph csr_2( &l2 );
+  const auto start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    csr_2.Rebuild();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  std::cout << "  " << csr_2.NumEdges() << " edges (should be 1520), "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 end - start).count() / 1000
+            << " nanoseconds per build." << std::endl;
+  std::cout << "  " << CountDifferences( csr_2, LabyrinthEdgeView(&l2) )
+            << " nodes differ from the edge view (should be 0)."
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,281 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the GridLabyrinth and GridSolver class templates with
+ * each topology.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_solver.hpp"
+#include "../include/topology.hpp"
+#include "../include/grid_labyrinth.hpp"
+
+namespace
+{
+
+// This local function prints the given path.
+void PrintPath( const std::vector<Coordinate>& path );
+
+// This local function returns the number of open sides in g, counting each
+// connection once.
+template <typename Topology>
+size_t CountConnections( const GridLabyrinth<Topology>& g );
+
+// This local function prints the given path.
+void PrintPath( const std::vector<Coordinate>& path )
+{
+  if( path.empty() )
+  {
+    std::cout << "  (no path)" << std::endl;
+    return;
+  }
+
+  std::cout << " ";
+  for( const Coordinate& c : path )
+  {
+    std::cout << " (" << c.x << ", " << c.y << ")";
+  }
+  std::cout << std::endl;
+}
+
+// This local function returns the number of open sides in g, counting each
+// connection once.
+template <typename Topology>
+size_t CountConnections( const GridLabyrinth<Topology>& g )
+{
+  size_t total = 0;
+  for( size_t y = 0; y < g.GetYSize(); ++y )
+  {
+    for( size_t x = 0; x < g.GetXSize(); ++x )
+    {
+      for( uint8_t mask = g.OpenMask( Coordinate(x, y) ); mask != 0;
+           mask &= mask - 1 )
+      {
+        ++total;
+      }
+    }
+  }
+  return total / 2;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING GRID_LABYRINTH.HPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "TESTING HEXAGONAL CELLS:" << std::endl << std::endl;
+
+  std::cout << "Creating a 3x3 hexagonal grid and connecting (0, 0) south-east "
+            << "to (0, 1), then (0, 1) south-east to (1, 2):" << std::endl;
+  GridLabyrinth<HexTopology> hex( 3, 3 );
+  GridSolver<HexTopology> hex_solver( &hex );
+  hex.ConnectCells( Coordinate(0, 0), 5 );
+  hex.ConnectCells( Coordinate(0, 1), 5 );
+  PrintPath( hex_solver.ShortestPath(Coordinate(0, 0), Coordinate(1, 2)) );
+  std::cout << "  (should be (0, 0) (0, 1) (1, 2))" << std::endl;
+  std::cout << "  (1, 2) is open to the north-west: "
+            << (hex.IsOpen(Coordinate(1, 2), 2) ? "yes" : "no")
+            << " (should be yes)." << std::endl;
+
+  std::cout << "Connecting (1, 2) south-east, which is off the grid (error):"
+            << std::endl;
+  try
+  {
+    hex.ConnectCells( Coordinate(1, 2), 5 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Connecting (0, 0) south-east again (error):" << std::endl;
+  try
+  {
+    hex.ConnectCells( Coordinate(0, 0), 5 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Checking side 6 of (0, 0) (error):" << std::endl;
+  try
+  {
+    hex.IsOpen( Coordinate(0, 0), 6 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Generating a 20x20 hexagonal maze:" << std::endl;
+  GridLabyrinth<HexTopology> hex_maze( 20, 20 );
+  hex_maze.Generate( 2026 );
+  GridSolver<HexTopology> hex_maze_solver( &hex_maze );
+  std::cout << "  " << CountConnections( hex_maze )
+            << " connections (should be 399)." << std::endl;
+  std::cout << "  The path between opposite corners has "
+            << hex_maze_solver.ShortestPath( Coordinate(0, 0),
+                                             Coordinate(19, 19) ).size()
+            << " cells (should be more than 0)." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "TESTING TRIANGULAR CELLS:" << std::endl << std::endl;
+
+  std::cout << "Creating a 3x2 triangular grid and connecting (0, 0) "
+            << "across its base to (0, 1), then east along row 1 to (2, 1), "
+            << "then (2, 1) across its base to (2, 0):" << std::endl;
+  GridLabyrinth<TriangleTopology> tri( 3, 2 );
+  GridSolver<TriangleTopology> tri_solver( &tri );
+  tri.ConnectCells( Coordinate(0, 0), 2 );
+  tri.ConnectCells( Coordinate(0, 1), 1 );
+  tri.ConnectCells( Coordinate(1, 1), 1 );
+  tri.ConnectCells( Coordinate(2, 1), 2 );
+  PrintPath( tri_solver.ShortestPath(Coordinate(0, 0), Coordinate(2, 0)) );
+  std::cout << "  (should be (0, 0) (0, 1) (1, 1) (2, 1) (2, 0))" << std::endl;
+  std::cout << "  (1, 0) points down, so its base is to the north, off the "
+            << "grid:" << std::endl;
+  Coordinate across;
+  std::cout << "  "
+            << (tri.Neighbour(Coordinate(1, 0), 2, across) ?
+                "in the grid" : "off the grid")
+            << " (should be off the grid)." << std::endl;
+  std::cout << "  (1, 0) and (0, 1) are "
+            << (tri_solver.ShortestPath(Coordinate(1, 0),
+                                        Coordinate(0, 1)).empty() ?
+                "not connected" : "connected")
+            << " (should be not connected)." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Generating a 20x20 triangular maze:" << std::endl;
+  GridLabyrinth<TriangleTopology> tri_maze( 20, 20 );
+  tri_maze.Generate( 2026 );
+  GridSolver<TriangleTopology> tri_maze_solver( &tri_maze );
+  std::cout << "  " << CountConnections( tri_maze )
+            << " connections (should be 399)." << std::endl;
+  std::cout << "  The path between opposite corners has "
+            << tri_maze_solver.ShortestPath( Coordinate(0, 0),
+                                             Coordinate(19, 19) ).size()
+            << " cells (should be more than 0)." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "TESTING SQUARE CELLS:" << std::endl << std::endl;
+
+  std::cout << "Creating a grid with a size of 21 (error):" << std::endl;
+  try
+  {
+    GridLabyrinth<SquareTopology> too_big( 21, 1 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Generating a 20x20 square maze and copying it into a "
+            << "Labyrinth:" << std::endl;
+  GridLabyrinth<SquareTopology> square( 20, 20 );
+  square.Generate( 2026 );
+  GridSolver<SquareTopology> square_solver( &square );
+  Labyrinth l( 20, 20 );
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x < 20; ++x )
+    {
+      // Only east and south, so each connection is made once
+      if( square.IsOpen(Coordinate(x, y), 1) )
+      {
+        l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( square.IsOpen(Coordinate(x, y), 2) )
+      {
+        l.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  LabyrinthSolver solver( &l );
+
+  size_t mismatches = 0;
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x < 20; ++x )
+    {
+      mismatches += square.OpenMask( Coordinate(x, y) ) !=
+                    l.OpenMask( Coordinate(x, y) );
+    }
+  }
+  std::cout << "  " << mismatches
+            << " Rooms have different open masks (should be 0)." << std::endl;
+  std::cout << "  Path lengths between opposite corners: "
+            << square_solver.ShortestPath( Coordinate(0, 0),
+                                           Coordinate(19, 19) ).size()
+            << " and "
+            << solver.ShortestPath( Coordinate(0, 0),
+                                    Coordinate(19, 19) ).size()
+            << " (should be equal)." << std::endl;
+
+  std::cout << "Timing 1000 searches between opposite corners:" << std::endl;
+  size_t total_length = 0;
+  auto start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    total_length += square_solver.ShortestPath( Coordinate(0, 0),
+                                                Coordinate(19, 19) ).size();
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "  GridSolver<SquareTopology>: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(
+                 end - start).count()
+            << " microseconds." << std::endl;
+  start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    total_length += solver.ShortestPath( Coordinate(0, 0),
+                                         Coordinate(19, 19) ).size();
+  }
+  end = std::chrono::steady_clock::now();
+  std::cout << "  LabyrinthSolver: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(
+                 end - start).count()
+            << " microseconds (total length " << total_length << ")."
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
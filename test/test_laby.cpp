@@ -10,10 +10,13 @@
 #include <exception>
 #include <iostream>
 #include <stdexcept>
+#include <vector>
 
 #include "../include/room_properties.hpp"
 #include "../include/coordinate.hpp"
+#include "../include/status.hpp"
 #include "../include/labyrinth.hpp"
+#include "../include/labyrinth_neighbourhood.hpp"
 
 int main()
 {
@@ -210,7 +213,139 @@ int main()
   }
   std::cout << "Done." << std::endl << std::endl;
 
+  std::cout << "Connecting non-adjacent rooms (0, 0) and (2, 1) with "
+            << "TryConnectRooms() (An error should be returned):"
+            << std::endl;
+  const Status not_adjacent = l1.TryConnectRooms(c_0_0, c_2_1);
+  std::cout << not_adjacent.Message()
+            << "Logic error: "
+            << (not_adjacent.Code() == ErrorCode::kLogicError ? "yes" : "no")
+            << " (should be yes)." << std::endl << std::endl;
+
+  std::cout << "Reading the Item of (0, 5) with TryItemAt() "
+            << "(An error should be returned):" << std::endl;
+  const Expected<Item> outside = l1.TryItemAt(Coordinate(0, 5));
+  std::cout << outside.Error().Message()
+            << "Has a value: " << (outside.HasValue() ? "yes" : "no")
+            << " (should be no)." << std::endl << std::endl;
+
+  std::cout << "Reading the Item of (0, 0) with TryItemAt():" << std::endl;
+  const Expected<Item> inside = l1.TryItemAt(c_0_0);
+  std::cout << "Has a value: " << (inside.HasValue() ? "yes" : "no")
+            << " (should be yes)." << std::endl << std::endl;
+
+  // Every row is a corridor, and the rows are joined by column 2
+  Labyrinth l2(5, 5);
+  for (size_t y = 0; y < 5; ++y)
+  {
+    for (size_t x = 0; x + 1 < 5; ++x)
+    {
+      l2.ConnectRooms(Coordinate(x, y), Coordinate(x + 1, y));
+    }
+    if (y + 1 < 5)
+    {
+      l2.ConnectRooms(Coordinate(2, y), Coordinate(2, y + 1));
+    }
+  }
+  VisitStamps stamps;
+  Neighbourhood near;
+
+  std::cout << "Finding the Rooms within 2 steps of (2, 2) in a 5x5 "
+            << "Labyrinth:" << std::endl;
+  l2.RoomsWithin(Coordinate(2, 2), 2, stamps, near);
+  std::cout << near.NumRings() << " rings (should be 3) of "
+            << near.RingSize(0) << ", " << near.RingSize(1) << " and "
+            << near.RingSize(2) << " Rooms (should be 1, 4 and 8)."
+            << std::endl << std::endl;
+
+  std::cout << "Finding the Rooms within 10 steps of (2, 2), which stops "
+            << "when every Room is found:" << std::endl;
+  l2.RoomsWithin(Coordinate(2, 2), 10, stamps, near);
+  std::cout << near.NumRings() << " rings (should be 5) of "
+            << near.rooms.size() << " Rooms (should be 25); the last ring "
+            << "has " << near.RingSize(4) << " Rooms (should be 4)."
+            << std::endl << std::endl;
+
+  std::cout << "Finding the Rooms within 0 steps of (0, 4):" << std::endl;
+  l2.RoomsWithin(Coordinate(0, 4), 0, stamps, near);
+  std::cout << near.NumRings() << " ring (should be 1) holding RoomId "
+            << near.rooms[0] << " (should be 20)." << std::endl << std::endl;
+
+  std::cout << "Finding the Rooms within 1 step of (0, 0) as the "
+            << "generation wraps around:" << std::endl;
+  stamps.generation = 0xFFFFFFFF;
+  l2.RoomsWithin(Coordinate(0, 0), 1, stamps, near);
+  std::cout << near.rooms.size() << " Rooms (should be 2), generation "
+            << stamps.generation << " (should be 1), "
+            << stamps.stamps.size() << " stamps (should be 25)."
+            << std::endl << std::endl;
+
+  std::cout << "Finding the Rooms around (5, 0) with TryRoomsWithin() "
+            << "(An error should be returned):" << std::endl;
+  std::cout << l2.TryRoomsWithin(Coordinate(5, 0), 1, stamps, near).Message()
+            << std::endl;
+
+  l2.SetInhabitant(Coordinate(2, 1), Inhabitant::kMinotaur);
+  l2.SetItem(Coordinate(3, 2), Item::kBullet);
+  std::cout << "Gathering the Rooms within 1 step of (2, 2):" << std::endl;
+  l2.RoomsWithin(Coordinate(2, 2), 1, stamps, near);
+  std::vector<Inhabitant> inhabitants(near.rooms.size());
+  std::vector<Item> items(near.rooms.size());
+  std::vector<unsigned char> masks(near.rooms.size());
+  l2.GatherRooms(near.rooms.data(), near.rooms.size(), inhabitants.data(),
+                 items.data(), masks.data());
+  size_t minotaurs = 0;
+  size_t bullets = 0;
+  for (size_t i = 0; i < near.rooms.size(); ++i)
+  {
+    minotaurs += inhabitants[i] == Inhabitant::kMinotaur ? 1 : 0;
+    bullets += items[i] == Item::kBullet ? 1 : 0;
+  }
+  std::cout << minotaurs << " Minotaur (should be 1), " << bullets
+            << " bullet (should be 1); (2, 2) is open to the mask "
+            << static_cast<int>(masks[0]) << " (should be 15)."
+            << std::endl << std::endl;
 
+  std::cout << "Gathering the masks of 100 Coordinates, which prefetches "
+            << "them:" << std::endl;
+  std::vector<Coordinate> path;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    path.push_back(Coordinate(i % 5, i / 5 % 5));
+  }
+  masks.resize(path.size());
+  l2.GatherRooms(path.data(), path.size(), nullptr, nullptr, masks.data());
+  size_t matching = 0;
+  for (size_t i = 0; i < path.size(); ++i)
+  {
+    matching += masks[i] == l2.OpenMask(path[i]) ? 1 : 0;
+  }
+  std::cout << matching << " masks match OpenMask() (should be 100)."
+            << std::endl << std::endl;
+
+  std::cout << "Gathering a list with one Coordinate outside of the "
+            << "Labyrinth (An error should be thrown, and nothing "
+            << "written):" << std::endl;
+  path[50] = Coordinate(5, 0);
+  masks.assign(path.size(), 0xFF);
+  try
+  {
+    l2.GatherRooms(path.data(), path.size(), nullptr, nullptr, masks.data());
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what();
+  }
+  std::cout << "The first mask is " << static_cast<int>(masks[0])
+            << " (should be 255)." << std::endl << std::endl;
+
+  std::cout << "Gathering a RoomId outside of the Labyrinth with "
+            << "TryGatherRooms() (An error should be returned):"
+            << std::endl;
+  const RoomId past_end = 25;
+  std::cout << l2.TryGatherRooms(&past_end, 1, inhabitants.data(), nullptr,
+                                 nullptr).Message()
+            << std::endl;
 
   std::cout << "________________________________________________" << std::endl;
   std::cout << std::endl;
@@ -7,13 +7,16 @@
  *
  */
 
+#include <chrono>
 #include <exception>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
 #include "../include/room_properties.hpp"
 #include "../include/coordinate.hpp"
 #include "../include/labyrinth.hpp"
+#include "../include/output_sink.hpp"
 #include "../include/labyrinth_map.hpp"
 
 int main()
@@ -138,6 +141,142 @@ int main()
   std::cout << "Completed." << std::endl;
   std::cout << std::endl;
 
+  std::cout << "Displaying the same Map with ASCII characters:" << std::endl
+            << std::endl;
+  LabyrinthMap l1_ascii_map( &l1, l1_xsize, l1_ysize, GlyphSet::kAscii );
+  try
+  {
+    l1_ascii_map.Display();
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Checking the cached rows of a 20x20 Map against a new Map "
+            << "after each change:" << std::endl;
+  Labyrinth l2( 20, 20 );
+  LabyrinthMap l2_map( &l2, 20, 20 );
+  std::cout << "  Before the first display, the Map has "
+            << (l2_map.Allocated() ? "been created" : "not been created")
+            << " (should be not been created)." << std::endl;
+  BufferSink cached;
+  BufferSink fresh;
+  size_t mismatches = 0;
+  for( size_t i = 0; i < 19; ++i )
+  {
+    l2.ConnectRooms( Coordinate(i, i), Coordinate(i + 1, i) );
+    l2.ConnectRooms( Coordinate(i + 1, i), Coordinate(i + 1, i + 1) );
+    if( i % 3 == 0 )
+    {
+      l2.SetItem( Coordinate(i, i), Item::kBullet );
+    }
+    else if( i % 3 == 1 )
+    {
+      l2.SetInhabitant( Coordinate(i, i), Inhabitant::kMinotaur );
+    }
+    else
+    {
+      l2.TakeItem( Coordinate(i - 2, i - 2) );
+    }
+
+    cached.Clear();
+    fresh.Clear();
+    l2_map.Display( cached );
+    LabyrinthMap new_map( &l2, 20, 20 );
+    new_map.Display( fresh );
+    mismatches += cached.Contents() != fresh.Contents();
+  }
+  std::cout << "  " << mismatches
+            << " of 19 displays differ (should be 0)." << std::endl;
+  std::cout << "  After displaying, the Map has "
+            << (l2_map.Allocated() ? "been created" : "not been created")
+            << " (should be been created)." << std::endl;
+
+  std::cout << "Checking a Map which views the Labyrinth without a copy "
+            << "against a new Map after each change:" << std::endl;
+  Labyrinth l3( 6, 5 );
+  LabyrinthMap l3_view( &l3, 6, 5, GlyphSet::kUnicode, MapStorage::kView );
+  mismatches = 0;
+  for( size_t i = 0; i < 20; ++i )
+  {
+    const Coordinate a( (i * 7) % 5, (i * 3) % 4 );
+    const Coordinate b( a.x + (i % 2), a.y + 1 - (i % 2) );
+    if( l3.DirectionCheck(a, i % 2 ? Direction::kEast : Direction::kSouth) ==
+        RoomBorder::kRoom )
+    {
+      l3.DisconnectRooms( a, b );
+    }
+    else
+    {
+      l3.ConnectRooms( a, b );
+    }
+    if( i == 5 )
+    {
+      l3.SetExit( Coordinate(5, 2), Direction::kEast );
+      l3.SetItem( Coordinate(1, 1), Item::kTreasure );
+      l3.SetInhabitant( Coordinate(4, 4), Inhabitant::kMirror );
+    }
+
+    cached.Clear();
+    fresh.Clear();
+    l3_view.Display( cached );
+    LabyrinthMap new_map( &l3, 6, 5 );
+    new_map.Display( fresh );
+    mismatches += cached.Contents() != fresh.Contents();
+  }
+  std::cout << "  " << mismatches
+            << " of 20 displays differ (should be 0)." << std::endl;
+  std::cout << "  After displaying, the viewing Map's copy has "
+            << (l3_view.Allocated() ? "been created" : "not been created")
+            << " (should be not been created)." << std::endl;
+  std::cout << "The last display:" << std::endl;
+  std::cout << cached.Contents().substr( 0, cached.Contents().find("\n\n\n") )
+            << std::endl << std::endl;
+
+  std::cout << "Timing 1000 displays of an unchanged Map, and of a Map with "
+            << "one Room changed each time:" << std::endl;
+  NullSink null;
+  auto start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    l2_map.Display( null );
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "  Unchanged: "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 end - start).count() / 1000
+            << " nanoseconds per display." << std::endl;
+  start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    l2_map.RoomChanged( Coordinate(i % 20, i % 20) );
+    l2_map.Display( null );
+  }
+  end = std::chrono::steady_clock::now();
+  std::cout << "  One Room changed: "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 end - start).count() / 1000
+            << " nanoseconds per display." << std::endl;
+
+  std::cout << "Timing the creation of 1000 20x20 Maps which are never "
+            << "displayed:" << std::endl;
+  start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    LabyrinthMap unused( &l2, 20, 20 );
+  }
+  end = std::chrono::steady_clock::now();
+  std::cout << "  " << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         end - start).count() / 1000
+            << " nanoseconds per Map." << std::endl;
+
 
 
   std::cout << "________________________________________________" << std::endl;
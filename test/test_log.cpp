@@ -0,0 +1,306 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the DiagnosticLog class by writing to a temporary
+ * file and reading it back.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../include/diagnostic_log.hpp"
+
+namespace
+{
+  const size_t kCalls = 1000000;
+
+  // This local function returns everything written to the file so far.
+  std::string ReadAll( std::FILE* const f );
+
+  std::string ReadAll( std::FILE* const f )
+  {
+    std::string contents;
+    char buffer[4096];
+    ssize_t size = 0;
+    off_t offset = 0;
+    while( (size = pread(fileno(f), buffer, sizeof(buffer), offset)) > 0 )
+    {
+      contents.append( buffer, static_cast<size_t>(size) );
+      offset += size;
+    }
+    return contents;
+  }
+
+  // This local function returns the number of lines in the string.
+  size_t Lines( const std::string& s );
+
+  size_t Lines( const std::string& s )
+  {
+    size_t lines = 0;
+    for( const char c : s )
+    {
+      lines += c == '\n' ? 1 : 0;
+    }
+    return lines;
+  }
+
+  // This local function returns the nanoseconds per call between start and
+  // end.
+  double NanosecondsPerCall( const std::chrono::steady_clock::time_point start,
+                             const std::chrono::steady_clock::time_point end );
+
+  double NanosecondsPerCall( const std::chrono::steady_clock::time_point start,
+                             const std::chrono::steady_clock::time_point end )
+  {
+    return static_cast<double>( std::chrono::duration_cast<
+      std::chrono::nanoseconds>(end - start).count() ) / kCalls;
+  }
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING DIAGNOSTIC_LOG.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Creating logs with invalid arguments (errors):" << std::endl;
+  try
+  {
+    DiagnosticLog bad_fd( -1 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  try
+  {
+    DiagnosticLog bad_burst( 1, Severity::kWarning, 0 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  try
+  {
+    DiagnosticLog big_burst( 1, Severity::kWarning,
+                             DiagnosticLog::kMaxBurst + 1 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Writing one message of each severity to a log of warnings:"
+            << std::endl;
+  {
+    std::FILE* const f = std::tmpfile();
+    {
+      DiagnosticLog log( fileno(f) );
+      log.Write( Severity::kDebug, "A debug message." );
+      log.Write( Severity::kInfo, "An info message." );
+      log.Write( Severity::kWarning, "A warning message." );
+      log.Write( Severity::kError, "Error: An error message.\n" );
+      log.Write( Severity::kOff, "A message which is never written." );
+      log.Flush();
+      std::cout << "  " << log.Written() << " messages written "
+                << "(should be 2):" << std::endl;
+    }
+    std::cout << ReadAll( f );
+    std::fclose( f );
+  }
+  std::cout << std::endl;
+
+  std::cout << "Writing the same message 1000 times with a burst of 5:"
+            << std::endl;
+  {
+    std::FILE* const f = std::tmpfile();
+    {
+      DiagnosticLog log( fileno(f), Severity::kInfo, 5,
+                         std::chrono::seconds(10) );
+      for( size_t i = 0; i < 1000; ++i )
+      {
+        log.Write( Severity::kInfo, "The same message." );
+      }
+      log.Write( Severity::kWarning, "The same message." );
+      log.Flush();
+      std::cout << "  " << log.Written() << " written (should be 6), "
+                << log.Suppressed() << " suppressed (should be 995)."
+                << std::endl;
+    }
+    const std::string contents = ReadAll( f );
+    std::cout << "  " << Lines( contents ) << " lines after the log was "
+              << "destroyed (should be 7); the last line is:" << std::endl
+              << contents.substr( contents.rfind('\n', contents.size() - 2) +
+                                  1 );
+    std::fclose( f );
+  }
+  std::cout << std::endl;
+
+  std::cout << "Repeating a message after its window of 50 milliseconds "
+            << "ended:" << std::endl;
+  {
+    std::FILE* const f = std::tmpfile();
+    {
+      DiagnosticLog log( fileno(f), Severity::kInfo, 2,
+                         std::chrono::milliseconds(50) );
+      for( size_t i = 0; i < 10; ++i )
+      {
+        log.Write( Severity::kInfo, "A repeated message." );
+      }
+      std::this_thread::sleep_for( std::chrono::milliseconds(200) );
+      log.Write( Severity::kInfo, "A repeated message." );
+      log.Flush();
+      std::cout << "  " << log.Written() << " written (should be 3), "
+                << log.Suppressed() << " suppressed (should be 8):"
+                << std::endl;
+    }
+    std::cout << ReadAll( f );
+    std::fclose( f );
+  }
+  std::cout << std::endl;
+
+  std::cout << "Writing from 4 threads at once:" << std::endl;
+  {
+    std::FILE* const f = std::tmpfile();
+    {
+      DiagnosticLog log( fileno(f), Severity::kInfo, 5,
+                         std::chrono::seconds(10) );
+      const char* const messages[] =
+      {
+        "A message from thread 0.",
+        "A message from thread 1.",
+        "A message from thread 2.",
+        "A message from thread 3.",
+      };
+      std::vector<std::thread> threads;
+      for( size_t t = 0; t < 4; ++t )
+      {
+        threads.emplace_back( [&log, &messages, t]()
+        {
+          for( size_t i = 0; i < 100000; ++i )
+          {
+            log.Write( Severity::kInfo, messages[t] );
+          }
+        } );
+      }
+      for( std::thread& t : threads )
+      {
+        t.join();
+      }
+      log.Flush();
+      std::cout << "  " << log.Written() << " written (should be 20), "
+                << log.Suppressed() << " suppressed (should be 399980) and "
+                << log.Dropped() << " dropped (should be 0)." << std::endl;
+    }
+    std::fclose( f );
+  }
+  std::cout << std::endl;
+
+  std::cout << "Writing one message after a flood of another:" << std::endl;
+  {
+    std::FILE* const f = std::tmpfile();
+    {
+      DiagnosticLog log( fileno(f), Severity::kInfo, 5,
+                         std::chrono::seconds(10) );
+      for( size_t i = 0; i < 100000; ++i )
+      {
+        log.Write( Severity::kInfo, "A flooding message." );
+      }
+      log.Write( Severity::kError, "Error: A message after the flood.\n" );
+      log.Flush();
+      std::cout << "  " << log.Written() << " written (should be 6), "
+                << log.Dropped() << " dropped (should be 0); the last "
+                << "line is:" << std::endl;
+      const std::string contents = ReadAll( f );
+      std::cout << contents.substr( contents.rfind('\n',
+                                                   contents.size() - 2) + 1 );
+    }
+    std::fclose( f );
+  }
+  std::cout << std::endl;
+
+  std::cout << "Writing messages made at run time, which are copied:"
+            << std::endl;
+  {
+    std::FILE* const f = std::tmpfile();
+    {
+      DiagnosticLog log( fileno(f), Severity::kInfo, 2,
+                         std::chrono::seconds(10) );
+      for( size_t i = 0; i < 3; ++i )
+      {
+        std::string message = "A message about file ";
+        message += std::to_string( i % 2 ) + ".txt.";
+        log.Write( Severity::kInfo, message );
+        log.Write( Severity::kInfo, message );
+      }
+      log.Write( Severity::kWarning, std::string(200, 'x') + "y" );
+      log.Flush();
+      std::cout << "  " << log.Written() << " written (should be 5), "
+                << log.Suppressed() << " suppressed (should be 2):"
+                << std::endl;
+    }
+    const std::string contents = ReadAll( f );
+    std::cout << contents;
+    const size_t start = contents.find( "WARNING: " ) + 9;
+    const size_t end = contents.find( '\n', start );
+    std::cout << "  The long message has " << end - start
+              << " characters (should be " << DiagnosticLog::kMaxCopied
+              << ") and ends with " << contents.substr( end - 4, 4 )
+              << " (should be x...)." << std::endl;
+    std::fclose( f );
+  }
+  std::cout << std::endl;
+
+  std::cout << "Timing " << kCalls << " calls of Log():" << std::endl;
+  {
+    DiagnosticLog::Global().SetLevel( Severity::kWarning );
+    auto start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kCalls; ++i )
+    {
+      Log( Severity::kDebug, "A message which is not written." );
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "  Disabled: " << NanosecondsPerCall( start, end )
+              << " ns" << std::endl;
+
+    std::FILE* const f = std::tmpfile();
+    {
+      DiagnosticLog log( fileno(f), Severity::kInfo );
+      start = std::chrono::steady_clock::now();
+      for( size_t i = 0; i < kCalls; ++i )
+      {
+        log.Write( Severity::kInfo, "A message which is rate limited." );
+      }
+      end = std::chrono::steady_clock::now();
+      std::cout << "  Enabled:  " << NanosecondsPerCall( start, end )
+                << " ns" << std::endl;
+    }
+    std::fclose( f );
+  }
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
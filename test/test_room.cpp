@@ -169,6 +169,17 @@ int main()
             << RoomBorderPrint( rm_1.DirectionCheck(Direction::kWest) )
             << "." << std::endl;
 
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+
+
+
+  std::cout << "Testing OpenMask():" << std::endl;
+
+  std::cout << "  The open mask of the room is "
+            << static_cast<int>( rm_1.OpenMask() )
+            << " (should be 10, east and west)." << std::endl;
+
 
 
   std::cout << "________________________________________________" << std::endl;
@@ -0,0 +1,167 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the LabyrinthSaver class implementation.
+ *
+ */
+
+#include <chrono>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_snapshot.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_save.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_SAVE.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Creating a 20x20 Labyrinth with a snake path, a Minotaur, "
+            << "a bullet, the Treasure and an exit." << std::endl;
+  Labyrinth l1( 20, 20 );
+  try
+  {
+    for( size_t y = 0; y < 20; ++y )
+    {
+      for( size_t x = 0; x + 1 < 20; ++x )
+      {
+        l1.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 20 )
+      {
+        const size_t x = (y % 2 == 0) ? 19 : 0;
+        l1.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+    l1.SetInhabitant( Coordinate(3, 4), Inhabitant::kMinotaur );
+    l1.SetItem( Coordinate(5, 6), Item::kBullet );
+    l1.SetItem( Coordinate(7, 8), Item::kTreasure );
+    l1.SetSpawn1( Coordinate(1, 2) );
+    l1.SetExit( Coordinate(19, 19), Direction::kSouth );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Saving the Labyrinth twice in the background:" << std::endl;
+  {
+    LabyrinthSaver saver;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::future<void> f1 = saver.SaveAsync( l1, "test_save_1.laby" );
+    const auto end = std::chrono::steady_clock::now();
+    std::future<void> f2 = saver.SaveAsync( l1, "test_save_2.laby" );
+
+    std::cout << "  SaveAsync() returned after "
+              << std::chrono::duration_cast<std::chrono::microseconds>(
+                   end - start).count()
+              << " microseconds." << std::endl;
+
+    try
+    {
+      f1.get();
+      f2.get();
+      std::cout << "  Both saves completed." << std::endl;
+    }
+    catch( const std::exception& e )
+    {
+      std::cout << e.what();
+    }
+
+    std::cout << "  Saving to a directory which does not exist "
+              << "(An error should be shown):" << std::endl;
+    try
+    {
+      saver.SaveAsync( l1, "no/such/directory.laby" ).get();
+    }
+    catch( const std::exception& e )
+    {
+      std::cout << "  " << e.what();
+    }
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Loading the saved Labyrinth into a new Labyrinth:"
+            << std::endl;
+  Labyrinth l2( 20, 20 );
+  try
+  {
+    LabyrinthSnapshot s;
+    LoadSnapshot( "test_save_1.laby", s );
+    l2.RestoreSnapshot( s );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+
+  const Direction directions[] = { Direction::kNorth, Direction::kEast,
+                                   Direction::kSouth, Direction::kWest };
+  size_t differences = 0;
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x < 20; ++x )
+    {
+      Coordinate c(x, y);
+      if( l1.GetInhabitant(c) != l2.GetInhabitant(c) ||
+          l1.ItemAt(c) != l2.ItemAt(c) )
+      {
+        ++differences;
+      }
+      for( const Direction d : directions )
+      {
+        if( l1.DirectionCheck(c, d) != l2.DirectionCheck(c, d) )
+        {
+          ++differences;
+        }
+      }
+    }
+  }
+  std::cout << "  Differences between the Labyrinths (should be 0): "
+            << differences << std::endl;
+
+  std::cout << "  Loading a file which does not exist "
+            << "(An error should be shown):" << std::endl;
+  try
+  {
+    LabyrinthSnapshot s;
+    LoadSnapshot( "no_such_file.laby", s );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
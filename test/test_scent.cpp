@@ -0,0 +1,172 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the ScentField class implementation.
+ *
+ */
+
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/scent_field.hpp"
+
+namespace
+{
+
+// This local function prints the integer part of the scent of every Room.
+void PrintField( const ScentField& f,
+                 const size_t x_size,
+                 const size_t y_size );
+
+// This local function prints the integer part of the scent of every Room.
+void PrintField( const ScentField& f,
+                 const size_t x_size,
+                 const size_t y_size )
+{
+  for( size_t y = 0; y < y_size; ++y )
+  {
+    std::cout << " ";
+    for( size_t x = 0; x < x_size; ++x )
+    {
+      std::cout << std::setw(4) << (f.ScentAt(Coordinate(x, y)) >> 8);
+    }
+    std::cout << std::endl;
+  }
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING SCENT_FIELD.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Creating a 4x2 Labyrinth where the top row is a corridor "
+            << "and the bottom row is walled off from it:" << std::endl;
+  Labyrinth l1( 4, 2 );
+  try
+  {
+    l1.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    l1.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+    l1.ConnectRooms( Coordinate(2, 0), Coordinate(3, 0) );
+    l1.ConnectRooms( Coordinate(0, 1), Coordinate(1, 1) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  ScentField f1( &l1, 2 );
+  std::cout << "Emitting a scent of 200 at (0, 0) and updating 5 times "
+            << "(the bottom row should stay 0):" << std::endl;
+  f1.Emit( Coordinate(0, 0), 200 << 8 );
+  for( size_t i = 0; i < 5; ++i )
+  {
+    f1.Update();
+  }
+  PrintField( f1, 4, 2 );
+  std::cout << std::endl;
+
+  std::cout << "Connecting (0, 0) and (0, 1), then updating 5 more times "
+            << "(the scent should reach the bottom row):" << std::endl;
+  l1.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  for( size_t i = 0; i < 5; ++i )
+  {
+    f1.Update();
+  }
+  PrintField( f1, 4, 2 );
+  std::cout << std::endl;
+
+  std::cout << "Creating a ScentField with 0 threads (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    ScentField f0( &l1, 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Timing 10000 updates of an open 20x20 Labyrinth:"
+            << std::endl;
+  Labyrinth l2( 20, 20 );
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x < 20; ++x )
+    {
+      if( x + 1 < 20 )
+      {
+        l2.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 20 )
+      {
+        l2.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  ScentField f2( &l2 );
+  const auto start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 10000; ++i )
+  {
+    f2.Emit( Coordinate(10, 10), 0xFFFF );
+    f2.Update();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  std::cout << "  "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 end - start).count() / 10000
+            << " nanoseconds per update." << std::endl;
+
+  std::cout << "Timing 10000 updates of the same Labyrinth with 4 threads:"
+            << std::endl;
+  ScentField f4( &l2, 4 );
+  const auto banded_start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 10000; ++i )
+  {
+    f4.Emit( Coordinate(10, 10), 0xFFFF );
+    f4.Update();
+  }
+  const auto banded_end = std::chrono::steady_clock::now();
+  size_t differences = 0;
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x < 20; ++x )
+    {
+      differences += f4.ScentAt( Coordinate(x, y) ) !=
+                     f2.ScentAt( Coordinate(x, y) ) ? 1 : 0;
+    }
+  }
+  std::cout << "  "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 banded_end - banded_start).count() / 10000
+            << " nanoseconds per update; " << differences << " Rooms "
+            << "differ from 1 thread (should be 0)." << std::endl;
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
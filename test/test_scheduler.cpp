@@ -0,0 +1,525 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the SessionScheduler class implementation.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/session_scheduler.hpp"
+
+namespace
+{
+  // This class is a session which takes a number of turns, one per
+  // millisecond, without input.
+  class TickSession : public GameSession
+  {
+    public:
+
+      TickSession( const size_t turns, size_t* const finished ) :
+        turns_(turns),
+        finished_(finished)
+      {
+      }
+
+      Await Resume( const Wake why,
+                    const char* const input,
+                    const size_t size ) override
+      {
+        (void)why;
+        (void)input;
+        (void)size;
+        if( turns_ == 0 )
+        {
+          ++*finished_;
+          return Await::Done();
+        }
+        --turns_;
+        return Await::Timer( std::chrono::milliseconds(1) );
+      }
+
+    private:
+
+      size_t turns_;
+      size_t* const finished_;
+  };
+
+  // This class is a session which moves a player through a Labyrinth by
+  // its keys: 'e' moves east if the Room is connected, and 'q' quits.
+  class WalkerSession : public GameSession
+  {
+    public:
+
+      WalkerSession( const Labyrinth* const l, size_t* const x,
+                     bool* const closed ) :
+        l_(l),
+        x_(x),
+        closed_(closed)
+      {
+      }
+
+      Await Resume( const Wake why,
+                    const char* const input,
+                    const size_t size ) override
+      {
+        if( why == Wake::kClosed )
+        {
+          *closed_ = true;
+          return Await::Done();
+        }
+        for( size_t i = 0; i < size; ++i )
+        {
+          if( input[i] == 'q' )
+          {
+            return Await::Done();
+          }
+          else if( input[i] == 'e' &&
+                   l_->DirectionCheck(Coordinate(*x_, 0), Direction::kEast) ==
+                     RoomBorder::kRoom )
+          {
+            ++*x_;
+          }
+        }
+        return Await::Input();
+      }
+
+    private:
+
+      const Labyrinth* const l_;
+      size_t* const x_;
+      bool* const closed_;
+  };
+
+  // This class is a session which waits for input for a while, and
+  // records whether it timed out.
+  class IdleSession : public GameSession
+  {
+    public:
+
+      explicit IdleSession( Wake* const last ) :
+        last_(last)
+      {
+      }
+
+      Await Resume( const Wake why,
+                    const char* const input,
+                    const size_t size ) override
+      {
+        (void)input;
+        (void)size;
+        *last_ = why;
+        if( why == Wake::kStart )
+        {
+          return Await::InputOrTimer( std::chrono::milliseconds(20) );
+        }
+        return Await::Done();
+      }
+
+    private:
+
+      Wake* const last_;
+  };
+
+  // This class is a session which waits up to 30 seconds for each input,
+  // and ends after the given number of inputs.
+  class ChattySession : public GameSession
+  {
+    public:
+
+      ChattySession( const size_t inputs, size_t* const received ) :
+        inputs_(inputs),
+        received_(received)
+      {
+      }
+
+      Await Resume( const Wake why,
+                    const char* const input,
+                    const size_t size ) override
+      {
+        (void)input;
+        if( why == Wake::kInput )
+        {
+          *received_ += size;
+        }
+        if( why == Wake::kClosed || why == Wake::kTimer ||
+            *received_ >= inputs_ )
+        {
+          return Await::Done();
+        }
+        return Await::InputOrTimer( std::chrono::seconds(30) );
+      }
+
+    private:
+
+      const size_t inputs_;
+      size_t* const received_;
+  };
+
+  // This class is a session which waits for input; the first of its kind
+  // to receive input throws, and the others count their inputs.
+  class ThrowingSession : public GameSession
+  {
+    public:
+
+      ThrowingSession( bool* const thrown, size_t* const received ) :
+        thrown_(thrown),
+        received_(received)
+      {
+      }
+
+      Await Resume( const Wake why,
+                    const char* const input,
+                    const size_t size ) override
+      {
+        (void)input;
+        if( why == Wake::kInput && !*thrown_ )
+        {
+          *thrown_ = true;
+          throw std::runtime_error( "Error: A session failed.\n" );
+        }
+        else if( why == Wake::kInput )
+        {
+          *received_ += size;
+        }
+        return why == Wake::kStart ? Await::Input() : Await::Done();
+      }
+
+    private:
+
+      bool* const thrown_;
+      size_t* const received_;
+  };
+
+  // This class is a session which closes its own input when it starts,
+  // and then waits for input.
+  class ClosingSession : public GameSession
+  {
+    public:
+
+      explicit ClosingSession( const int fd ) :
+        fd_(fd)
+      {
+      }
+
+      Await Resume( const Wake why,
+                    const char* const input,
+                    const size_t size ) override
+      {
+        (void)why;
+        (void)input;
+        (void)size;
+        close( fd_ );
+        return Await::Input();
+      }
+
+    private:
+
+      const int fd_;
+  };
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING SESSION_SCHEDULER.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Creating a SessionScheduler with no capacity (An error "
+            << "should be thrown):" << std::endl;
+  try
+  {
+    SessionScheduler empty( 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Bytes used by the scheduler for each idle session: "
+            << SessionScheduler::BytesPerSession()
+            << " (should be a few hundred)." << std::endl << std::endl;
+
+  std::cout << "Running 2000 sessions of 5 turns each, without input:"
+            << std::endl;
+  {
+    SessionScheduler scheduler( 2000 );
+    size_t finished = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < 2000; ++i )
+    {
+      scheduler.Spawn<TickSession>( -1, 5, &finished );
+    }
+    std::cout << "  Running: " << scheduler.Sessions() << " (should be 2000)"
+              << std::endl;
+    scheduler.Run();
+    const auto end = std::chrono::steady_clock::now();
+    std::cout << "  Finished: " << finished << " (should be 2000), running: "
+              << scheduler.Sessions() << " (should be 0), resumes: "
+              << scheduler.Resumes() << " (should be 12000), in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   end - start).count()
+              << " milliseconds." << std::endl << std::endl;
+  }
+
+  std::cout << "Running 200 players through a corridor of 10 Rooms, each "
+            << "typing 'e' 12 times and then 'q':" << std::endl;
+  {
+    Labyrinth l( 10, 1 );
+    for( size_t x = 0; x + 1 < 10; ++x )
+    {
+      l.ConnectRooms( Coordinate(x, 0), Coordinate(x + 1, 0) );
+    }
+
+    SessionScheduler scheduler( 200 );
+    std::vector<int> pipes( 400 );
+    std::vector<size_t> positions( 200, 0 );
+    bool closed = false;
+    for( size_t i = 0; i < 200; ++i )
+    {
+      if( pipe(&pipes[2 * i]) != 0 )
+      {
+        std::cout << "  Could not create a pipe." << std::endl;
+        return 1;
+      }
+      scheduler.Spawn<WalkerSession>( pipes[2 * i], &l, &positions[i],
+                                      &closed );
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for( size_t key = 0; key < 13; ++key )
+    {
+      const char c = key < 12 ? 'e' : 'q';
+      for( size_t i = 0; i < 200; ++i )
+      {
+        if( write(pipes[2 * i + 1], &c, 1) != 1 )
+        {
+          std::cout << "  Could not write a key." << std::endl;
+        }
+      }
+      scheduler.RunOnce( std::chrono::milliseconds(0) );
+    }
+    scheduler.Run();
+    const auto end = std::chrono::steady_clock::now();
+
+    size_t at_end = 0;
+    for( const size_t x : positions )
+    {
+      at_end += x == 9 ? 1 : 0;
+    }
+    std::cout << "  Players at the end of the corridor: " << at_end
+              << " (should be 200), running: " << scheduler.Sessions()
+              << " (should be 0), closed: " << (closed ? "yes" : "no")
+              << " (should be no), in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(
+                   end - start).count()
+              << " microseconds." << std::endl << std::endl;
+
+    for( const int fd : pipes )
+    {
+      close( fd );
+    }
+  }
+
+  std::cout << "Closing the input of a player:" << std::endl;
+  {
+    Labyrinth l( 2, 1 );
+    SessionScheduler scheduler( 1 );
+    int fds[2];
+    if( pipe(fds) != 0 )
+    {
+      std::cout << "  Could not create a pipe." << std::endl;
+      return 1;
+    }
+    size_t x = 0;
+    bool closed = false;
+    scheduler.Spawn<WalkerSession>( fds[0], &l, &x, &closed );
+    close( fds[1] );
+    scheduler.Run();
+    std::cout << "  Closed: " << (closed ? "yes" : "no") << " (should be "
+              << "yes), running: " << scheduler.Sessions() << " (should be "
+              << "0)" << std::endl << std::endl;
+    close( fds[0] );
+  }
+
+  std::cout << "Sending 300 keys, one at a time, to each of 10 sessions "
+            << "waiting up to 30 seconds for each:" << std::endl;
+  {
+    SessionScheduler scheduler( 10 );
+    int pipes[20];
+    size_t received[10] = {};
+    for( size_t i = 0; i < 10; ++i )
+    {
+      if( pipe(&pipes[2 * i]) != 0 )
+      {
+        std::cout << "  Could not create a pipe." << std::endl;
+        return 1;
+      }
+      scheduler.Spawn<ChattySession>( pipes[2 * i], 300, &received[i] );
+    }
+    size_t most_timers = scheduler.Timers();
+    for( size_t key = 0; key < 300; ++key )
+    {
+      for( size_t i = 0; i < 10; ++i )
+      {
+        if( write(pipes[2 * i + 1], "n", 1) != 1 )
+        {
+          std::cout << "  Could not write a key." << std::endl;
+          return 1;
+        }
+      }
+      size_t resumed = 0;
+      while( resumed < 10 )
+      {
+        resumed += scheduler.RunOnce( std::chrono::milliseconds(100) );
+      }
+      most_timers = std::max( most_timers, scheduler.Timers() );
+    }
+    size_t total = 0;
+    for( size_t i = 0; i < 10; ++i )
+    {
+      total += received[i];
+    }
+    std::cout << "  Keys received: " << total << " (should be 3000), most "
+              << "pending timers: " << most_timers << " (should be 10), "
+              << "pending timers now: " << scheduler.Timers()
+              << " (should be 0)" << std::endl << std::endl;
+    for( const int fd : pipes )
+    {
+      close( fd );
+    }
+  }
+
+  std::cout << "Sending input to 2 sessions at once, where the first "
+            << "resumed throws (An error should be thrown):" << std::endl;
+  {
+    SessionScheduler scheduler( 2 );
+    int pipes[4];
+    bool thrown = false;
+    size_t received = 0;
+    for( size_t i = 0; i < 2; ++i )
+    {
+      if( pipe(&pipes[2 * i]) != 0 )
+      {
+        std::cout << "  Could not create a pipe." << std::endl;
+        return 1;
+      }
+      scheduler.Spawn<ThrowingSession>( pipes[2 * i], &thrown, &received );
+    }
+    for( size_t i = 0; i < 2; ++i )
+    {
+      if( write(pipes[2 * i + 1], "n", 1) != 1 )
+      {
+        std::cout << "  Could not write a key." << std::endl;
+        return 1;
+      }
+    }
+    try
+    {
+      scheduler.RunOnce( std::chrono::milliseconds(100) );
+    }
+    catch( const std::exception& e )
+    {
+      std::cout << "  " << e.what();
+    }
+    scheduler.RunOnce( std::chrono::milliseconds(100) );
+    std::cout << "  Keys received by the other session: " << received
+              << " (should be 1), running: " << scheduler.Sessions()
+              << " (should be 0)" << std::endl << std::endl;
+    for( const int fd : pipes )
+    {
+      close( fd );
+    }
+  }
+
+  std::cout << "Spawning a session which closes its input before waiting "
+            << "for it (An error should be thrown):" << std::endl;
+  {
+    SessionScheduler scheduler( 1 );
+    int fds[2];
+    if( pipe(fds) != 0 )
+    {
+      std::cout << "  Could not create a pipe." << std::endl;
+      return 1;
+    }
+    try
+    {
+      scheduler.Spawn<ClosingSession>( fds[0], fds[0] );
+    }
+    catch( const std::exception& e )
+    {
+      std::cout << "  " << e.what();
+    }
+    std::cout << "  Running: " << scheduler.Sessions() << " (should be 0)"
+              << std::endl << std::endl;
+    close( fds[1] );
+  }
+
+  std::cout << "Waiting 20 milliseconds for input which never arrives:"
+            << std::endl;
+  {
+    SessionScheduler scheduler( 1 );
+    int fds[2];
+    if( pipe(fds) != 0 )
+    {
+      std::cout << "  Could not create a pipe." << std::endl;
+      return 1;
+    }
+    Wake last = Wake::kStart;
+    const auto start = std::chrono::steady_clock::now();
+    scheduler.Spawn<IdleSession>( fds[0], &last );
+    scheduler.Run();
+    const auto end = std::chrono::steady_clock::now();
+    std::cout << "  Woken by the timer: "
+              << (last == Wake::kTimer ? "yes" : "no") << " (should be yes), "
+              << "after "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   end - start).count()
+              << " milliseconds (should be about 20)." << std::endl;
+
+    std::cout << "  Spawning into a full scheduler: ";
+    Wake other = Wake::kStart;
+    scheduler.Spawn<IdleSession>( fds[0], &last );
+    const bool spawned = scheduler.Spawn<IdleSession>( fds[0], &other );
+    std::cout << (spawned ? "spawned" : "refused") << " (should be refused)"
+              << std::endl;
+
+    std::cout << "  Spawning with an invalid file descriptor (An error "
+              << "should be thrown):" << std::endl;
+    try
+    {
+      scheduler.Spawn<IdleSession>( -2, &other );
+    }
+    catch( const std::exception& e )
+    {
+      std::cout << "  " << e.what();
+    }
+    close( fds[0] );
+    close( fds[1] );
+  }
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the OutputSink implementations, and
+ * LabyrinthMap::Display() with a sink.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/output_sink.hpp"
+#include "../include/labyrinth_map.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING OUTPUT_SINK.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  const OutputSegment segments[] =
+  {
+    { "Hello", 5 },
+    { "", 0 },
+    { ", ", 2 },
+    { "world", 5 },
+  };
+
+  std::cout << "Writing 4 segments to a BufferSink:" << std::endl;
+  BufferSink buffer;
+  buffer.WriteSegments( segments, 4 );
+  std::cout << "  \"" << buffer.Contents()
+            << "\" (should be \"Hello, world\")" << std::endl;
+  buffer.Clear();
+  std::cout << "  " << buffer.Contents().size()
+            << " bytes after clearing (should be 0)." << std::endl;
+
+  std::cout << "Writing 4 segments to a FileSink and reading them back:"
+            << std::endl;
+  FILE* const f = std::tmpfile();
+  FileSink file( f );
+  file.WriteSegments( segments, 4 );
+  std::rewind( f );
+  char read_back[64] = {};
+  std::fread( read_back, 1, sizeof(read_back) - 1, f );
+  std::fclose( f );
+  std::cout << "  \"" << read_back << "\" (should be \"Hello, world\")"
+            << std::endl;
+
+  std::cout << "Writing 4 segments to an FdSink on a pipe and reading them "
+            << "back:" << std::endl;
+  int fds[2];
+  if( pipe(fds) != 0 )
+  {
+    std::cout << "  Could not create a pipe." << std::endl;
+  }
+  else
+  {
+    FdSink fd( fds[1] );
+    fd.WriteSegments( segments, 4 );
+    close( fds[1] );
+    const ssize_t size = read( fds[0], read_back, sizeof(read_back) - 1 );
+    close( fds[0] );
+    read_back[size < 0 ? 0 : size] = '\0';
+    std::cout << "  \"" << read_back << "\" (should be \"Hello, world\")"
+              << std::endl;
+  }
+
+  std::cout << "Writing to a closed file descriptor (error):" << std::endl;
+  try
+  {
+    FdSink closed( fds[1] );
+    closed.Write( "x", 1 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Creating a FileSink with a null stream (error):" << std::endl;
+  try
+  {
+    FileSink null_file( nullptr );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "TESTING LABYRINTHMAP::DISPLAY() WITH A SINK:" << std::endl
+            << std::endl;
+
+  Labyrinth l( 10, 10 );
+  for( size_t y = 0; y < 10; ++y )
+  {
+    for( size_t x = 0; x + 1 < 10; ++x )
+    {
+      l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+  }
+  l.SetItem( Coordinate(3, 3), Item::kBullet );
+
+  std::cout << "Rendering a 10x10 map into a BufferSink with each glyph set:"
+            << std::endl;
+  LabyrinthMap unicode_map( &l, 10, 10 );
+  LabyrinthMap ascii_map( &l, 10, 10, GlyphSet::kAscii );
+  LabyrinthMap cp437_map( &l, 10, 10, GlyphSet::kCodePage437 );
+  unicode_map.Display( buffer );
+  const size_t unicode_bytes = buffer.Contents().size();
+  buffer.Clear();
+  ascii_map.Display( buffer );
+  const std::string ascii = buffer.Contents();
+  buffer.Clear();
+  cp437_map.Display( buffer );
+  std::cout << "  Unicode: " << unicode_bytes << " bytes" << std::endl
+            << "  ASCII: " << ascii.size() << " bytes" << std::endl
+            << "  Code page 437: " << buffer.Contents().size()
+            << " bytes (should equal ASCII)" << std::endl;
+  std::cout << "  The ASCII map contains a bullet: "
+            << (ascii.find('*') != std::string::npos ? "yes" : "no")
+            << " (should be yes)." << std::endl;
+
+  std::cout << "The ASCII map:" << std::endl;
+  std::cout << ascii;
+  std::cout << std::endl;
+
+  std::cout << "Timing 10000 renders into a NullSink:" << std::endl;
+  NullSink null;
+  const auto start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 10000; ++i )
+  {
+    unicode_map.Display( null );
+  }
+  const auto end = std::chrono::steady_clock::now();
+  std::cout << "  " << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         end - start).count() / 10000
+            << " nanoseconds per render (" << null.Bytes() / 10000
+            << " bytes each)." << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
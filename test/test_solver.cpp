@@ -0,0 +1,668 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the LabyrinthSolver, LabyrinthPathCache and
+ * SpaceTimeSolver class implementations.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_solver.hpp"
+#include "../include/labyrinth_path_cache.hpp"
+#include "../include/labyrinth_space_time.hpp"
+#include "../include/labyrinth_nearest.hpp"
+#include "../include/next_hop_table.hpp"
+
+namespace
+{
+
+// This local function prints the given path.
+void PrintPath( const std::vector<Coordinate>& path );
+
+// This local function prints the given path.
+void PrintPath( const std::vector<Coordinate>& path )
+{
+  if( path.empty() )
+  {
+    std::cout << "  (no path)" << std::endl;
+    return;
+  }
+
+  std::cout << " ";
+  for( const Coordinate& c : path )
+  {
+    std::cout << " (" << c.x << ", " << c.y << ")";
+  }
+  std::cout << std::endl;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_SOLVER.CPP, LABYRINTH_PATH_CACHE.CPP, "
+            << "LABYRINTH_SPACE_TIME.CPP, LABYRINTH_NEAREST.CPP AND "
+            << "NEXT_HOP_TABLE.CPP IMPLEMENTATIONS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Creating a 3x3 Labyrinth with a C-shaped path:" << std::endl
+            << "  (0, 0) - (1, 0) - (2, 0)" << std::endl
+            << "  (0, 0) - (0, 1) - (0, 2) - (1, 2) - (2, 2)" << std::endl
+            << "  (1, 1) and (2, 1) are connected to each other only"
+            << std::endl;
+  Labyrinth l1( 3, 3 );
+  try
+  {
+    l1.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    l1.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+    l1.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+    l1.ConnectRooms( Coordinate(0, 1), Coordinate(0, 2) );
+    l1.ConnectRooms( Coordinate(0, 2), Coordinate(1, 2) );
+    l1.ConnectRooms( Coordinate(1, 2), Coordinate(2, 2) );
+    l1.ConnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "TESTING LABYRINTHSOLVER:" << std::endl << std::endl;
+  LabyrinthSolver solver( &l1 );
+
+  std::cout << "Path from (2, 0) to (2, 2) (should go around the C):"
+            << std::endl;
+  PrintPath( solver.ShortestPath(Coordinate(2, 0), Coordinate(2, 2)) );
+
+  std::cout << "Path from (0, 0) to (1, 1) (should be no path):"
+            << std::endl;
+  PrintPath( solver.ShortestPath(Coordinate(0, 0), Coordinate(1, 1)) );
+
+  std::cout << "Path from (0, 0) to (3, 0) (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    solver.ShortestPath( Coordinate(0, 0), Coordinate(3, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "TESTING LABYRINTHPATHCACHE:" << std::endl << std::endl;
+  LabyrinthPathCache cache( &l1, 2 );
+
+  std::cout << "Solving (2, 0) to (2, 2) twice and (1, 1) to (2, 1) once:"
+            << std::endl;
+  cache.ShortestPath( Coordinate(2, 0), Coordinate(2, 2) );
+  PrintPath( cache.ShortestPath(Coordinate(2, 0), Coordinate(2, 2)) );
+  PrintPath( cache.ShortestPath(Coordinate(1, 1), Coordinate(2, 1)) );
+  std::cout << "  Hits (should be 1): " << cache.Hits() << std::endl
+            << "  Misses (should be 2): " << cache.Misses() << std::endl
+            << "  Size (should be 2): " << cache.Size() << std::endl
+            << std::endl;
+
+  std::cout << "Solving (0, 0) to (0, 2), which evicts the least recently "
+            << "used path (2, 0) to (2, 2):" << std::endl;
+  cache.ShortestPath( Coordinate(0, 0), Coordinate(0, 2) );
+  cache.ShortestPath( Coordinate(1, 1), Coordinate(2, 1) );
+  std::cout << "  Misses (should be 3): " << cache.Misses() << std::endl
+            << std::endl;
+
+  std::cout << "Connecting (2, 1) and (2, 2), which joins the components "
+            << "of both cached paths." << std::endl;
+  l1.ConnectRooms( Coordinate(2, 1), Coordinate(2, 2) );
+  std::cout << "  Size (should be 0): " << cache.Size() << std::endl
+            << std::endl;
+
+  std::cout << "Connecting (1, 1) and (1, 0) after caching (2, 0) to (2, 2):"
+            << std::endl;
+  PrintPath( cache.ShortestPath(Coordinate(2, 0), Coordinate(2, 2)) );
+  l1.ConnectRooms( Coordinate(1, 1), Coordinate(1, 0) );
+  std::cout << "  Size (should be 0): " << cache.Size() << std::endl;
+  std::cout << "  New path (should pass through (1, 1)):" << std::endl;
+  PrintPath( cache.ShortestPath(Coordinate(2, 0), Coordinate(2, 2)) );
+  std::cout << std::endl;
+
+  std::cout << "Disconnecting (1, 1) and (2, 1) after caching (0, 0) to "
+            << "(0, 2), which only drops the path through them:"
+            << std::endl;
+  cache.ShortestPath( Coordinate(0, 0), Coordinate(0, 2) );
+  l1.DisconnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+  std::cout << "  Size (should be 1): " << cache.Size() << std::endl;
+  std::cout << "  New path (should go around the C):" << std::endl;
+  PrintPath( cache.ShortestPath(Coordinate(2, 0), Coordinate(2, 2)) );
+  l1.ConnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+  std::cout << std::endl;
+
+  std::cout << "TESTING CHEAPESTPATH():" << std::endl << std::endl;
+  DijkstraWorkspace ws;
+  std::vector<Coordinate> cheapest;
+
+  std::cout << "Cheapest path from (2, 0) to (2, 2) with every Room "
+            << "costing 1 (cost should be 4):" << std::endl;
+  std::cout << "  Cost: "
+            << solver.CheapestPath( Coordinate(2, 0), Coordinate(2, 2),
+                                    ws, cheapest )
+            << std::endl;
+  PrintPath( cheapest );
+
+  std::cout << "Cheapest path after setting the weight of (1, 1) to 9 "
+            << "(cost should be 6, avoiding (1, 1)):" << std::endl;
+  l1.SetRoomWeight( Coordinate(1, 1), 9 );
+  std::cout << "  Cost: "
+            << solver.CheapestPath( Coordinate(2, 0), Coordinate(2, 2),
+                                    ws, cheapest )
+            << std::endl;
+  PrintPath( cheapest );
+
+  std::cout << "Setting a weight of 0 (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    l1.SetRoomWeight( Coordinate(0, 0), 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Timing 1000000 cached lookups:" << std::endl;
+  const auto start = std::chrono::steady_clock::now();
+  size_t total_length = 0;
+  for( size_t i = 0; i < 1000000; ++i )
+  {
+    total_length += cache.ShortestPath( Coordinate(2, 0),
+                                        Coordinate(2, 2) ).size();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  std::cout << "  "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 end - start).count() / 1000000
+            << " nanoseconds per lookup (total length " << total_length
+            << ")." << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "TESTING SPACETIMESOLVER:" << std::endl << std::endl;
+
+  std::cout << "Creating a 5x2 Labyrinth with a corridor from (0, 0) to "
+            << "(4, 0) and a side Room (1, 1) below (1, 0)." << std::endl
+            << "A Minotaur walks the corridor from (4, 0) to (0, 0), one "
+            << "Room per turn." << std::endl;
+  Labyrinth l2( 5, 2 );
+  try
+  {
+    for( size_t x = 0; x < 4; ++x )
+    {
+      l2.ConnectRooms( Coordinate(x, 0), Coordinate(x + 1, 0) );
+    }
+    l2.ConnectRooms( Coordinate(1, 0), Coordinate(1, 1) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+
+  SpaceTimeSolver space_time( &l2 );
+  std::vector< std::vector<Coordinate> > trajectories( 1 );
+  for( size_t x = 5; x > 0; --x )
+  {
+    trajectories[0].push_back( Coordinate(x - 1, 0) );
+  }
+  space_time.SetTrajectories( trajectories );
+
+  std::cout << "Safe path from (0, 0) to (4, 0) (should hide in (1, 1) "
+            << "while the Minotaur passes):" << std::endl;
+  PrintPath( space_time.SafePath(Coordinate(0, 0), Coordinate(4, 0), 20) );
+
+  std::cout << "Safe path within 5 turns (should be no path):" << std::endl;
+  PrintPath( space_time.SafePath(Coordinate(0, 0), Coordinate(4, 0), 5) );
+
+  std::cout << "Safe path with a second Minotaur waiting in (1, 1) "
+            << "(should be no path):" << std::endl;
+  trajectories.push_back( std::vector<Coordinate>(1, Coordinate(1, 1)) );
+  space_time.SetTrajectories( trajectories );
+  PrintPath( space_time.SafePath(Coordinate(0, 0), Coordinate(4, 0), 20) );
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "TESTING LABYRINTHNEAREST:" << std::endl << std::endl;
+
+  std::cout << "Creating a 5x1 corridor with a Bullet in (4, 0), and "
+            << "keeping a distance field after 2 questions." << std::endl;
+  Labyrinth l3( 5, 1 );
+  for( size_t x = 0; x < 4; ++x )
+  {
+    l3.ConnectRooms( Coordinate(x, 0), Coordinate(x + 1, 0) );
+  }
+  l3.SetItem( Coordinate(4, 0), Item::kBullet );
+  LabyrinthNearest nearest( &l3, 2 );
+
+  NearestRoom bullet = nearest.NearestItem( Coordinate(0, 0), Item::kBullet );
+  std::cout << "Nearest Bullet to (0, 0): (" << bullet.room.x << ", "
+            << bullet.room.y << "), " << bullet.distance
+            << " steps (should be (4, 0), 4 steps)." << std::endl;
+  bullet = nearest.NearestItem( Coordinate(1, 0), Item::kBullet );
+  std::cout << "Nearest Bullet to (1, 0): " << bullet.distance
+            << " steps (should be 3); " << nearest.Searches()
+            << " searches and " << nearest.Lookups() << " lookups "
+            << "(should be 1 and 1)." << std::endl;
+
+  l3.TakeItem( Coordinate(4, 0) );
+  bullet = nearest.NearestItem( Coordinate(0, 0), Item::kBullet );
+  std::cout << "After taking the Bullet, one was found: "
+            << (bullet.found ? "yes" : "no") << " (should be no)."
+            << std::endl;
+
+  l3.SetItem( Coordinate(1, 0), Item::kBullet );
+  l3.SetItem( Coordinate(3, 0), Item::kBullet );
+  bullet = nearest.NearestItem( Coordinate(4, 0), Item::kBullet );
+  std::cout << "After placing Bullets in (1, 0) and (3, 0), the nearest "
+            << "to (4, 0) is (" << bullet.room.x << ", " << bullet.room.y
+            << ") (should be (3, 0)); " << nearest.FieldsKept()
+            << " field kept (should be 1)." << std::endl;
+
+  std::vector<NearestRoom> bullets;
+  nearest.KNearestItems( Coordinate(0, 0), Item::kBullet, 5, bullets );
+  std::cout << "Every Bullet from (0, 0): " << bullets.size()
+            << " found (should be 2) at " << bullets[0].distance << " and "
+            << bullets[1].distance << " steps (should be 1 and 3)."
+            << std::endl;
+
+  std::cout << "Asking for the nearest null Item (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    nearest.NearestItem( Coordinate(0, 0), Item::kNone );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Changing a 10x10 Labyrinth 5000 times at random, and "
+            << "comparing the kept fields with searches after each "
+            << "change:" << std::endl;
+  Labyrinth l4( 10, 10 );
+  for( size_t y = 0; y < 10; ++y )
+  {
+    for( size_t x = 0; x + 1 < 10; ++x )
+    {
+      l4.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+  }
+  LabyrinthNearest kept( &l4, 1 );
+  LabyrinthNearest searched( &l4, SIZE_MAX );
+  std::mt19937 random( 92 );
+  size_t mismatches = 0;
+  for( size_t i = 0; i < 5000; ++i )
+  {
+    const Coordinate c( random() % 10, random() % 10 );
+    const Coordinate below( c.x, c.y + 1 );
+    switch( random() % 6 )
+    {
+      case 0:  l4.TrySetItem( c, Item::kBullet );              break;
+      case 1:  l4.TryTakeItem( c );                            break;
+      case 2:  l4.TrySetInhabitant( c, Inhabitant::kMinotaur ); break;
+      case 3:  l4.TryAttackEnemy( c );                         break;
+      case 4:  l4.TryConnectRooms( c, below );                 break;
+      default:
+        if( random() % 8 == 0 )
+        {
+          l4.TryDisconnectRooms( c, below );
+        }
+        break;
+    }
+
+    const Coordinate q( random() % 10, random() % 10 );
+    const NearestRoom b = kept.NearestItem( q, Item::kBullet );
+    const NearestRoom m = kept.NearestInhabitant( q, Inhabitant::kMinotaur );
+    searched.KNearestItems( q, Item::kBullet, 1, bullets );
+    mismatches += b.found != !bullets.empty() ||
+                  (b.found && b.distance != bullets[0].distance) ? 1 : 0;
+    searched.KNearestInhabitants( q, Inhabitant::kMinotaur, 1, bullets );
+    mismatches += m.found != !bullets.empty() ||
+                  (m.found && m.distance != bullets[0].distance) ? 1 : 0;
+  }
+  std::cout << "  " << mismatches << " mismatches (should be 0), "
+            << kept.Lookups() << " lookups (should be 10000)." << std::endl;
+
+  std::cout << "Timing 100000 questions of each kind for a Minotaur in "
+            << "(9, 9) of a 10x10 Labyrinth:" << std::endl;
+  Labyrinth l5( 10, 10 );
+  for( size_t y = 0; y < 10; ++y )
+  {
+    for( size_t x = 0; x + 1 < 10; ++x )
+    {
+      l5.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+    if( y + 1 < 10 )
+    {
+      l5.ConnectRooms( Coordinate(0, y), Coordinate(0, y + 1) );
+    }
+  }
+  l5.SetInhabitant( Coordinate(9, 9), Inhabitant::kMinotaur );
+  for( const size_t cache_after : { size_t(1), SIZE_MAX } )
+  {
+    LabyrinthNearest timed( &l5, cache_after );
+    const auto timed_start = std::chrono::steady_clock::now();
+    size_t total_distance = 0;
+    for( size_t i = 0; i < 100000; ++i )
+    {
+      total_distance += timed.NearestInhabitant(
+        Coordinate(i % 10, (i / 10) % 10), Inhabitant::kMinotaur ).distance;
+    }
+    const auto timed_end = std::chrono::steady_clock::now();
+    std::cout << "  " << (cache_after == 1 ? "Lookup: " : "Search: ")
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   timed_end - timed_start).count() / 100000
+              << " nanoseconds per question (total distance "
+              << total_distance << ")." << std::endl;
+  }
+  std::cout << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "TESTING NEXTHOPTABLE:" << std::endl << std::endl;
+
+  std::cout << "Solving paths from (2, 0) in the 3x3 Labyrinth with a new "
+            << "cache:" << std::endl;
+  LabyrinthPathCache table_cache( &l1, 16 );
+  std::cout << "  Reads paths from a NextHopTable before solving any: "
+            << (table_cache.UsesNextHopTable() ? "yes" : "no")
+            << " (should be no)." << std::endl;
+  size_t cached_mismatches = 0;
+  for( size_t id = 0; id < 9; ++id )
+  {
+    const Coordinate dst( id % 3, id / 3 );
+    cached_mismatches += table_cache.ShortestPath( Coordinate(2, 0),
+                                                  dst ).size() !=
+                        solver.ShortestPath( Coordinate(2, 0), dst ).size();
+  }
+  std::cout << "  After solving 9 paths (one per Room): "
+            << (table_cache.UsesNextHopTable() ? "yes" : "no")
+            << " (should be yes)." << std::endl;
+  for( size_t id = 0; id < 9; ++id )
+  {
+    const Coordinate dst( id % 3, id / 3 );
+    cached_mismatches += table_cache.ShortestPath( Coordinate(0, 2),
+                                                  dst ).size() !=
+                        solver.ShortestPath( Coordinate(0, 2), dst ).size();
+  }
+  std::cout << "  Paths of a different length than the solver's (should be "
+            << "0): " << cached_mismatches << std::endl;
+  l1.DisconnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+  std::cout << "  After disconnecting (1, 1) and (2, 1): "
+            << (table_cache.UsesNextHopTable() ? "yes" : "no")
+            << " (should be no)." << std::endl;
+  l1.ConnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+  std::cout << std::endl;
+
+  std::cout << "Connecting every Room of a 20x20 Labyrinth with a cache "
+            << "attached:" << std::endl;
+  Labyrinth carved( 20, 20 );
+  LabyrinthPathCache carved_cache( &carved, 16 );
+  const auto carve_start = std::chrono::steady_clock::now();
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x + 1 < 20; ++x )
+    {
+      carved.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+    if( y + 1 < 20 )
+    {
+      carved.ConnectRooms( Coordinate(0, y), Coordinate(0, y + 1) );
+    }
+  }
+  const auto carve_end = std::chrono::steady_clock::now();
+  std::cout << "  "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 carve_end - carve_start).count() / 399
+            << " nanoseconds per connection; reads paths from a "
+            << "NextHopTable: "
+            << (carved_cache.UsesNextHopTable() ? "yes" : "no")
+            << " (should be no)." << std::endl << std::endl;
+
+  Labyrinth l6( 3, 3 );
+  l6.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l6.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l6.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  l6.ConnectRooms( Coordinate(0, 1), Coordinate(0, 2) );
+  l6.ConnectRooms( Coordinate(0, 2), Coordinate(1, 2) );
+  l6.ConnectRooms( Coordinate(1, 2), Coordinate(2, 2) );
+  l6.ConnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+  NextHopTable table( &l6 );
+  const Coordinate corner( 2, 0 );
+  const Coordinate target( 2, 2 );
+
+  std::cout << "From (2, 0) to (2, 2) in the C-shaped Labyrinth:"
+            << std::endl;
+  std::cout << "  Distance: " << table.Distance( corner, target )
+            << " (should be 6), first step west: "
+            << (table.NextHop(corner, target) == Direction::kWest ? "yes"
+                                                                  : "no")
+            << " (should be yes)" << std::endl;
+  std::cout << "From (0, 0) to (1, 1), which is not connected:" << std::endl
+            << "  Unreachable: "
+            << (table.Distance(Coordinate(0, 0), Coordinate(1, 1)) ==
+                  NextHopTable::kUnreachable ? "yes" : "no")
+            << " (should be yes), no step: "
+            << (table.NextHop(Coordinate(0, 0), Coordinate(1, 1)) ==
+                  Direction::kNone ? "yes" : "no")
+            << " (should be yes)" << std::endl << std::endl;
+
+  std::cout << "Connecting (2, 0) and (2, 1), and (2, 1) and (2, 2):"
+            << std::endl;
+  l6.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  l6.ConnectRooms( Coordinate(2, 1), Coordinate(2, 2) );
+  std::vector<Coordinate> hops;
+  table.ShortestPath( corner, target, hops );
+  PrintPath( hops );
+  std::cout << "  (should go straight down), "
+            << table.Distance( Coordinate(0, 0), Coordinate(1, 1) )
+            << " steps from (0, 0) to (1, 1) (should be 4)" << std::endl
+            << std::endl;
+
+  std::cout << "Disconnecting (2, 0) and (2, 1):" << std::endl;
+  const size_t searches = table.Searches();
+  l6.DisconnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  table.ShortestPath( corner, target, hops );
+  PrintPath( hops );
+  std::cout << "  (should go around the C), "
+            << table.Searches() - searches << " destinations searched again "
+            << "(should be fewer than 9)" << std::endl << std::endl;
+
+  std::cout << "Finding the next step to (3, 0) (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    table.NextHop( corner, Coordinate(3, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Comparing a 10x10 table repaired through 300 random "
+            << "connections and disconnections with one built each time:"
+            << std::endl;
+  Labyrinth l7( 10, 10 );
+  NextHopTable repaired( &l7 );
+  size_t table_mismatches = 0;
+  for( size_t i = 0; i < 300; ++i )
+  {
+    const Coordinate a( random() % 10, random() % 10 );
+    const bool horizontal = random() % 2 == 0;
+    if( (horizontal && a.x == 9) || (!horizontal && a.y == 9) )
+    {
+      continue;
+    }
+    const Coordinate b( a.x + (horizontal ? 1 : 0),
+                        a.y + (horizontal ? 0 : 1) );
+    const Direction d = horizontal ? Direction::kEast : Direction::kSouth;
+    if( l7.DirectionCheck(a, d) == RoomBorder::kRoom && random() % 3 == 0 )
+    {
+      l7.DisconnectRooms( a, b );
+    }
+    else if( l7.DirectionCheck(a, d) == RoomBorder::kWall )
+    {
+      l7.ConnectRooms( a, b );
+    }
+
+    // Every distance must match, and every step must lead through an
+    // open wall to a Room one step closer
+    NextHopTable built( &l7 );
+    for( size_t src = 0; src < 100; ++src )
+    {
+      for( size_t dst = 0; dst < 100; ++dst )
+      {
+        const Coordinate s( src % 10, src / 10 );
+        const Coordinate t( dst % 10, dst / 10 );
+        const uint16_t distance = repaired.Distance( s, t );
+        table_mismatches += distance != built.Distance( s, t ) ? 1 : 0;
+        const Direction step = repaired.NextHop( s, t );
+        if( step == Direction::kNone )
+        {
+          table_mismatches += distance != 0 &&
+                              distance != NextHopTable::kUnreachable ? 1 : 0;
+          continue;
+        }
+        const Coordinate next(
+          s.x + (step == Direction::kEast) - (step == Direction::kWest),
+          s.y + (step == Direction::kSouth) - (step == Direction::kNorth) );
+        table_mismatches += l7.DirectionCheck(s, step) != RoomBorder::kRoom ||
+                            repaired.Distance(next, t) + 1 != distance ? 1 : 0;
+      }
+    }
+  }
+  std::cout << "  " << table_mismatches << " mismatches (should be 0)."
+            << std::endl << std::endl;
+
+  std::cout << "Timing a 20x20 Labyrinth:" << std::endl;
+  Labyrinth l8( 20, 20 );
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x < 20; ++x )
+    {
+      if( x + 1 < 20 && random() % 3 != 0 )
+      {
+        l8.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 20 && random() % 3 != 0 )
+      {
+        l8.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  for( const size_t threads : { size_t(1), size_t(4) } )
+  {
+    const auto build_start = std::chrono::steady_clock::now();
+    NextHopTable timed( &l8, threads );
+    const auto build_end = std::chrono::steady_clock::now();
+    std::cout << "  Building on " << threads << " thread"
+              << (threads == 1 ? ": " : "s: ")
+              << std::chrono::duration_cast<std::chrono::microseconds>(
+                   build_end - build_start).count()
+              << " microseconds." << std::endl;
+  }
+  NextHopTable big_table( &l8 );
+  NextHopTable banded_table( &l8, 4, false );
+  banded_table.Rebuild();
+  size_t banded_mismatches = 0;
+  for( size_t i = 0; i < 400 * 400; ++i )
+  {
+    const Coordinate s( i % 20, (i / 20) % 20 );
+    const Coordinate t( (i / 400) % 20, i / 8000 );
+    banded_mismatches += banded_table.Distance( s, t ) !=
+                         big_table.Distance( s, t ) ? 1 : 0;
+  }
+  std::cout << "  Rebuilt on 4 threads: " << banded_mismatches
+            << " mismatches with 1 thread (should be 0)." << std::endl;
+  const auto lookup_start = std::chrono::steady_clock::now();
+  size_t steps = 0;
+  for( size_t i = 0; i < 1000000; ++i )
+  {
+    steps += big_table.NextHop( Coordinate(i % 20, (i / 20) % 20),
+                                Coordinate((i / 400) % 20, (i / 7) % 20) ) !=
+             Direction::kNone ? 1 : 0;
+  }
+  const auto lookup_end = std::chrono::steady_clock::now();
+  std::cout << "  Lookups: "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 lookup_end - lookup_start).count() / 1000000
+            << " nanoseconds per lookup (" << steps << " steps)."
+            << std::endl;
+  const size_t before_toggles = big_table.Searches();
+  const auto toggle_start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < 100; ++i )
+  {
+    const Coordinate a( i % 19, (i * 7) % 20 );
+    const Coordinate b( a.x + 1, a.y );
+    if( l8.DirectionCheck(a, Direction::kEast) == RoomBorder::kRoom )
+    {
+      l8.DisconnectRooms( a, b );
+      l8.ConnectRooms( a, b );
+    }
+    else
+    {
+      l8.ConnectRooms( a, b );
+      l8.DisconnectRooms( a, b );
+    }
+  }
+  const auto toggle_end = std::chrono::steady_clock::now();
+  std::cout << "  Repairs: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(
+                 toggle_end - toggle_start).count() / 200
+            << " microseconds per change, "
+            << (big_table.Searches() - before_toggles) / 200
+            << " destinations searched again per change (of 400)."
+            << std::endl;
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the SpawnFairness class implementation.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/spawn_fairness.hpp"
+
+namespace
+{
+  // This local function prints the distances of a report.
+  void PrintReport( const SpawnReport& r );
+
+  void PrintReport( const SpawnReport& r )
+  {
+    const char* const names[] = { "Treasure", "exit", "Minotaur" };
+    const uint32_t* const distances[] = { r.treasure, r.exit, r.minotaur };
+    for( size_t i = 0; i < 3; ++i )
+    {
+      std::cout << "  " << names[i] << ": ";
+      for( size_t s = 0; s < 2; ++s )
+      {
+        if( distances[i][s] == SpawnReport::kUnreachable )
+        {
+          std::cout << "unreachable";
+        }
+        else
+        {
+          std::cout << distances[i][s];
+        }
+        std::cout << (s == 0 ? " and " : " steps\n");
+      }
+    }
+    std::cout << "  Imbalance: ";
+    if( r.imbalance == SpawnReport::kUnreachable )
+    {
+      std::cout << "unreachable";
+    }
+    else
+    {
+      std::cout << r.imbalance;
+    }
+    std::cout << std::endl;
+  }
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING SPAWN_FAIRNESS.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  // Every row is a corridor, and the rows are joined by column 3, with the
+  // Treasure at the top and the exit at the bottom of that column
+  Labyrinth l( 7, 5 );
+  for( size_t y = 0; y < 5; ++y )
+  {
+    for( size_t x = 0; x + 1 < 7; ++x )
+    {
+      l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+    if( y + 1 < 5 )
+    {
+      l.ConnectRooms( Coordinate(3, y), Coordinate(3, y + 1) );
+    }
+  }
+  l.SetItem( Coordinate(3, 0), Item::kTreasure );
+  l.SetExit( Coordinate(3, 4), Direction::kSouth );
+  SpawnFairness fairness( &l );
+
+  std::cout << "Spawning in (0, 2) and (6, 2), on either side of the middle "
+            << "column:" << std::endl;
+  l.SetSpawn1( Coordinate(0, 2) );
+  l.SetSpawn2( Coordinate(6, 2) );
+  SpawnReport r = fairness.Evaluate();
+  PrintReport( r );
+  std::cout << "  (should be 5 and 5, 5 and 5, unreachable and unreachable, "
+            << "and 0; " << r.between << " steps between them, should be "
+            << "6)" << std::endl << std::endl;
+
+  std::cout << "Spawning in (0, 0) and (6, 4), in opposite corners:"
+            << std::endl;
+  r = fairness.Evaluate( Coordinate(0, 0), Coordinate(6, 4) );
+  PrintReport( r );
+  std::cout << "  (should be 3 and 7, 7 and 3, unreachable and unreachable, "
+            << "and 8)" << std::endl << std::endl;
+
+  std::cout << "Placing a Minotaur in (1, 2), and spawning in (0, 2) and "
+            << "(6, 2) again:" << std::endl;
+  l.SetInhabitant( Coordinate(1, 2), Inhabitant::kMinotaur );
+  r = fairness.Evaluate();
+  PrintReport( r );
+  std::cout << "  (should be 5 and 5, 5 and 5, 1 and 5, and 4)" << std::endl
+            << std::endl;
+
+  std::cout << "Finding the most balanced spawns at least 4 steps apart:"
+            << std::endl;
+  Coordinate s_1;
+  Coordinate s_2;
+  const bool found = fairness.FindBalancedSpawns( 4, s_1, s_2 );
+  r = fairness.Evaluate( s_1, s_2 );
+  std::cout << "  Found: " << (found ? "yes" : "no") << " (should be yes), ("
+            << s_1.x << ", " << s_1.y << ") and (" << s_2.x << ", " << s_2.y
+            << "), imbalance " << r.imbalance << " (should be 0), "
+            << r.between << " steps apart (should be at least 4)."
+            << std::endl << std::endl;
+
+  std::cout << "Spawning in a Room which cannot be reached:" << std::endl;
+  Labyrinth l2( 3, 1 );
+  l2.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l2.SetItem( Coordinate(1, 0), Item::kTreasure );
+  SpawnFairness fairness_2( &l2 );
+  r = fairness_2.Evaluate( Coordinate(0, 0), Coordinate(2, 0) );
+  PrintReport( r );
+  std::cout << "  (should be 1 and unreachable, unreachable and "
+            << "unreachable, unreachable and unreachable, and unreachable)"
+            << std::endl << std::endl;
+
+  std::cout << "Evaluating a spawn outside of the Labyrinth (An error "
+            << "should be thrown):" << std::endl;
+  try
+  {
+    fairness.Evaluate( Coordinate(7, 0), Coordinate(0, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Timing FindBalancedSpawns() on a random 20x20 Labyrinth "
+            << "with 3 Minotaurs:" << std::endl;
+  Labyrinth big( 20, 20 );
+  std::mt19937 random( 96 );
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x < 20; ++x )
+    {
+      if( x + 1 < 20 && random() % 3 != 0 )
+      {
+        big.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 20 && random() % 3 != 0 )
+      {
+        big.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  big.SetItem( Coordinate(10, 10), Item::kTreasure );
+  big.SetExit( Coordinate(19, 5), Direction::kEast );
+  big.SetInhabitant( Coordinate(2, 17), Inhabitant::kMinotaur );
+  big.SetInhabitant( Coordinate(15, 3), Inhabitant::kMinotaur );
+  big.SetInhabitant( Coordinate(8, 12), Inhabitant::kMinotaur );
+  SpawnFairness big_fairness( &big );
+  const auto start = std::chrono::steady_clock::now();
+  bool big_found = false;
+  for( size_t i = 0; i < 100; ++i )
+  {
+    big_found = big_fairness.FindBalancedSpawns( 10, s_1, s_2 );
+  }
+  const auto end = std::chrono::steady_clock::now();
+  r = big_fairness.Evaluate( s_1, s_2 );
+  std::cout << "  Found: " << (big_found ? "yes" : "no") << " (should be "
+            << "yes), imbalance " << r.imbalance << ", in "
+            << std::chrono::duration_cast<std::chrono::microseconds>(
+                 end - start).count() / 100
+            << " microseconds per search." << std::endl;
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,171 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the LabyrinthTower and TowerSolver class
+ * implementations.
+ *
+ */
+
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_tower.hpp"
+
+namespace
+{
+
+// This local function prints the given path.
+void PrintPath( const std::vector<TowerCoordinate>& path );
+
+// This local function prints the given path.
+void PrintPath( const std::vector<TowerCoordinate>& path )
+{
+  if( path.empty() )
+  {
+    std::cout << "  (no path)" << std::endl;
+    return;
+  }
+
+  std::cout << " ";
+  for( const TowerCoordinate& c : path )
+  {
+    std::cout << " " << c.floor << ":(" << c.rm.x << ", " << c.rm.y << ")";
+  }
+  std::cout << std::endl;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_TOWER.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  const std::string filename = "test_tower.tower";
+
+  std::cout << "Creating a tower file with 0 floors (error):" << std::endl;
+  try
+  {
+    CreateTowerFile( filename, 3, 3, 0 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << "Opening a file which does not exist (error):" << std::endl;
+  try
+  {
+    LabyrinthTower t( "does_not_exist.tower", 2 );
+    std::cout << "  No error was thrown." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Creating a tower of 3 floors of 3x3 Rooms, with at most 2 "
+            << "floors in memory:" << std::endl
+            << "  Floor 0: a corridor along y = 0, with stairs up at (2, 0)"
+            << std::endl
+            << "  Floor 1: a corridor along x = 2, with stairs up at (2, 2)"
+            << std::endl
+            << "  Floor 2: a corridor along y = 2" << std::endl;
+  CreateTowerFile( filename, 3, 3, 3 );
+  {
+    LabyrinthTower t( filename, 2 );
+    t.Floor(0).ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    t.Floor(0).ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+    t.SetStairs( TowerCoordinate(0, Coordinate(2, 0)) );
+    t.Floor(1).ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+    t.Floor(1).ConnectRooms( Coordinate(2, 1), Coordinate(2, 2) );
+    t.SetStairs( TowerCoordinate(1, Coordinate(2, 2)) );
+    t.Floor(2).ConnectRooms( Coordinate(2, 2), Coordinate(1, 2) );
+    t.Floor(2).ConnectRooms( Coordinate(1, 2), Coordinate(0, 2) );
+    std::cout << "  " << t.ActiveFloors()
+              << " floors are in memory (should be 2)." << std::endl;
+
+    std::cout << "Creating stairs up at 1:(1, 1) while floors 1 and 2 are in "
+              << "memory:" << std::endl;
+    t.SetStairs( TowerCoordinate(1, Coordinate(1, 1)) );
+    std::cout << "  2:(1, 1) has stairs down: "
+              << (t.HasStairsDown(TowerCoordinate(2, Coordinate(1, 1))) ?
+                  "yes" : "no")
+              << " (should be yes)." << std::endl;
+
+    std::cout << "Creating stairs on the top floor (error):" << std::endl;
+    try
+    {
+      t.SetStairs( TowerCoordinate(2, Coordinate(0, 0)) );
+      std::cout << "  No error was thrown." << std::endl;
+    }
+    catch( const std::exception& e )
+    {
+      std::cout << "  " << e.what();
+    }
+  }
+  std::cout << std::endl;
+
+  std::cout << "Reopening the tower with 1 floor in memory, and solving "
+            << "from 0:(0, 0) to 2:(0, 2):" << std::endl;
+  {
+    LabyrinthTower t( filename, 1 );
+    TowerSolver solver( &t );
+    PrintPath( solver.ShortestPath(TowerCoordinate(0, Coordinate(0, 0)),
+                                   TowerCoordinate(2, Coordinate(0, 2))) );
+    std::cout << "  (should be 0:(0, 0) 0:(1, 0) 0:(2, 0) 1:(2, 0) 1:(2, 1) "
+              << "1:(2, 2) 2:(2, 2) 2:(1, 2) 2:(0, 2))" << std::endl;
+    std::cout << "  " << t.ActiveFloors()
+              << " floor is in memory (should be 1)." << std::endl;
+
+    std::cout << "Solving from 0:(0, 0) to 1:(0, 0) (should be no path):"
+              << std::endl;
+    PrintPath( solver.ShortestPath(TowerCoordinate(0, Coordinate(0, 0)),
+                                   TowerCoordinate(1, Coordinate(0, 0))) );
+
+    std::cout << "Solving to a floor which does not exist (error):"
+              << std::endl;
+    try
+    {
+      solver.ShortestPath( TowerCoordinate(0, Coordinate(0, 0)),
+                           TowerCoordinate(3, Coordinate(0, 0)) );
+      std::cout << "  No error was thrown." << std::endl;
+    }
+    catch( const std::exception& e )
+    {
+      std::cout << "  " << e.what();
+    }
+    std::cout << std::endl;
+
+    std::cout << "Displaying floor 1 (stairs up at (1, 1) and (2, 2), and "
+              << "down at (2, 0)):" << std::endl;
+    const size_t reads = t.FloorReads();
+    t.DisplayFloor( 1 );
+    std::cout << "  Floors read from the file: " << t.FloorReads() - reads
+              << " (should be at most 1)." << std::endl;
+  }
+  std::remove( filename.c_str() );
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}